@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/fitted_attribute_vector.hpp"
+#include "../lib/storage/value_column.hpp"
+
+// Compares the construction of DictionaryColumns with the previous approach, which sorted a copy of all values and
+// looked up the ValueID of every row with a binary search.
+
+namespace {
+
+using opossum::ValueColumn;
+
+template <typename T>
+size_t compress_with_binary_search(const ValueColumn<T>& value_column) {
+  const auto& values = value_column.values();
+
+  auto dictionary = std::vector<T>(values.cbegin(), values.cend());
+  std::sort(dictionary.begin(), dictionary.end());
+  dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+
+  opossum::FittedAttributeVector<uint32_t> attribute_vector(values.size());
+  for (size_t row = 0; row < values.size(); ++row) {
+    const auto value_it = std::lower_bound(dictionary.cbegin(), dictionary.cend(), values[row]);
+    attribute_vector.set(row, opossum::ValueID{static_cast<uint32_t>(value_it - dictionary.cbegin())});
+  }
+  return dictionary.size();
+}
+
+template <typename Functor>
+double measure_milliseconds(const Functor& func) {
+  const auto begin = std::chrono::steady_clock::now();
+  func();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+template <typename T, typename Generator>
+void run_benchmark(const std::string& name, const size_t row_count, const Generator& generator) {
+  auto value_column = std::make_shared<ValueColumn<T>>();
+  for (size_t row = 0; row < row_count; ++row) value_column->append(generator(row));
+
+  const auto binary_search_ms = measure_milliseconds([&] { compress_with_binary_search(*value_column); });
+  const auto dictionary_column_ms = measure_milliseconds([&] { opossum::DictionaryColumn<T>{value_column}; });
+
+  std::cout << name << ": binary search " << binary_search_ms << " ms, DictionaryColumn " << dictionary_column_ms
+            << " ms (speedup " << binary_search_ms / dictionary_column_ms << "x)" << std::endl;
+}
+
+}  // namespace
+
+int main() {
+  constexpr size_t row_count = 1'000'000;
+
+  run_benchmark<int32_t>("int, 100 distinct", row_count, [](size_t row) { return static_cast<int32_t>(row % 100); });
+  run_benchmark<int32_t>("int, unique", row_count, [](size_t row) { return static_cast<int32_t>(row * 7919); });
+  run_benchmark<std::string>("string, 100 distinct", row_count,
+                             [](size_t row) { return "category " + std::to_string(row % 100); });
+  run_benchmark<std::string>("string, unique", row_count,
+                             [](size_t row) { return "a long customer name number " + std::to_string(row * 7919); });
+
+  return 0;
+}
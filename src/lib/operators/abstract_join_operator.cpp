@@ -0,0 +1,98 @@
+#include "abstract_join_operator.hpp"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractJoinOperator::AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                                           const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                                           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractOperator(left, right), _mode{mode}, _column_ids{column_ids}, _scan_type{scan_type} {
+  Assert(left != nullptr && right != nullptr, "Joins need two inputs!");
+}
+
+JoinMode AbstractJoinOperator::mode() const { return _mode; }
+
+const std::pair<ColumnID, ColumnID>& AbstractJoinOperator::column_ids() const { return _column_ids; }
+
+ScanType AbstractJoinOperator::scan_type() const { return _scan_type; }
+
+void AbstractJoinOperator::_validate_inputs() const {
+  const auto left = _input_table_left();
+  const auto right = _input_table_right();
+  Assert(_column_ids.first < left->col_count(), "Left column ID out of range!");
+  Assert(_column_ids.second < right->col_count(), "Right column ID out of range!");
+  Assert(left->column_type(_column_ids.first) == right->column_type(_column_ids.second),
+         "Join columns must have the same type!");
+}
+
+AbstractJoinOperator::LeftMatches AbstractJoinOperator::_create_left_matches() const {
+  const auto left = _input_table_left();
+  LeftMatches left_matches(left->chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < left->chunk_count(); ++chunk_id) {
+    left_matches[chunk_id].resize(left->get_chunk(chunk_id).size());
+  }
+  return left_matches;
+}
+
+void AbstractJoinOperator::_add_left_rows_by_match(const LeftMatches& left_matches, PosList& left_positions,
+                                                   PosList& right_positions) const {
+  if (_mode == JoinMode::Inner) return;
+
+  const auto add_matched = _mode == JoinMode::Semi;
+  for (ChunkID chunk_id{0}; chunk_id < left_matches.size(); ++chunk_id) {
+    const auto& chunk_matches = left_matches[chunk_id];
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_matches.size(); ++chunk_offset) {
+      if ((chunk_matches[chunk_offset] != 0) != add_matched) continue;
+      left_positions.push_back(RowID{chunk_id, chunk_offset});
+      if (_mode == JoinMode::Left) right_positions.push_back(NULL_ROW_ID);
+    }
+  }
+}
+
+std::shared_ptr<const Table> AbstractJoinOperator::_create_output_table(
+    const std::shared_ptr<const PosList>& left_positions, const std::shared_ptr<const PosList>& right_positions) const {
+  const auto left = _input_table_left();
+  const auto right = _input_table_right();
+  const auto outputs_right = _mode == JoinMode::Inner || _mode == JoinMode::Left;
+
+  auto output = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < left->col_count(); ++column_id) {
+    output->add_column_definition(left->column_name(column_id), left->column_type(column_id));
+  }
+  if (outputs_right) {
+    // Column names must be unique, so right columns whose names are already taken, e.g., in self-joins, are qualified
+    // as "right.<name>", with a number appended if that is taken, too.
+    std::set<std::string> names(left->column_names().cbegin(), left->column_names().cend());
+    for (ColumnID column_id{0}; column_id < right->col_count(); ++column_id) {
+      auto name = right->column_name(column_id);
+      if (names.count(name)) {
+        const auto qualified_name = "right." + name;
+        name = qualified_name;
+        for (auto suffix = 2; names.count(name); ++suffix) name = qualified_name + "_" + std::to_string(suffix);
+      }
+      names.insert(name);
+      output->add_column_definition(name, right->column_type(column_id));
+    }
+  }
+
+  auto chunk = Chunk{};
+  add_reference_columns(chunk, left, left_positions);
+  if (outputs_right) {
+    DebugAssert(left_positions->size() == right_positions->size(), "Left and right positions must match!");
+    add_reference_columns(chunk, right, right_positions);
+  }
+  output->emplace_chunk(std::move(chunk));
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The super class of all join operators. A join compares the column column_ids.first of the left input with the column
+// column_ids.second of the right input, which must have the same type, using scan_type (see JoinMode for the modes).
+// Inner and left joins output the columns of the left input followed by those of the right input, semi and anti joins
+// only those of the left input. Right columns whose names are already taken are qualified as "right.<name>". All
+// output columns are ReferenceColumns that point into the tables holding the data.
+class AbstractJoinOperator : public AbstractOperator {
+ public:
+  // Flags of the left rows that found a match, indexed by ChunkID and ChunkOffset. The flags are bytes, as the bits of
+  // a std::vector<bool> cannot be written by several threads at once.
+  using LeftMatches = std::vector<std::vector<uint8_t>>;
+
+  AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                       const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                       const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+  JoinMode mode() const;
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+  ScanType scan_type() const;
+
+ protected:
+  // checks that the join columns exist in the inputs and have the same type
+  void _validate_inputs() const;
+
+  // returns unset flags for all rows of the left input
+  LeftMatches _create_left_matches() const;
+
+  // Appends the left rows with a match (semi joins) or without one (left and anti joins) to the positions, in the order
+  // of the rows. The unmatched rows of left joins are paired with NULL_ROW_ID. Does nothing for inner joins.
+  void _add_left_rows_by_match(const LeftMatches& left_matches, PosList& left_positions,
+                               PosList& right_positions) const;
+
+  // Creates the output table, whose rows are given as positions in the input tables: the row i consists of the left row
+  // left_positions[i] and the right row right_positions[i]. For semi and anti joins, right_positions is ignored.
+  std::shared_ptr<const Table> _create_output_table(const std::shared_ptr<const PosList>& left_positions,
+                                                    const std::shared_ptr<const PosList>& right_positions) const;
+
+  const JoinMode _mode;
+  const std::pair<ColumnID, ColumnID> _column_ids;
+  const ScanType _scan_type;
+};
+
+}  // namespace opossum
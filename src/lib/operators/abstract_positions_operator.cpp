@@ -0,0 +1,156 @@
+#include "abstract_positions_operator.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr size_t MIN_ROWS_PER_THREAD = 10'000;
+
+// The table and columns that all chunks of a reference table point to
+struct References {
+  std::shared_ptr<const Table> table;
+  std::vector<ColumnID> column_ids;
+};
+
+References get_references(const Table& input) {
+  Assert(input.col_count() > 0, "Inputs must have columns!");
+
+  References references;
+  for (ChunkID chunk_id{0}; chunk_id < input.chunk_count(); ++chunk_id) {
+    const auto& chunk = input.get_chunk(chunk_id);
+    std::shared_ptr<const PosList> pos_list;
+    for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+      const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(column_id));
+      Assert(column != nullptr, "Inputs must consist of ReferenceColumns!");
+      if (!pos_list) pos_list = column->pos_list();
+      Assert(column->pos_list() == pos_list, "The columns of a chunk must share their PosList!");
+
+      if (!references.table) references.table = column->referenced_table();
+      Assert(column->referenced_table() == references.table, "All columns must reference the same table!");
+      if (references.column_ids.size() == static_cast<size_t>(column_id)) {
+        references.column_ids.push_back(column->referenced_column_id());
+      }
+      Assert(column->referenced_column_id() == references.column_ids[column_id],
+             "All chunks must reference the same columns!");
+    }
+  }
+  return references;
+}
+
+// returns the offsets of the positions of a reference table, grouped by their chunk in the referenced table
+std::vector<std::vector<ChunkOffset>> group_offsets(const Table& input, const ChunkID referenced_chunk_count) {
+  std::vector<std::vector<ChunkOffset>> offsets(referenced_chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < input.chunk_count(); ++chunk_id) {
+    const auto& chunk = input.get_chunk(chunk_id);
+    if (chunk.col_count() == 0) continue;
+
+    const auto& pos_list = *static_cast<const ReferenceColumn&>(*chunk.get_column(ColumnID{0})).pos_list();
+    for (const auto& row_id : pos_list) {
+      if (row_id == NULL_ROW_ID) continue;
+      offsets[row_id.chunk_id].push_back(row_id.chunk_offset);
+    }
+  }
+  return offsets;
+}
+
+bool is_strictly_sorted(const std::vector<ChunkOffset>& offsets) {
+  return std::adjacent_find(offsets.cbegin(), offsets.cend(), std::greater_equal<ChunkOffset>{}) == offsets.cend();
+}
+
+}  // namespace
+
+AbstractPositionsOperator::AbstractPositionsOperator(const std::shared_ptr<const AbstractOperator> left,
+                                                     const std::shared_ptr<const AbstractOperator> right)
+    : AbstractOperator(left, right) {}
+
+std::shared_ptr<const Table> AbstractPositionsOperator::_on_execute() {
+  const auto left = _input_table_left();
+  const auto right = _input_table_right();
+  Assert(left->col_count() == right->col_count(), "Inputs must have the same number of columns!");
+
+  auto output = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < left->col_count(); ++column_id) {
+    output->add_column_definition(left->column_name(column_id), left->column_type(column_id));
+  }
+
+  // an input without chunks with columns, like a table with only column definitions, does not reference anything
+  auto references = get_references(*left);
+  const auto right_references = get_references(*right);
+  if (!references.table) references = right_references;
+  Assert(!right_references.table || (references.table == right_references.table &&
+                                     references.column_ids == right_references.column_ids),
+         "Inputs must reference the same columns of the same table!");
+  if (!references.table) return output;
+
+  const auto chunk_count = references.table->chunk_count();
+  const auto left_offsets = group_offsets(*left, chunk_count);
+  const auto right_offsets = group_offsets(*right, chunk_count);
+
+  std::vector<std::shared_ptr<PosList>> pos_lists(chunk_count);
+  const auto row_count = left->row_count() + right->row_count();
+  const auto thread_count =
+      std::min(static_cast<size_t>(chunk_count), parallel_thread_count(row_count, MIN_ROWS_PER_THREAD));
+  parallel_for_each_range(chunk_count, thread_count, [&](const size_t, const size_t begin, const size_t end) {
+    std::vector<ChunkOffset> offsets;
+    std::vector<uint8_t> left_bitmap;
+    std::vector<uint8_t> right_bitmap;
+
+    for (auto chunk_index = begin; chunk_index < end; ++chunk_index) {
+      const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_index)};
+      const auto& left_chunk_offsets = left_offsets[chunk_index];
+      const auto& right_chunk_offsets = right_offsets[chunk_index];
+      if (left_chunk_offsets.empty() && right_chunk_offsets.empty()) continue;
+
+      offsets.clear();
+      if (is_strictly_sorted(left_chunk_offsets) && is_strictly_sorted(right_chunk_offsets)) {
+        _merge(left_chunk_offsets, right_chunk_offsets, offsets);
+      } else {
+        const auto chunk_size = references.table->get_chunk(chunk_id).size();
+        left_bitmap.assign(chunk_size, 0);
+        right_bitmap.assign(chunk_size, 0);
+        for (const auto chunk_offset : left_chunk_offsets) left_bitmap[chunk_offset] = 1;
+        for (const auto chunk_offset : right_chunk_offsets) right_bitmap[chunk_offset] = 1;
+        _combine_bitmaps(left_bitmap, right_bitmap);
+        for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+          if (left_bitmap[chunk_offset]) offsets.push_back(chunk_offset);
+        }
+      }
+      if (offsets.empty()) continue;
+
+      auto& pos_list = pos_lists[chunk_index];
+      pos_list = std::make_shared<PosList>();
+      pos_list->reserve(offsets.size());
+      for (const auto chunk_offset : offsets) {
+        pos_list->push_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+  });
+
+  const auto emplace_chunk = [&](const std::shared_ptr<const PosList>& pos_list) {
+    auto chunk = Chunk{};
+    for (const auto& column_id : references.column_ids) {
+      chunk.add_column(std::make_shared<ReferenceColumn>(references.table, column_id, pos_list));
+    }
+    output->emplace_chunk(std::move(chunk));
+  };
+  for (const auto& pos_list : pos_lists) {
+    if (pos_list) emplace_chunk(pos_list);
+  }
+  // like for TableScans, an empty output still carries the columns
+  if (output->get_chunk(ChunkID{0}).col_count() == 0) emplace_chunk(std::make_shared<PosList>());
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The super class of operators that combine the rows of two reference tables by their positions, e.g., the outputs of
+// two TableScans on the same table, which allows for OR and other boolean combinations of predicates. Both inputs must
+// reference the same columns of the same table, and the columns of each chunk must share their PosList, like the
+// output of TableScans. The output has the same form: it has one chunk per chunk of the referenced table that holds
+// any of its rows, in the order of their positions, and the columns of an output chunk share one PosList. The inputs
+// are treated as sets of positions, i.e., a position is output at most once. Positions that are NULL_ROW_ID are
+// ignored. Inputs without any chunk with columns, like tables with only column definitions, are treated as empty.
+//
+// The positions of both inputs are grouped by their referenced chunk, and each chunk is combined on its own, in
+// parallel. If the positions of both inputs are sorted, as for TableScans, they are merged. Otherwise, they are
+// combined as bitmaps over the rows of the referenced chunk.
+class AbstractPositionsOperator : public AbstractOperator {
+ public:
+  AbstractPositionsOperator(const std::shared_ptr<const AbstractOperator> left,
+                            const std::shared_ptr<const AbstractOperator> right);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // combines the offsets of both inputs in a chunk, which are sorted and unique, into sorted and unique offsets
+  virtual void _merge(const std::vector<ChunkOffset>& left_offsets, const std::vector<ChunkOffset>& right_offsets,
+                      std::vector<ChunkOffset>& offsets) const = 0;
+
+  // combines the bitmaps of both inputs in a chunk into the left one
+  virtual void _combine_bitmaps(std::vector<uint8_t>& left_bitmap, const std::vector<uint8_t>& right_bitmap) const = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,176 @@
+#include "abstract_scan_operator.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "storage/column_iteration.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+bool BaseColumnScanImpl::can_prune_by_bloom_filter(const Chunk&, const ColumnID) const { return false; }
+
+bool BaseColumnScanImpl::scan_chunk_with_index(const Chunk&, const ColumnID, std::vector<ChunkOffset>&) const {
+  return false;
+}
+
+void BaseColumnScanImpl::scan_chunk(const Chunk& chunk, const ColumnID column_id,
+                                    const std::vector<ChunkOffset>* selection,
+                                    std::vector<ChunkOffset>& matches) const {
+  const auto column = chunk.get_column(column_id);
+  const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
+  if (!reference_column) {
+    scan_column(*column, selection, matches);
+    return;
+  }
+
+  const auto& referenced_table = *reference_column->referenced_table();
+  const auto referenced_column_id = reference_column->referenced_column_id();
+  std::vector<ChunkOffset> referenced_matches;
+
+  for_each_reference_run(*reference_column, selection, [&](const size_t run_begin, const ChunkID chunk_id,
+                                                           const std::vector<ChunkOffset>& referenced_offsets) {
+    const auto& referenced_chunk = referenced_table.get_chunk(chunk_id);
+    if (can_prune_by_zone_map(referenced_chunk, referenced_column_id) ||
+        can_prune_by_bloom_filter(referenced_chunk, referenced_column_id)) {
+      return;
+    }
+
+    const auto referenced_column = referenced_chunk.get_column(referenced_column_id);
+    Assert(!std::dynamic_pointer_cast<const ReferenceColumn>(referenced_column),
+           "ReferenceColumns must not reference other ReferenceColumns");
+
+    referenced_matches.clear();
+    _scan_referenced_column(chunk_id, *referenced_column, referenced_offsets, referenced_matches);
+    for (const auto match : referenced_matches) matches.push_back(static_cast<ChunkOffset>(run_begin + match));
+  });
+}
+
+void BaseColumnScanImpl::_scan_referenced_column(const ChunkID, const BaseColumn& column,
+                                                 const std::vector<ChunkOffset>& referenced_offsets,
+                                                 std::vector<ChunkOffset>& matches) const {
+  scan_column(column, &referenced_offsets, matches);
+}
+
+AbstractScanOperator::AbstractScanOperator(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id)
+    : AbstractScanOperator(in, std::vector<ColumnID>{column_id}) {}
+
+AbstractScanOperator::AbstractScanOperator(const std::shared_ptr<const AbstractOperator> in,
+                                           const std::vector<ColumnID>& column_ids)
+    : AbstractOperator(in), _column_ids{column_ids} {
+  Assert(!_column_ids.empty(), "Scans need at least one predicate!");
+}
+
+ColumnID AbstractScanOperator::column_id() const { return _column_ids.front(); }
+
+size_t AbstractScanOperator::pruned_chunk_count() const { return _pruned_chunk_count; }
+
+size_t AbstractScanOperator::bloom_filter_pruned_chunk_count() const { return _bloom_filter_pruned_chunk_count; }
+
+size_t AbstractScanOperator::index_scanned_chunk_count() const { return _index_scanned_chunk_count; }
+
+std::shared_ptr<const Table> AbstractScanOperator::_on_execute() {
+  const auto table_in = _input_table_left();
+  _pruned_chunk_count = 0;
+  _bloom_filter_pruned_chunk_count = 0;
+  _index_scanned_chunk_count = 0;
+
+  std::vector<std::unique_ptr<BaseColumnScanImpl>> impls;
+  for (size_t predicate_index = 0; predicate_index < _column_ids.size(); ++predicate_index) {
+    Assert(_column_ids[predicate_index] < table_in->col_count(), "Column ID out of range!");
+    impls.push_back(_create_impl(*table_in, predicate_index));
+  }
+
+  // The share of rows that each predicate let pass so far, estimated as (matches + 1) / (scanned rows + 2), so that
+  // predicates that were never evaluated count as letting half of the rows pass.
+  std::vector<std::pair<size_t, size_t>> match_statistics(_column_ids.size());
+  const auto pass_rate = [&](const size_t predicate_index) {
+    const auto& [scanned_row_count, match_count] = match_statistics[predicate_index];
+    return static_cast<double>(match_count + 1) / static_cast<double>(scanned_row_count + 2);
+  };
+  _predicate_order.resize(_column_ids.size());
+  std::iota(_predicate_order.begin(), _predicate_order.end(), size_t{0});
+
+  auto table_out = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < table_in->col_count(); ++column_id) {
+    table_out->add_column_definition(table_in->column_name(column_id), table_in->column_type(column_id));
+  }
+
+  std::vector<ChunkOffset> matches;
+  std::vector<ChunkOffset> selection;
+  auto has_matches = false;
+
+  for (ChunkID chunk_id{0}; chunk_id < table_in->chunk_count(); ++chunk_id) {
+    const auto& chunk = table_in->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    if (std::any_of(_predicate_order.cbegin(), _predicate_order.cend(), [&](const size_t index) {
+          return impls[index]->can_prune_by_zone_map(chunk, _column_ids[index]);
+        })) {
+      ++_pruned_chunk_count;
+      continue;
+    }
+    if (std::any_of(_predicate_order.cbegin(), _predicate_order.cend(), [&](const size_t index) {
+          return impls[index]->can_prune_by_bloom_filter(chunk, _column_ids[index]);
+        })) {
+      ++_bloom_filter_pruned_chunk_count;
+      continue;
+    }
+
+    // The first predicate, in order, that can use an index is evaluated first. Otherwise, the first predicate is
+    // evaluated on the whole chunk.
+    matches.clear();
+    auto first_predicate = std::find_if(_predicate_order.cbegin(), _predicate_order.cend(), [&](const size_t index) {
+      return impls[index]->scan_chunk_with_index(chunk, _column_ids[index], matches);
+    });
+    if (first_predicate != _predicate_order.cend()) {
+      ++_index_scanned_chunk_count;
+    } else {
+      first_predicate = _predicate_order.cbegin();
+      impls[*first_predicate]->scan_chunk(chunk, _column_ids[*first_predicate], nullptr, matches);
+    }
+    match_statistics[*first_predicate].first += chunk.size();
+    match_statistics[*first_predicate].second += matches.size();
+
+    for (const auto predicate_index : _predicate_order) {
+      if (matches.empty()) break;
+      if (predicate_index == *first_predicate) continue;
+
+      selection.swap(matches);
+      matches.clear();
+      impls[predicate_index]->scan_chunk(chunk, _column_ids[predicate_index], &selection, matches);
+      match_statistics[predicate_index].first += selection.size();
+      match_statistics[predicate_index].second += matches.size();
+      for (auto& match : matches) match = selection[match];
+    }
+
+    std::stable_sort(_predicate_order.begin(), _predicate_order.end(),
+                     [&](const size_t left, const size_t right) { return pass_rate(left) < pass_rate(right); });
+    if (matches.empty()) continue;
+
+    auto pos_list = std::make_shared<PosList>();
+    pos_list->reserve(matches.size());
+    for (const auto match : matches) pos_list->push_back(RowID{chunk_id, match});
+
+    auto chunk_out = Chunk{};
+    add_reference_columns(chunk_out, table_in, chunk_id, pos_list);
+    table_out->emplace_chunk(std::move(chunk_out));
+    has_matches = true;
+  }
+
+  // even an empty result has to carry the columns, so that it can be used as input to further operators
+  if (!has_matches) {
+    auto chunk_out = Chunk{};
+    add_reference_columns(chunk_out, table_in, std::make_shared<PosList>());
+    table_out->emplace_chunk(std::move(chunk_out));
+  }
+
+  return table_out;
+}
+
+}  // namespace opossum
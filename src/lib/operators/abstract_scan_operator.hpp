@@ -0,0 +1,99 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Chunk;
+
+// The typed part of a scan by a predicate on a single column, see AbstractScanOperator
+class BaseColumnScanImpl {
+ public:
+  virtual ~BaseColumnScanImpl() = default;
+
+  // returns true if the zone map of the column in the chunk shows that no row can satisfy the predicate
+  virtual bool can_prune_by_zone_map(const Chunk& chunk, const ColumnID column_id) const = 0;
+
+  // returns true if the Bloom filter of the column in the chunk shows that no row can satisfy the predicate
+  virtual bool can_prune_by_bloom_filter(const Chunk& chunk, const ColumnID column_id) const;
+
+  // If the chunk has an index on the column and the predicate is selective enough, appends the offsets of all matching
+  // rows to matches (in ascending order) and returns true. Otherwise, returns false and leaves matches as is.
+  virtual bool scan_chunk_with_index(const Chunk& chunk, const ColumnID column_id,
+                                     std::vector<ChunkOffset>& matches) const;
+
+  // Appends the offsets of all rows of a non-reference column that satisfy the predicate to matches. With a
+  // selection, only the selected rows are scanned, and the positions of the matching ones within the selection are
+  // appended instead.
+  virtual void scan_column(const BaseColumn& column, const std::vector<ChunkOffset>* selection,
+                           std::vector<ChunkOffset>& matches) const = 0;
+
+  // Same as scan_column for the column in the chunk. ReferenceColumns are scanned run by run of positions into the
+  // same referenced chunk (see for_each_reference_run), skipping NULL rows and runs into chunks that can be pruned.
+  void scan_chunk(const Chunk& chunk, const ColumnID column_id, const std::vector<ChunkOffset>* selection,
+                  std::vector<ChunkOffset>& matches) const;
+
+ protected:
+  // scans the referenced_offsets of a run into the chunk chunk_id of the referenced table, see scan_column. Can be
+  // overridden to reuse work between runs into the same chunk.
+  virtual void _scan_referenced_column(const ChunkID chunk_id, const BaseColumn& column,
+                                       const std::vector<ChunkOffset>& referenced_offsets,
+                                       std::vector<ChunkOffset>& matches) const;
+};
+
+// The super class of operators that filter a table by a conjunction of predicates on its columns, like TableScan and
+// BetweenScan. The output consists of ReferenceColumns that point into the original (non-reference) table, with one
+// chunk per input chunk that holds any matches. All columns of an output chunk share the same PosList. Chunks whose
+// zone map or Bloom filter rules out any match for any predicate are skipped without being scanned. If a chunk has an
+// index on a scanned column and the index shows that only few rows match, the matching positions are taken from the
+// index instead of scanning the column. Sub classes only provide the typed scans of the columns (see
+// BaseColumnScanImpl).
+//
+// Multiple predicates are evaluated in a single pass over each chunk: the first predicate is evaluated on the whole
+// chunk, all others only on the rows that matched so far (the selection vector), so that no intermediate tables are
+// created. The predicates are reordered after each chunk, so that the ones that filtered out the most rows so far are
+// evaluated first.
+class AbstractScanOperator : public AbstractOperator {
+ public:
+  AbstractScanOperator(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id);
+
+  // scans the columns in the order of column_ids, which may contain a column more than once
+  AbstractScanOperator(const std::shared_ptr<const AbstractOperator> in, const std::vector<ColumnID>& column_ids);
+
+  // the column of the first predicate
+  ColumnID column_id() const;
+
+  // returns the number of input chunks that the last execution skipped because of their zone maps
+  size_t pruned_chunk_count() const;
+
+  // returns the number of input chunks that the last execution skipped because of their Bloom filters. Chunks that
+  // were already skipped because of their zone maps are not counted.
+  size_t bloom_filter_pruned_chunk_count() const;
+
+  // returns the number of input chunks that the last execution scanned using an index
+  size_t index_scanned_chunk_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // creates the scan of the predicate on the column _column_ids[predicate_index], which is called once per execution
+  virtual std::unique_ptr<BaseColumnScanImpl> _create_impl(const Table& table_in,
+                                                           const size_t predicate_index) const = 0;
+
+  const std::vector<ColumnID> _column_ids;
+
+  // the order in which the predicates were evaluated for the last chunk of the last execution, as indices into
+  // _column_ids
+  std::vector<size_t> _predicate_order;
+
+  size_t _pruned_chunk_count = 0;
+  size_t _bloom_filter_pruned_chunk_count = 0;
+  size_t _index_scanned_chunk_count = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,529 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/column_iteration.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr size_t MIN_ROWS_PER_THREAD = 10'000;
+constexpr size_t MIN_GROUPS_PER_THREAD = 1'000;
+
+// the group ID of rows that belong to no group, because one of their groupby values is NULL
+constexpr uint32_t NO_GROUP = std::numeric_limits<uint32_t>::max();
+
+// The partial results of one aggregate for a number of groups, i.e., the groups of a chunk or the merged groups
+class BaseAggregator {
+ public:
+  virtual ~BaseAggregator() = default;
+
+  // creates an aggregator for the same column type and function without any groups
+  virtual std::unique_ptr<BaseAggregator> create_empty() const = 0;
+
+  virtual void resize(const size_t group_count) = 0;
+
+  // adds the values of a column to their groups, where group_ids holds the group of each row
+  virtual void aggregate(const BaseColumn& column, const std::vector<uint32_t>& group_ids) = 0;
+
+  // adds the partial result of the group other_group_id of another aggregator to the group group_id
+  virtual void merge(const BaseAggregator& other, const size_t other_group_id, const size_t group_id) = 0;
+
+  virtual AllTypeVariant result(const size_t group_id) const = 0;
+};
+
+// The aggregates are computed on the encoded values where possible. Each (group, value) pair is passed to _add once,
+// with the number of rows it occurs in:
+//  - DictionaryColumns: COUNT does not look at the values. MIN and MAX compare ValueIDs, which are ordered like the
+//    values, and look up one value per group. SUM, AVG, and COUNT DISTINCT count the rows per group and ValueID in a
+//    histogram if it is not larger than the chunk, and only look up the values of the histogram.
+//  - RunLengthColumns: each run is added once per group it spans, e.g., a single time without groupby columns.
+//  - FrameOfReferenceColumns: MIN takes the block minimum of blocks that belong to a single group. Otherwise, the
+//    values are unpacked block-wise.
+//  - ValueColumns and ReferenceColumns are materialized row by row.
+template <typename T>
+class Aggregator : public BaseAggregator {
+ public:
+  using SumType = std::conditional_t<std::is_integral<T>::value, int64_t, double>;
+
+  explicit Aggregator(const AggregateFunction function) : _function{function} {}
+
+  std::unique_ptr<BaseAggregator> create_empty() const override { return std::make_unique<Aggregator<T>>(_function); }
+
+  void resize(const size_t group_count) override {
+    _counts.resize(group_count);
+    if (_function == AggregateFunction::Sum || _function == AggregateFunction::Avg) _sums.resize(group_count);
+    if (_function == AggregateFunction::Min || _function == AggregateFunction::Max) _extremes.resize(group_count);
+    if (_function == AggregateFunction::CountDistinct) _distinct_values.resize(group_count);
+  }
+
+  void aggregate(const BaseColumn& column, const std::vector<uint32_t>& group_ids) override {
+    // the function is resolved once per column, so that the loops only do the necessary work
+    switch (_function) {
+      case AggregateFunction::Count:
+        _aggregate<AggregateFunction::Count>(column, group_ids);
+        break;
+      case AggregateFunction::CountDistinct:
+        _aggregate<AggregateFunction::CountDistinct>(column, group_ids);
+        break;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        // both keep the count and sum of each group
+        _aggregate<AggregateFunction::Sum>(column, group_ids);
+        break;
+      case AggregateFunction::Min:
+        _aggregate<AggregateFunction::Min>(column, group_ids);
+        break;
+      case AggregateFunction::Max:
+        _aggregate<AggregateFunction::Max>(column, group_ids);
+        break;
+    }
+  }
+
+  void merge(const BaseAggregator& base_other, const size_t other_group_id, const size_t group_id) override {
+    const auto& other = static_cast<const Aggregator<T>&>(base_other);
+    const auto other_count = other._counts[other_group_id];
+    if (other_count == 0) return;
+
+    if (_function == AggregateFunction::Sum || _function == AggregateFunction::Avg) {
+      _sums[group_id] += other._sums[other_group_id];
+    } else if (_function == AggregateFunction::Min || _function == AggregateFunction::Max) {
+      const auto& other_extreme = other._extremes[other_group_id];
+      const auto is_new_extreme = _function == AggregateFunction::Min ? other_extreme < _extremes[group_id]
+                                                                      : _extremes[group_id] < other_extreme;
+      if (_counts[group_id] == 0 || is_new_extreme) _extremes[group_id] = other_extreme;
+    } else if (_function == AggregateFunction::CountDistinct) {
+      const auto& other_values = other._distinct_values[other_group_id];
+      _distinct_values[group_id].insert(other_values.cbegin(), other_values.cend());
+    }
+    _counts[group_id] += other_count;
+  }
+
+  AllTypeVariant result(const size_t group_id) const override {
+    switch (_function) {
+      case AggregateFunction::Count:
+        return _counts[group_id];
+      case AggregateFunction::CountDistinct:
+        return static_cast<int64_t>(_distinct_values[group_id].size());
+      case AggregateFunction::Sum:
+        return _sums[group_id];
+      case AggregateFunction::Avg:
+        return _counts[group_id] == 0 ? 0.0 : static_cast<double>(_sums[group_id]) / _counts[group_id];
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        return _extremes[group_id];
+    }
+    Fail("Unknown aggregate function");
+    return {};
+  }
+
+ protected:
+  template <AggregateFunction function>
+  void _aggregate(const BaseColumn& column, const std::vector<uint32_t>& group_ids) {
+    // only the NULL rows of ReferenceColumns are not counted
+    if constexpr (function == AggregateFunction::Count) {
+      if (!dynamic_cast<const ReferenceColumn*>(&column)) {
+        for (const auto group_id : group_ids) {
+          if (group_id != NO_GROUP) ++_counts[group_id];
+        }
+        return;
+      }
+    }
+
+    if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+      _aggregate_dictionary_column<function>(*dictionary_column, group_ids);
+      return;
+    }
+    if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+      _aggregate_run_length_column<function>(*run_length_column, group_ids);
+      return;
+    }
+    if constexpr (std::is_integral<T>::value) {
+      if (const auto frame_of_reference_column = dynamic_cast<const FrameOfReferenceColumn<T>*>(&column)) {
+        _aggregate_frame_of_reference_column<function>(*frame_of_reference_column, group_ids);
+        return;
+      }
+    }
+
+    for_each_value<T>(column, [&](const ChunkOffset chunk_offset, const ValueView<T>& value) {
+      const auto group_id = group_ids[chunk_offset];
+      if (group_id != NO_GROUP) _add<function>(group_id, value, 1);
+    });
+  }
+
+  template <AggregateFunction function>
+  void _aggregate_dictionary_column(const DictionaryColumn<T>& column, const std::vector<uint32_t>& group_ids) {
+    const auto& dictionary = *column.dictionary();
+    const auto& attribute_vector = *column.attribute_vector();
+    const auto chunk_size = attribute_vector.size();
+    const auto group_count = _counts.size();
+
+    if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+      std::vector<ValueID> extreme_value_ids(group_count, INVALID_VALUE_ID);
+      std::vector<size_t> row_counts(group_count);
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+        const auto group_id = group_ids[chunk_offset];
+        if (group_id == NO_GROUP) continue;
+
+        const auto value_id = attribute_vector.get(chunk_offset);
+        auto& extreme_value_id = extreme_value_ids[group_id];
+        if (row_counts[group_id]++ == 0 ||
+            (function == AggregateFunction::Min ? value_id < extreme_value_id : extreme_value_id < value_id)) {
+          extreme_value_id = value_id;
+        }
+      }
+
+      for (size_t group_id = 0; group_id < group_count; ++group_id) {
+        if (row_counts[group_id] == 0) continue;
+        _add<function>(group_id, dictionary[extreme_value_ids[group_id]], row_counts[group_id]);
+      }
+      return;
+    }
+
+    const auto unique_values_count = dictionary.size();
+    if (group_count * unique_values_count <= chunk_size) {
+      std::vector<ChunkOffset> histogram(group_count * unique_values_count);
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+        const auto group_id = group_ids[chunk_offset];
+        if (group_id != NO_GROUP) ++histogram[group_id * unique_values_count + attribute_vector.get(chunk_offset)];
+      }
+
+      for (size_t group_id = 0; group_id < group_count; ++group_id) {
+        for (ValueID value_id{0}; value_id < unique_values_count; ++value_id) {
+          const auto row_count = histogram[group_id * unique_values_count + value_id];
+          if (row_count > 0) _add<function>(group_id, dictionary[value_id], row_count);
+        }
+      }
+      return;
+    }
+
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto group_id = group_ids[chunk_offset];
+      if (group_id != NO_GROUP) _add<function>(group_id, dictionary[attribute_vector.get(chunk_offset)], 1);
+    }
+  }
+
+  template <AggregateFunction function>
+  void _aggregate_run_length_column(const RunLengthColumn<T>& column, const std::vector<uint32_t>& group_ids) {
+    const auto& values = *column.values();
+    const auto& end_positions = *column.end_positions();
+
+    // each run is split into the ranges of rows with the same group
+    ChunkOffset range_begin = 0;
+    for (size_t run_index = 0; run_index < values.size(); ++run_index) {
+      const ValueView<T> value = values[run_index];
+      const auto run_end = end_positions[run_index] + 1;
+      while (range_begin < run_end) {
+        const auto group_id = group_ids[range_begin];
+        auto range_end = range_begin + 1;
+        while (range_end < run_end && group_ids[range_end] == group_id) ++range_end;
+        if (group_id != NO_GROUP) _add<function>(group_id, value, range_end - range_begin);
+        range_begin = range_end;
+      }
+    }
+  }
+
+  template <AggregateFunction function>
+  void _aggregate_frame_of_reference_column(const FrameOfReferenceColumn<T>& column,
+                                            const std::vector<uint32_t>& group_ids) {
+    const auto chunk_size = column.size();
+    const auto& block_minimums = *column.block_minimums();
+    using Block = FrameOfReferenceColumn<T>;
+
+    std::vector<T> values(std::min(static_cast<size_t>(Block::BLOCK_SIZE), chunk_size));
+    for (size_t block_begin = 0, block_index = 0; block_begin < chunk_size;
+         block_begin += Block::BLOCK_SIZE, ++block_index) {
+      const auto block_size = std::min(static_cast<size_t>(Block::BLOCK_SIZE), chunk_size - block_begin);
+      const auto block_group_ids = group_ids.cbegin() + block_begin;
+
+      if constexpr (function == AggregateFunction::Min) {
+        const auto group_id = block_group_ids[0];
+        if (std::all_of(block_group_ids, block_group_ids + block_size,
+                        [&](const uint32_t other_group_id) { return other_group_id == group_id; })) {
+          if (group_id != NO_GROUP) _add<function>(group_id, block_minimums[block_index], block_size);
+          continue;
+        }
+      }
+
+      column.unpack(block_begin, block_size, values.data());
+      for (size_t index = 0; index < block_size; ++index) {
+        const auto group_id = block_group_ids[index];
+        if (group_id != NO_GROUP) _add<function>(group_id, values[index], 1);
+      }
+    }
+  }
+
+  // adds a value that occurs in row_count rows of a group
+  template <AggregateFunction function>
+  void _add(const size_t group_id, const ValueView<T>& value, const size_t row_count) {
+    const auto is_first_value = _counts[group_id] == 0;
+    _counts[group_id] += row_count;
+
+    if constexpr (function == AggregateFunction::Sum) {
+      if constexpr (std::is_arithmetic<T>::value) {
+        _sums[group_id] += static_cast<SumType>(value) * static_cast<SumType>(row_count);
+      }
+    } else if constexpr (function == AggregateFunction::Min) {
+      if (is_first_value || value < _extremes[group_id]) _extremes[group_id] = T(value);
+    } else if constexpr (function == AggregateFunction::Max) {
+      if (is_first_value || _extremes[group_id] < value) _extremes[group_id] = T(value);
+    } else if constexpr (function == AggregateFunction::CountDistinct) {
+      _distinct_values[group_id].emplace(value);
+    }
+  }
+
+  const AggregateFunction _function;
+  std::vector<int64_t> _counts;
+  std::vector<SumType> _sums;
+  std::vector<T> _extremes;
+  std::vector<std::unordered_set<T>> _distinct_values;
+};
+
+// Appends a value of a groupby column to the key of a group. Keys are only compared for equality, so the values are
+// appended as their bytes, strings prefixed with their length.
+template <typename T>
+void append_key_part(std::string& key, const AllTypeVariant& variant) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    const auto& value = get<std::string>(variant);
+    const auto length = static_cast<uint32_t>(value.size());
+    key.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    key.append(value);
+  } else {
+    auto value = get<T>(variant);
+    // 0.0 and -0.0 are equal, but their bytes are not
+    if constexpr (std::is_floating_point<T>::value) {
+      if (value == 0) value = 0;
+    }
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+}
+
+// The groups of one chunk and the partial aggregates of its groups
+struct ChunkGroups {
+  std::vector<std::string> keys;
+  std::vector<std::vector<AllTypeVariant>> values;
+  std::vector<std::unique_ptr<BaseAggregator>> aggregators;
+};
+
+// Maps each row of a groupby column to a dense ID in [0, id_count), or to NO_GROUP if the row is NULL
+template <typename T>
+size_t map_to_dense_ids(const BaseColumn& column, std::vector<uint32_t>& ids) {
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    const auto& attribute_vector = *dictionary_column->attribute_vector();
+    for (ChunkOffset chunk_offset = 0; chunk_offset < attribute_vector.size(); ++chunk_offset) {
+      ids[chunk_offset] = attribute_vector.get(chunk_offset);
+    }
+    return dictionary_column->unique_values_count();
+  }
+
+  std::unordered_map<ValueView<T>, uint32_t> value_ids;
+  std::fill(ids.begin(), ids.end(), NO_GROUP);
+  for_each_value<T>(column, [&](const ChunkOffset chunk_offset, const ValueView<T>& value) {
+    ids[chunk_offset] = value_ids.emplace(value, static_cast<uint32_t>(value_ids.size())).first->second;
+  });
+  return value_ids.size();
+}
+
+}  // namespace
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator> in,
+                     const std::vector<AggregateDefinition>& aggregates,
+                     const std::vector<ColumnID>& groupby_column_ids)
+    : AbstractOperator(in), _aggregates{aggregates}, _groupby_column_ids{groupby_column_ids} {}
+
+const std::vector<AggregateDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& Aggregate::groupby_column_ids() const { return _groupby_column_ids; }
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto input = _input_table_left();
+
+  // the output columns and an empty aggregator for each aggregate
+  auto output = std::make_shared<Table>();
+  using AppendKeyPart = void (*)(std::string&, const AllTypeVariant&);
+  std::vector<AppendKeyPart> append_key_parts;
+  for (const auto& column_id : _groupby_column_ids) {
+    Assert(column_id < input->col_count(), "Groupby column ID out of range!");
+    output->add_column(input->column_name(column_id), input->column_type(column_id));
+    resolve_data_type(input->column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      append_key_parts.push_back(&append_key_part<Type>);
+    });
+  }
+
+  std::vector<std::unique_ptr<BaseAggregator>> empty_aggregators;
+  for (const auto& aggregate : _aggregates) {
+    Assert(aggregate.column_id < input->col_count(), "Aggregate column ID out of range!");
+    const auto& column_type = input->column_type(aggregate.column_id);
+    const auto& column_name = input->column_name(aggregate.column_id);
+
+    switch (aggregate.function) {
+      case AggregateFunction::Count:
+        output->add_column("COUNT(" + column_name + ")", "long");
+        break;
+      case AggregateFunction::CountDistinct:
+        output->add_column("COUNT(DISTINCT " + column_name + ")", "long");
+        break;
+      case AggregateFunction::Sum:
+        Assert(column_type != "string", "Cannot sum up strings!");
+        output->add_column("SUM(" + column_name + ")",
+                           column_type == "int" || column_type == "long" ? "long" : "double");
+        break;
+      case AggregateFunction::Avg:
+        Assert(column_type != "string", "Cannot average strings!");
+        output->add_column("AVG(" + column_name + ")", "double");
+        break;
+      case AggregateFunction::Min:
+        output->add_column("MIN(" + column_name + ")", column_type);
+        break;
+      case AggregateFunction::Max:
+        output->add_column("MAX(" + column_name + ")", column_type);
+        break;
+    }
+
+    resolve_data_type(column_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+      empty_aggregators.push_back(std::make_unique<Aggregator<Type>>(aggregate.function));
+    });
+  }
+
+  // Phase 1: aggregate each chunk on its own
+  const auto chunk_count = static_cast<size_t>(input->chunk_count());
+  std::vector<ChunkGroups> chunk_groups(chunk_count);
+  const auto chunk_thread_count = std::min(chunk_count, parallel_thread_count(input->row_count(), MIN_ROWS_PER_THREAD));
+  parallel_for_each_range(chunk_count, chunk_thread_count, [&](const size_t, const size_t begin, const size_t end) {
+    std::vector<uint32_t> column_ids;
+    std::vector<uint32_t> combined_ids;
+    std::unordered_map<uint64_t, uint32_t> sparse_combined_ids;
+
+    for (auto chunk_index = begin; chunk_index < end; ++chunk_index) {
+      const auto& chunk = input->get_chunk(ChunkID{static_cast<ChunkID::base_type>(chunk_index)});
+      const auto chunk_size = chunk.size();
+      auto& groups = chunk_groups[chunk_index];
+
+      // Without groupby columns, all rows form a single group. Each groupby column splits the groups further: the
+      // current group ID and the dense ID of the column's value are combined into a new dense group ID. Small
+      // combinations are looked up in an array, others in a hash map.
+      std::vector<uint32_t> group_ids(chunk_size, 0);
+      std::vector<ChunkOffset> first_offsets{0};
+      size_t group_count = 1;
+      column_ids.resize(chunk_size);
+
+      for (const auto& column_id : _groupby_column_ids) {
+        size_t id_count = 0;
+        resolve_data_type(input->column_type(column_id), [&](auto type) {
+          using Type = typename decltype(type)::type;
+          id_count = map_to_dense_ids<Type>(*chunk.get_column(column_id), column_ids);
+        });
+
+        const auto combination_count = group_count * id_count;
+        const auto is_dense = combination_count <= chunk_size;
+        if (is_dense) combined_ids.assign(combination_count, NO_GROUP);
+        sparse_combined_ids.clear();
+
+        size_t new_group_count = 0;
+        first_offsets.clear();
+        for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+          auto& group_id = group_ids[chunk_offset];
+          if (group_id == NO_GROUP || column_ids[chunk_offset] == NO_GROUP) {
+            group_id = NO_GROUP;
+            continue;
+          }
+
+          const auto combination = static_cast<uint64_t>(group_id) * id_count + column_ids[chunk_offset];
+          auto& new_group_id = is_dense ? combined_ids[combination]
+                                        : sparse_combined_ids.emplace(combination, NO_GROUP).first->second;
+          if (new_group_id == NO_GROUP) {
+            new_group_id = static_cast<uint32_t>(new_group_count++);
+            first_offsets.push_back(chunk_offset);
+          }
+          group_id = new_group_id;
+        }
+        group_count = new_group_count;
+      }
+
+      // the key and values of each group are taken from its first row
+      groups.keys.resize(group_count);
+      groups.values.resize(group_count);
+      for (size_t group_id = 0; group_id < group_count; ++group_id) {
+        for (size_t index = 0; index < _groupby_column_ids.size(); ++index) {
+          const auto value = (*chunk.get_column(_groupby_column_ids[index]))[first_offsets[group_id]];
+          append_key_parts[index](groups.keys[group_id], value);
+          groups.values[group_id].push_back(value);
+        }
+      }
+
+      for (size_t aggregate_index = 0; aggregate_index < _aggregates.size(); ++aggregate_index) {
+        auto aggregator = empty_aggregators[aggregate_index]->create_empty();
+        aggregator->resize(group_count);
+        if (chunk_size > 0) aggregator->aggregate(*chunk.get_column(_aggregates[aggregate_index].column_id), group_ids);
+        groups.aggregators.push_back(std::move(aggregator));
+      }
+    }
+  });
+
+  // Phase 2: merge the groups of all chunks. Each thread merges the groups whose keys hash to it.
+  size_t chunk_group_count = 0;
+  for (const auto& groups : chunk_groups) chunk_group_count += groups.keys.size();
+  const auto merge_thread_count = parallel_thread_count(chunk_group_count, MIN_GROUPS_PER_THREAD);
+
+  std::vector<std::vector<std::vector<AllTypeVariant>>> thread_rows(merge_thread_count);
+  parallel_for_each_range(merge_thread_count, merge_thread_count, [&](const size_t thread, const size_t,
+                                                                      const size_t) {
+    std::unordered_map<std::string, size_t> group_ids;
+    std::vector<std::vector<AllTypeVariant>> group_values;
+    std::vector<std::unique_ptr<BaseAggregator>> aggregators;
+    for (const auto& aggregator : empty_aggregators) aggregators.push_back(aggregator->create_empty());
+
+    for (const auto& groups : chunk_groups) {
+      for (size_t chunk_group_id = 0; chunk_group_id < groups.keys.size(); ++chunk_group_id) {
+        const auto& key = groups.keys[chunk_group_id];
+        if (merge_thread_count > 1 && std::hash<std::string>{}(key) % merge_thread_count != thread) continue;
+
+        const auto [group_it, is_new_group] = group_ids.emplace(key, group_values.size());
+        if (is_new_group) {
+          group_values.push_back(groups.values[chunk_group_id]);
+          for (auto& aggregator : aggregators) aggregator->resize(group_values.size());
+        }
+
+        for (size_t aggregate_index = 0; aggregate_index < aggregators.size(); ++aggregate_index) {
+          aggregators[aggregate_index]->merge(*groups.aggregators[aggregate_index], chunk_group_id, group_it->second);
+        }
+      }
+    }
+
+    for (size_t group_id = 0; group_id < group_values.size(); ++group_id) {
+      auto row = std::move(group_values[group_id]);
+      for (const auto& aggregator : aggregators) row.push_back(aggregator->result(group_id));
+      thread_rows[thread].push_back(std::move(row));
+    }
+  });
+
+  for (auto& rows : thread_rows) {
+    for (auto& row : rows) output->append(std::move(row));
+  }
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// COUNT counts the values of a column, COUNT DISTINCT its different values, both are longs. SUM and AVG are only
+// defined for numeric columns. Sums of int and long columns are longs, sums of float and double columns are doubles.
+// AVG is a double, MIN and MAX keep the column type.
+enum class AggregateFunction { Count, CountDistinct, Sum, Min, Max, Avg };
+
+struct AggregateDefinition {
+  ColumnID column_id;
+  AggregateFunction function;
+};
+
+// Operator that groups the rows of its input by the values of the groupby columns and computes the aggregates for each
+// group. The output table holds the groupby columns followed by one column per aggregate, named like "SUM(a)", in no
+// particular order of the groups. Without groupby columns, the output is a single row, even for empty inputs.
+//
+// First, each chunk is aggregated on its own, in parallel: its rows are mapped to dense group IDs, column by column.
+// For DictionaryColumns, the ValueIDs of the attribute vector already are dense IDs, so their values are not looked at.
+// Other columns map their values to IDs with a hash map. The aggregates of the chunk are computed on the encoded
+// values where possible, e.g., SUM multiplies each dictionary value by its number of rows. Then, the groups of all
+// chunks are merged, again in parallel, where each thread handles the groups whose key hashes to it.
+//
+// As there are no NULL values in the output, rows with a NULL value (see NULL_ROW_ID) in any groupby column are left
+// out, and NULL values in aggregated columns are not counted.
+class Aggregate : public AbstractOperator {
+ public:
+  Aggregate(const std::shared_ptr<const AbstractOperator> in, const std::vector<AggregateDefinition>& aggregates,
+            const std::vector<ColumnID>& groupby_column_ids);
+
+  const std::vector<AggregateDefinition>& aggregates() const;
+  const std::vector<ColumnID>& groupby_column_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<AggregateDefinition> _aggregates;
+  const std::vector<ColumnID> _groupby_column_ids;
+};
+
+}  // namespace opossum
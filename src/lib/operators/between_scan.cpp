@@ -0,0 +1,153 @@
+#include "between_scan.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/attribute_vector_scan.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/column_iteration.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "storage/zone_map.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Calls func with the two comparators that check "lower_bound <cmp> value" and "value <cmp> upper_bound", so that the
+// scan loops are instantiated once per combination of inclusive and exclusive bounds.
+template <typename Functor>
+void with_bound_comparators(const bool lower_bound_inclusive, const bool upper_bound_inclusive, const Functor& func) {
+  if (lower_bound_inclusive) {
+    if (upper_bound_inclusive) return func(std::less_equal<>{}, std::less_equal<>{});
+    return func(std::less_equal<>{}, std::less<>{});
+  }
+  if (upper_bound_inclusive) return func(std::less<>{}, std::less_equal<>{});
+  func(std::less<>{}, std::less<>{});
+}
+
+template <typename T>
+class BetweenScanImpl : public BaseColumnScanImpl {
+ public:
+  BetweenScanImpl(const AllTypeVariant& lower_bound, const AllTypeVariant& upper_bound,
+                  const bool lower_bound_inclusive, const bool upper_bound_inclusive)
+      : _lower_bound{type_cast<T>(lower_bound)},
+        _upper_bound{type_cast<T>(upper_bound)},
+        _lower_bound_inclusive{lower_bound_inclusive},
+        _upper_bound_inclusive{upper_bound_inclusive} {}
+
+  bool can_prune_by_zone_map(const Chunk& chunk, const ColumnID column_id) const override {
+    const auto zone_map = std::dynamic_pointer_cast<const ZoneMap<T>>(chunk.zone_map(column_id));
+    if (!zone_map) return false;
+    return zone_map->can_prune(_lower_bound_inclusive ? ScanType::OpGreaterThanEquals : ScanType::OpGreaterThan,
+                               _lower_bound) ||
+           zone_map->can_prune(_upper_bound_inclusive ? ScanType::OpLessThanEquals : ScanType::OpLessThan,
+                               _upper_bound);
+  }
+
+  void scan_column(const BaseColumn& column, const std::vector<ChunkOffset>* selection,
+                   std::vector<ChunkOffset>& matches) const override {
+    if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+      _scan_dictionary_column(*dictionary_column, selection, matches);
+      return;
+    }
+
+    // Strings in ValueColumns are compared in the StringStorage, which decides most comparisons by the inline prefix
+    if constexpr (std::is_same<T, std::string>::value) {
+      if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+        const auto& values = value_column->values();
+        with_bound_comparators(_lower_bound_inclusive, _upper_bound_inclusive, [&](auto lower_cmp, auto upper_cmp) {
+          const auto visit = [&](const ChunkOffset index, const ChunkOffset chunk_offset) {
+            if (lower_cmp(0, values.compare(chunk_offset, _lower_bound)) &&
+                upper_cmp(values.compare(chunk_offset, _upper_bound), 0)) {
+              matches.push_back(index);
+            }
+          };
+          if (selection == nullptr) {
+            for (ChunkOffset chunk_offset = 0; chunk_offset < values.size(); ++chunk_offset) {
+              visit(chunk_offset, chunk_offset);
+            }
+          } else {
+            for (ChunkOffset index = 0; index < selection->size(); ++index) visit(index, (*selection)[index]);
+          }
+        });
+        return;
+      }
+    }
+
+    with_bound_comparators(_lower_bound_inclusive, _upper_bound_inclusive, [&](auto lower_cmp, auto upper_cmp) {
+      detail::for_each_value_in_selection<T>(column, selection, [&](const ChunkOffset index, const auto& value) {
+        if (lower_cmp(_lower_bound, value) && upper_cmp(value, _upper_bound)) matches.push_back(index);
+      });
+    });
+  }
+
+ protected:
+  // The bounds become the ValueID range [begin, end), so that each row costs one comparison pair of integers
+  void _scan_dictionary_column(const DictionaryColumn<T>& column, const std::vector<ChunkOffset>* selection,
+                               std::vector<ChunkOffset>& matches) const {
+    const auto& attribute_vector = *column.attribute_vector();
+    const auto unique_values_count = ValueID{static_cast<ValueID::base_type>(column.unique_values_count())};
+
+    // INVALID_VALUE_ID means that all values are smaller than the bound, i.e., the range ends with the dictionary
+    auto begin = _lower_bound_inclusive ? column.lower_bound(_lower_bound) : column.upper_bound(_lower_bound);
+    if (begin == INVALID_VALUE_ID) begin = unique_values_count;
+    auto end = _upper_bound_inclusive ? column.upper_bound(_upper_bound) : column.lower_bound(_upper_bound);
+    if (end == INVALID_VALUE_ID) end = unique_values_count;
+    if (begin >= end) return;
+
+    if (selection == nullptr) {
+      if (begin == ValueID{0} && end == unique_values_count) {
+        for (ChunkOffset chunk_offset = 0; chunk_offset < attribute_vector.size(); ++chunk_offset) {
+          matches.push_back(chunk_offset);
+        }
+        return;
+      }
+      scan_value_id_range_to_offsets(attribute_vector, begin, end, false, matches);
+      return;
+    }
+
+    for (ChunkOffset index = 0; index < selection->size(); ++index) {
+      const auto value_id = attribute_vector.get((*selection)[index]);
+      if (value_id >= begin && value_id < end) matches.push_back(index);
+    }
+  }
+
+  const T _lower_bound;
+  const T _upper_bound;
+  const bool _lower_bound_inclusive;
+  const bool _upper_bound_inclusive;
+};
+
+}  // namespace
+
+BetweenScan::BetweenScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
+                         const AllTypeVariant& lower_bound, const AllTypeVariant& upper_bound,
+                         const bool lower_bound_inclusive, const bool upper_bound_inclusive)
+    : AbstractScanOperator(in, column_id),
+      _lower_bound{lower_bound},
+      _upper_bound{upper_bound},
+      _lower_bound_inclusive{lower_bound_inclusive},
+      _upper_bound_inclusive{upper_bound_inclusive} {}
+
+const AllTypeVariant& BetweenScan::lower_bound() const { return _lower_bound; }
+
+const AllTypeVariant& BetweenScan::upper_bound() const { return _upper_bound; }
+
+bool BetweenScan::lower_bound_inclusive() const { return _lower_bound_inclusive; }
+
+bool BetweenScan::upper_bound_inclusive() const { return _upper_bound_inclusive; }
+
+std::unique_ptr<BaseColumnScanImpl> BetweenScan::_create_impl(const Table& table_in, const size_t) const {
+  return make_unique_by_column_type<BaseColumnScanImpl, BetweenScanImpl>(
+      table_in.column_type(column_id()), _lower_bound, _upper_bound, _lower_bound_inclusive, _upper_bound_inclusive);
+}
+
+}  // namespace opossum
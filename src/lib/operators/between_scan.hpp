@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_scan_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that filters a table by a range predicate "lower_bound <= value <= upper_bound" on one of its columns, in a
+// single pass instead of two TableScans. Each bound can be made exclusive. Chunks whose zone map lies outside of the
+// bounds are skipped.
+//
+// On DictionaryColumns, the bounds are translated into one range of ValueIDs, so that the attribute vector is scanned
+// without looking at the values. This includes DictionaryColumns that are referenced by ReferenceColumns.
+class BetweenScan : public AbstractScanOperator {
+ public:
+  BetweenScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
+              const AllTypeVariant& lower_bound, const AllTypeVariant& upper_bound,
+              const bool lower_bound_inclusive = true, const bool upper_bound_inclusive = true);
+
+  const AllTypeVariant& lower_bound() const;
+  const AllTypeVariant& upper_bound() const;
+  bool lower_bound_inclusive() const;
+  bool upper_bound_inclusive() const;
+
+ protected:
+  std::unique_ptr<BaseColumnScanImpl> _create_impl(const Table& table_in, const size_t predicate_index) const override;
+
+  const AllTypeVariant _lower_bound;
+  const AllTypeVariant _upper_bound;
+  const bool _lower_bound_inclusive;
+  const bool _upper_bound_inclusive;
+};
+
+}  // namespace opossum
@@ -0,0 +1,186 @@
+#include "in_list_scan.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/attribute_vector_scan.hpp"
+#include "storage/bloom_filter.hpp"
+#include "storage/column_iteration.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/table.hpp"
+#include "storage/zone_map.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// A set of distinct values with linear probing. The slots only hold indices into the values, so that they stay
+// compact for strings, too. At least half of the slots are empty, so that probe sequences stay short.
+template <typename T>
+class OpenAddressingSet {
+ public:
+  explicit OpenAddressingSet(const std::vector<T>& values) : _values{values} {
+    Assert(values.size() < EMPTY_SLOT, "Too many values for an OpenAddressingSet");
+    size_t capacity = 1;
+    while (capacity < 2 * values.size()) capacity *= 2;
+    _slots.assign(capacity, EMPTY_SLOT);
+    _mask = capacity - 1;
+
+    for (uint32_t index = 0; index < values.size(); ++index) {
+      auto slot = bloom_filter_hash(values[index]) & _mask;
+      while (_slots[slot] != EMPTY_SLOT) slot = (slot + 1) & _mask;
+      _slots[slot] = index;
+    }
+  }
+
+  // Value is either T or its ValueView, i.e., std::string_view for strings
+  template <typename Value>
+  bool contains(const Value& value) const {
+    for (auto slot = bloom_filter_hash(value) & _mask; _slots[slot] != EMPTY_SLOT; slot = (slot + 1) & _mask) {
+      if (_values[_slots[slot]] == value) return true;
+    }
+    return false;
+  }
+
+ protected:
+  static constexpr auto EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+  const std::vector<T>& _values;
+  std::vector<uint32_t> _slots;
+  size_t _mask;
+};
+
+template <typename T>
+class InListScanImpl : public BaseColumnScanImpl {
+ public:
+  explicit InListScanImpl(const std::vector<AllTypeVariant>& values)
+      : _values{_sorted_distinct_values(values)}, _set{_values} {
+    _hashes.reserve(_values.size());
+    for (const auto& value : _values) _hashes.push_back(bloom_filter_hash(value));
+  }
+
+  // the list is sorted, so the chunk can be pruned if the first value that is not smaller than the minimum is greater
+  // than the maximum
+  bool can_prune_by_zone_map(const Chunk& chunk, const ColumnID column_id) const override {
+    const auto zone_map = std::dynamic_pointer_cast<const ZoneMap<T>>(chunk.zone_map(column_id));
+    if (!zone_map || zone_map->is_empty()) return false;
+    const auto value = std::lower_bound(_values.cbegin(), _values.cend(), zone_map->typed_min());
+    return value == _values.cend() || zone_map->typed_max() < *value;
+  }
+
+  bool can_prune_by_bloom_filter(const Chunk& chunk, const ColumnID column_id) const override {
+    const auto bloom_filter = chunk.bloom_filter(column_id);
+    return bloom_filter && std::none_of(_hashes.cbegin(), _hashes.cend(),
+                                        [&](const size_t hash) { return bloom_filter->may_contain(hash); });
+  }
+
+  void scan_column(const BaseColumn& column, const std::vector<ChunkOffset>* selection,
+                   std::vector<ChunkOffset>& matches) const override {
+    if (_values.empty()) return;
+
+    if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+      _scan_dictionary_column(*dictionary_column, selection, matches);
+      return;
+    }
+
+    // RunLengthColumns are probed once per run
+    const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column);
+    if (run_length_column && selection == nullptr) {
+      const auto& values = *run_length_column->values();
+      const auto& end_positions = *run_length_column->end_positions();
+      ChunkOffset run_begin = 0;
+      for (size_t run = 0; run < values.size(); ++run) {
+        if (_set.contains(values[run])) {
+          for (auto chunk_offset = run_begin; chunk_offset <= end_positions[run]; ++chunk_offset) {
+            matches.push_back(chunk_offset);
+          }
+        }
+        run_begin = end_positions[run] + 1;
+      }
+      return;
+    }
+
+    detail::for_each_value_in_selection<T>(column, selection, [&](const ChunkOffset index, const auto& value) {
+      if (_set.contains(value)) matches.push_back(index);
+    });
+  }
+
+ protected:
+  static std::vector<T> _sorted_distinct_values(const std::vector<AllTypeVariant>& values) {
+    std::vector<T> typed_values;
+    typed_values.reserve(values.size());
+    for (const auto& value : values) typed_values.push_back(type_cast<T>(value));
+    std::sort(typed_values.begin(), typed_values.end());
+    typed_values.erase(std::unique(typed_values.begin(), typed_values.end()), typed_values.end());
+    return typed_values;
+  }
+
+  // The list is translated into the matching ValueIDs, either by looking up each value in the sorted dictionary or,
+  // for lists longer than the dictionary, by probing the hash set with each dictionary entry. If they form a range,
+  // e.g., for lists of consecutive values, the attribute vector is scanned by the range kernels. Otherwise, the
+  // ValueIDs are looked up in a table with one entry per ValueID.
+  void _scan_dictionary_column(const DictionaryColumn<T>& column, const std::vector<ChunkOffset>* selection,
+                               std::vector<ChunkOffset>& matches) const {
+    const auto& dictionary = *column.dictionary();
+    const auto& attribute_vector = *column.attribute_vector();
+
+    // both loops find the ValueIDs in ascending order
+    std::vector<ValueID> matching_value_ids;
+    if (_values.size() < dictionary.size()) {
+      for (const auto& value : _values) {
+        const auto value_id = column.lower_bound(value);
+        if (value_id != INVALID_VALUE_ID && dictionary[value_id] == value) matching_value_ids.push_back(value_id);
+      }
+    } else {
+      for (ValueID value_id{0}; value_id < dictionary.size(); ++value_id) {
+        if (_set.contains(dictionary[value_id])) matching_value_ids.push_back(value_id);
+      }
+    }
+    if (matching_value_ids.empty()) return;
+
+    const auto range_begin = matching_value_ids.front();
+    const auto range_end = ValueID{static_cast<ValueID::base_type>(matching_value_ids.back() + 1)};
+    if (selection == nullptr && range_end - range_begin == matching_value_ids.size()) {
+      scan_value_id_range_to_offsets(attribute_vector, range_begin, range_end, false, matches);
+      return;
+    }
+
+    std::vector<uint8_t> value_id_matches(dictionary.size());
+    for (const auto& value_id : matching_value_ids) value_id_matches[value_id] = 1;
+
+    if (selection == nullptr) {
+      scan_value_id_set_to_offsets(attribute_vector, value_id_matches, matches);
+      return;
+    }
+
+    for (ChunkOffset index = 0; index < selection->size(); ++index) {
+      if (value_id_matches[attribute_vector.get((*selection)[index])]) matches.push_back(index);
+    }
+  }
+
+  const std::vector<T> _values;
+  const OpenAddressingSet<T> _set;
+  std::vector<size_t> _hashes;
+};
+
+}  // namespace
+
+InListScan::InListScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
+                       const std::vector<AllTypeVariant>& values)
+    : AbstractScanOperator(in, column_id), _values{values} {}
+
+const std::vector<AllTypeVariant>& InListScan::values() const { return _values; }
+
+std::unique_ptr<BaseColumnScanImpl> InListScan::_create_impl(const Table& table_in, const size_t) const {
+  return make_unique_by_column_type<BaseColumnScanImpl, InListScanImpl>(table_in.column_type(column_id()), _values);
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_scan_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that filters a table by the predicate "value IN (values)" on one of its columns. Chunks are skipped if their
+// zone map shows that no value of the list lies within the chunk's range, or if their Bloom filter contains none of
+// the values.
+//
+// Each row is checked in constant time, independent of the length of the list: for a DictionaryColumn, the list is
+// translated into a bitmap over the chunk's ValueIDs, which is then looked up per row. All other columns probe an
+// open-addressing hash set of the values.
+class InListScan : public AbstractScanOperator {
+ public:
+  InListScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
+             const std::vector<AllTypeVariant>& values);
+
+  const std::vector<AllTypeVariant>& values() const;
+
+ protected:
+  std::unique_ptr<BaseColumnScanImpl> _create_impl(const Table& table_in, const size_t predicate_index) const override;
+
+  const std::vector<AllTypeVariant> _values;
+};
+
+}  // namespace opossum
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "abstract_positions_operator.hpp"
+
+namespace opossum {
+
+// Operator that outputs the rows that are in both of its inputs, see AbstractPositionsOperator
+class IntersectPositions : public AbstractPositionsOperator {
+ public:
+  IntersectPositions(const std::shared_ptr<const AbstractOperator> left,
+                     const std::shared_ptr<const AbstractOperator> right);
+
+ protected:
+  void _merge(const std::vector<ChunkOffset>& left_offsets, const std::vector<ChunkOffset>& right_offsets,
+              std::vector<ChunkOffset>& offsets) const override;
+  void _combine_bitmaps(std::vector<uint8_t>& left_bitmap, const std::vector<uint8_t>& right_bitmap) const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,230 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/column_iteration.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The hash table of a build partition, i.e., its elements and bucket chains, should fit into the L2 cache
+constexpr size_t CACHE_SIZE = 256 * 1024;
+
+// More partitions make the partitioning pass itself suffer from TLB and cache misses
+constexpr size_t MAX_RADIX_BITS = 10;
+
+constexpr size_t MIN_ROWS_PER_THREAD = 10'000;
+
+constexpr uint32_t NO_ELEMENT = std::numeric_limits<uint32_t>::max();
+
+// std::hash is often the identity, so its bits are spread with the finalizer of MurmurHash3. The partition is taken
+// from the lowest bits of the hash, the bucket within the partition from the highest ones.
+template <typename Value>
+uint64_t join_hash(const Value& value) {
+  auto hash = static_cast<uint64_t>(std::hash<Value>{}(value));
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+template <typename T>
+struct Element {
+  ValueView<T> value;
+  RowID row_id;
+  uint64_t hash;
+};
+
+// The join values of one input, ordered by partition: partition p consists of elements [offsets[p], offsets[p + 1]).
+// Within a partition, the elements keep the order of the rows.
+template <typename T>
+struct RadixPartitions {
+  std::vector<Element<T>> elements;
+  std::vector<size_t> offsets;
+};
+
+// Materializes the values of a column and partitions them by the lowest radix_bits bits of their hashes. Each thread
+// materializes a range of chunks and counts its elements per partition. From these histograms, each thread knows where
+// in the output to write its elements of each partition.
+template <typename T>
+RadixPartitions<T> partition(const Table& table, const ColumnID column_id, const size_t radix_bits) {
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto thread_count = std::min(chunk_count, parallel_thread_count(table.row_count(), MIN_ROWS_PER_THREAD));
+  const auto partition_count = size_t{1} << radix_bits;
+  const auto partition_mask = partition_count - 1;
+
+  std::vector<std::vector<Element<T>>> thread_elements(thread_count);
+  std::vector<std::vector<size_t>> histograms(thread_count, std::vector<size_t>(partition_count));
+  parallel_for_each_range(chunk_count, thread_count, [&](const size_t thread, const size_t begin, const size_t end) {
+    auto& elements = thread_elements[thread];
+    auto& histogram = histograms[thread];
+    for (auto chunk_index = begin; chunk_index < end; ++chunk_index) {
+      const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_index)};
+      const auto& chunk = table.get_chunk(chunk_id);
+      if (chunk.col_count() == 0) continue;
+
+      for_each_value<T>(*chunk.get_column(column_id), [&](const ChunkOffset chunk_offset, const ValueView<T>& value) {
+        const auto hash = join_hash(value);
+        elements.push_back({value, RowID{chunk_id, chunk_offset}, hash});
+        ++histogram[hash & partition_mask];
+      });
+    }
+  });
+
+  RadixPartitions<T> partitions;
+  partitions.offsets.resize(partition_count + 1);
+  std::vector<std::vector<size_t>> write_offsets(thread_count, std::vector<size_t>(partition_count));
+  size_t offset = 0;
+  for (size_t partition_index = 0; partition_index < partition_count; ++partition_index) {
+    partitions.offsets[partition_index] = offset;
+    for (size_t thread = 0; thread < thread_count; ++thread) {
+      write_offsets[thread][partition_index] = offset;
+      offset += histograms[thread][partition_index];
+    }
+  }
+  partitions.offsets[partition_count] = offset;
+
+  partitions.elements.resize(offset);
+  parallel_for_each_range(thread_count, thread_count, [&](const size_t thread, const size_t, const size_t) {
+    auto& write_offset = write_offsets[thread];
+    for (const auto& element : thread_elements[thread]) {
+      partitions.elements[write_offset[element.hash & partition_mask]++] = element;
+    }
+  });
+
+  return partitions;
+}
+
+template <typename T>
+class JoinHashImpl {
+ public:
+  JoinHashImpl(const Table& left, const Table& right, const JoinMode mode,
+               const std::pair<ColumnID, ColumnID>& column_ids)
+      : _left{left}, _right{right}, _mode{mode}, _column_ids{column_ids} {}
+
+  // Appends the matching pairs of inner and left joins to the positions. For all other modes, the matched left rows
+  // are flagged in left_matches instead. Each row lies in a single partition, so the threads never write the same flag.
+  void execute(PosList& left_positions, PosList& right_positions, AbstractJoinOperator::LeftMatches& left_matches) {
+    const auto build_is_left = _left.row_count() < _right.row_count();
+    const auto build_row_count = std::min(_left.row_count(), _right.row_count());
+    const auto thread_count = parallel_thread_count(_left.row_count() + _right.row_count(), MIN_ROWS_PER_THREAD);
+
+    // enough partitions for the hash tables to fit into the cache and for all threads to have work
+    const auto build_bytes = build_row_count * (sizeof(Element<T>) + 2 * sizeof(uint32_t));
+    size_t radix_bits = 0;
+    while (radix_bits < MAX_RADIX_BITS &&
+           ((size_t{1} << radix_bits) * CACHE_SIZE < build_bytes || (size_t{1} << radix_bits) < thread_count)) {
+      ++radix_bits;
+    }
+
+    const auto left_partitions = partition<T>(_left, _column_ids.first, radix_bits);
+    const auto right_partitions = partition<T>(_right, _column_ids.second, radix_bits);
+    const auto& build = build_is_left ? left_partitions : right_partitions;
+    const auto& probe = build_is_left ? right_partitions : left_partitions;
+
+    const auto partition_count = size_t{1} << radix_bits;
+    std::vector<PosList> thread_left_positions(thread_count);
+    std::vector<PosList> thread_right_positions(thread_count);
+
+    parallel_for_each_range(partition_count, thread_count, [&](const size_t thread, const size_t begin,
+                                                               const size_t end) {
+      std::vector<uint32_t> bucket_heads;
+      std::vector<uint32_t> next_elements;
+
+      for (auto partition_index = begin; partition_index < end; ++partition_index) {
+        const auto build_begin = build.elements.cbegin() + build.offsets[partition_index];
+        const auto build_size = build.offsets[partition_index + 1] - build.offsets[partition_index];
+        const auto probe_begin = probe.elements.cbegin() + probe.offsets[partition_index];
+        const auto probe_end = probe.elements.cbegin() + probe.offsets[partition_index + 1];
+        if (build_size == 0 || probe_begin == probe_end) continue;
+        Assert(build_size < NO_ELEMENT, "Hash join partition is too large!");
+
+        // the elements of each bucket are chained through next_elements, starting at bucket_heads
+        size_t bucket_count = 1;
+        while (bucket_count < build_size) bucket_count *= 2;
+        const auto bucket_mask = bucket_count - 1;
+        bucket_heads.assign(bucket_count, NO_ELEMENT);
+        next_elements.resize(build_size);
+        for (uint32_t index = 0; index < build_size; ++index) {
+          const auto bucket = (build_begin[index].hash >> 32) & bucket_mask;
+          next_elements[index] = bucket_heads[bucket];
+          bucket_heads[bucket] = index;
+        }
+
+        for (auto probe_it = probe_begin; probe_it != probe_end; ++probe_it) {
+          const auto& probe_element = *probe_it;
+          for (auto index = bucket_heads[(probe_element.hash >> 32) & bucket_mask]; index != NO_ELEMENT;
+               index = next_elements[index]) {
+            const auto& build_element = build_begin[index];
+            if (build_element.hash != probe_element.hash || !(build_element.value == probe_element.value)) continue;
+
+            const auto& left_row_id = build_is_left ? build_element.row_id : probe_element.row_id;
+            if (_mode == JoinMode::Inner || _mode == JoinMode::Left) {
+              thread_left_positions[thread].push_back(left_row_id);
+              thread_right_positions[thread].push_back(build_is_left ? probe_element.row_id : build_element.row_id);
+            }
+            if (_mode != JoinMode::Inner) {
+              left_matches[left_row_id.chunk_id][left_row_id.chunk_offset] = 1;
+              // semi and anti joins only need to know whether a left row from the probe side has any match
+              if (!build_is_left && (_mode == JoinMode::Semi || _mode == JoinMode::Anti)) break;
+            }
+          }
+        }
+      }
+    });
+
+    for (size_t thread = 0; thread < thread_count; ++thread) {
+      left_positions.insert(left_positions.end(), thread_left_positions[thread].cbegin(),
+                            thread_left_positions[thread].cend());
+      right_positions.insert(right_positions.end(), thread_right_positions[thread].cbegin(),
+                             thread_right_positions[thread].cend());
+    }
+  }
+
+ protected:
+  const Table& _left;
+  const Table& _right;
+  const JoinMode _mode;
+  const std::pair<ColumnID, ColumnID> _column_ids;
+};
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                   const std::pair<ColumnID, ColumnID>& column_ids)
+    : AbstractJoinOperator(left, right, mode, column_ids, ScanType::OpEquals) {}
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  _validate_inputs();
+  const auto left = _input_table_left();
+  const auto right = _input_table_right();
+
+  auto left_positions = std::make_shared<PosList>();
+  auto right_positions = std::make_shared<PosList>();
+  auto left_matches = _create_left_matches();
+  resolve_data_type(left->column_type(_column_ids.first), [&](auto type) {
+    using Type = typename decltype(type)::type;
+    JoinHashImpl<Type>{*left, *right, _mode, _column_ids}.execute(*left_positions, *right_positions, left_matches);
+  });
+
+  // this includes left rows that are NULL and were never looked at
+  _add_left_rows_by_match(left_matches, *left_positions, *right_positions);
+
+  return _create_output_table(left_positions, right_positions);
+}
+
+}  // namespace opossum
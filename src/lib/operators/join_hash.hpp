@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Equi-join that builds a hash table of the smaller input (by row count) and probes it with the other one. Both inputs
+// are first partitioned by the hash of their join values (radix partitioning). Matching rows end up in the same
+// partition, and each partition of the build side is small enough for its hash table to stay in the CPU cache. The
+// partitions are joined in parallel, so the order of the output rows is not defined.
+class JoinHash : public AbstractJoinOperator {
+ public:
+  JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const JoinMode mode, const std::pair<ColumnID, ColumnID>& column_ids);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
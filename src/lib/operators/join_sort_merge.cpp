@@ -0,0 +1,233 @@
+#include "join_sort_merge.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/column_iteration.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr size_t MIN_ROWS_PER_THREAD = 10'000;
+
+template <typename T>
+struct Element {
+  ValueView<T> value;
+  RowID row_id;
+};
+
+template <typename T>
+bool value_less(const Element<T>& left, const Element<T>& right) {
+  return left.value < right.value;
+}
+
+// Returns the values of a column of the given chunk, sorted
+template <typename T>
+std::vector<Element<T>> sort_chunk(const BaseColumn& column, const ChunkID chunk_id) {
+  std::vector<Element<T>> elements;
+
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    // Counting sort: the ValueIDs are ordered like the values, so the values are never compared
+    const auto& dictionary = *dictionary_column->dictionary();
+    const auto& attribute_vector = *dictionary_column->attribute_vector();
+    std::vector<size_t> offsets(dictionary.size() + 1);
+    for (ChunkOffset chunk_offset = 0; chunk_offset < attribute_vector.size(); ++chunk_offset) {
+      ++offsets[attribute_vector.get(chunk_offset) + 1];
+    }
+    for (size_t value_id = 1; value_id < offsets.size(); ++value_id) offsets[value_id] += offsets[value_id - 1];
+
+    elements.resize(attribute_vector.size());
+    for (ChunkOffset chunk_offset = 0; chunk_offset < attribute_vector.size(); ++chunk_offset) {
+      const auto value_id = attribute_vector.get(chunk_offset);
+      elements[offsets[value_id]++] = {dictionary[value_id], RowID{chunk_id, chunk_offset}};
+    }
+    return elements;
+  }
+
+  elements.reserve(column.size());
+  for_each_value<T>(column, [&](const ChunkOffset chunk_offset, const ValueView<T>& value) {
+    elements.push_back({value, RowID{chunk_id, chunk_offset}});
+  });
+  if (!std::is_sorted(elements.cbegin(), elements.cend(), value_less<T>)) {
+    std::sort(elements.begin(), elements.end(), value_less<T>);
+  }
+  return elements;
+}
+
+// Returns the values of a column, sorted. NULL rows of ReferenceColumns are left out.
+template <typename T>
+std::vector<Element<T>> sort_column(const Table& table, const ColumnID column_id) {
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto thread_count = parallel_thread_count(table.row_count(), MIN_ROWS_PER_THREAD);
+
+  std::vector<std::vector<Element<T>>> chunk_elements(chunk_count);
+  parallel_for_each_range(chunk_count, std::min(chunk_count, thread_count),
+                          [&](const size_t, const size_t begin, const size_t end) {
+                            for (auto chunk_index = begin; chunk_index < end; ++chunk_index) {
+                              const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_index)};
+                              const auto& chunk = table.get_chunk(chunk_id);
+                              if (chunk.col_count() == 0) continue;
+                              chunk_elements[chunk_index] = sort_chunk<T>(*chunk.get_column(column_id), chunk_id);
+                            }
+                          });
+
+  // the sorted runs are [run_offsets[i], run_offsets[i + 1])
+  std::vector<Element<T>> elements;
+  elements.reserve(table.row_count());
+  std::vector<size_t> run_offsets{0};
+  for (const auto& sorted_chunk : chunk_elements) {
+    if (sorted_chunk.empty()) continue;
+    elements.insert(elements.end(), sorted_chunk.cbegin(), sorted_chunk.cend());
+    run_offsets.push_back(elements.size());
+  }
+
+  parallel_merge_runs(elements.begin(), std::move(run_offsets), value_less<T>, thread_count);
+
+  return elements;
+}
+
+template <typename T>
+class JoinSortMergeImpl {
+ public:
+  JoinSortMergeImpl(const Table& left, const Table& right, const JoinMode mode,
+                    const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+      : _left{left}, _right{right}, _mode{mode}, _column_ids{column_ids}, _scan_type{scan_type} {}
+
+  // Appends the matching pairs of inner and left joins to the positions. For all other modes, the matched left rows
+  // are flagged in left_matches instead.
+  void execute(PosList& left_positions, PosList& right_positions, AbstractJoinOperator::LeftMatches& left_matches) {
+    const auto left = sort_column<T>(_left, _column_ids.first);
+    const auto right = sort_column<T>(_right, _column_ids.second);
+    if (left.empty()) return;
+
+    // Each thread merges a range of the left values with the right ones. The ranges start at the first element of a
+    // group of equal values, so that the threads do not share groups.
+    const auto thread_count =
+        std::min(left.size(), parallel_thread_count(left.size() + right.size(), MIN_ROWS_PER_THREAD));
+    std::vector<size_t> range_begins(thread_count + 1, left.size());
+    for (size_t thread = 0; thread < thread_count; ++thread) {
+      auto begin = thread * left.size() / thread_count;
+      while (begin > 0 && begin < left.size() && !value_less<T>(left[begin - 1], left[begin])) ++begin;
+      range_begins[thread] = begin;
+    }
+
+    std::vector<PosList> thread_left_positions(thread_count);
+    std::vector<PosList> thread_right_positions(thread_count);
+
+    parallel_for_each_range(thread_count, thread_count, [&](const size_t thread, const size_t, const size_t) {
+      auto group_begin = range_begins[thread];
+      const auto range_end = range_begins[thread + 1];
+      if (group_begin == range_end) return;
+
+      // the right values in [lower, upper) equal the value of the current left group
+      const auto lower_it =
+          std::lower_bound(right.cbegin(), right.cend(), left[group_begin].value,
+                           [](const Element<T>& element, const ValueView<T>& value) { return element.value < value; });
+      auto lower = static_cast<size_t>(lower_it - right.cbegin());
+      auto upper = lower;
+
+      while (group_begin < range_end) {
+        const auto& value = left[group_begin].value;
+        auto group_end = group_begin + 1;
+        while (group_end < range_end && !(value < left[group_end].value)) ++group_end;
+
+        while (lower < right.size() && right[lower].value < value) ++lower;
+        upper = std::max(upper, lower);
+        while (upper < right.size() && !(value < right[upper].value)) ++upper;
+
+        const auto matching_ranges = _matching_ranges(lower, upper, right.size());
+        if (matching_ranges[0].first < matching_ranges[0].second ||
+            matching_ranges[1].first < matching_ranges[1].second) {
+          for (auto left_index = group_begin; left_index < group_end; ++left_index) {
+            const auto& left_row_id = left[left_index].row_id;
+            if (_mode != JoinMode::Inner) left_matches[left_row_id.chunk_id][left_row_id.chunk_offset] = 1;
+            if (_mode != JoinMode::Inner && _mode != JoinMode::Left) continue;
+
+            for (const auto& [begin, end] : matching_ranges) {
+              for (auto right_index = begin; right_index < end; ++right_index) {
+                thread_left_positions[thread].push_back(left_row_id);
+                thread_right_positions[thread].push_back(right[right_index].row_id);
+              }
+            }
+          }
+        }
+
+        group_begin = group_end;
+      }
+    });
+
+    for (size_t thread = 0; thread < thread_count; ++thread) {
+      left_positions.insert(left_positions.end(), thread_left_positions[thread].cbegin(),
+                            thread_left_positions[thread].cend());
+      right_positions.insert(right_positions.end(), thread_right_positions[thread].cbegin(),
+                             thread_right_positions[thread].cend());
+    }
+  }
+
+ protected:
+  // Returns the (up to two) ranges of the sorted right values that match a left value. [lower, upper) are the right
+  // values that equal the left value, size is the number of right values.
+  std::array<std::pair<size_t, size_t>, 2> _matching_ranges(const size_t lower, const size_t upper,
+                                                            const size_t size) const {
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        return {{{lower, upper}, {0, 0}}};
+      case ScanType::OpNotEquals:
+        return {{{0, lower}, {upper, size}}};
+      case ScanType::OpLessThan:
+        return {{{upper, size}, {0, 0}}};
+      case ScanType::OpLessThanEquals:
+        return {{{lower, size}, {0, 0}}};
+      case ScanType::OpGreaterThan:
+        return {{{0, lower}, {0, 0}}};
+      case ScanType::OpGreaterThanEquals:
+        return {{{0, upper}, {0, 0}}};
+    }
+    Fail("Unsupported scan type");
+    return {};
+  }
+
+  const Table& _left;
+  const Table& _right;
+  const JoinMode _mode;
+  const std::pair<ColumnID, ColumnID> _column_ids;
+  const ScanType _scan_type;
+};
+
+}  // namespace
+
+JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator> left,
+                             const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                             const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractJoinOperator(left, right, mode, column_ids, scan_type) {}
+
+std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
+  _validate_inputs();
+  const auto left = _input_table_left();
+  const auto right = _input_table_right();
+
+  auto left_positions = std::make_shared<PosList>();
+  auto right_positions = std::make_shared<PosList>();
+  auto left_matches = _create_left_matches();
+  resolve_data_type(left->column_type(_column_ids.first), [&](auto type) {
+    using Type = typename decltype(type)::type;
+    JoinSortMergeImpl<Type>{*left, *right, _mode, _column_ids, _scan_type}.execute(*left_positions, *right_positions,
+                                                                                   left_matches);
+  });
+
+  // this includes left rows that are NULL and were never looked at
+  _add_left_rows_by_match(left_matches, *left_positions, *right_positions);
+
+  return _create_output_table(left_positions, right_positions);
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Join that sorts both inputs by their join values and merges them. Unlike JoinHash, it supports all scan types, e.g.,
+// "left.a < right.b". Each chunk is sorted on its own, in parallel: dictionary-encoded chunks by counting the ValueIDs
+// of their attribute vectors, which are ordered like the values, all others by comparing values, unless they already
+// are in order. The sorted chunks are then merged pairwise, where neighbours that are already in order are skipped, so
+// presorted inputs are not sorted again. Inner and left joins output their pairs in the order of the join values.
+class JoinSortMerge : public AbstractJoinOperator {
+ public:
+  JoinSortMerge(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+                const JoinMode mode, const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
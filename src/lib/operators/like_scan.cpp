@@ -0,0 +1,237 @@
+#include "like_scan.hpp"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "storage/attribute_vector_scan.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/column_iteration.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/table.hpp"
+#include "storage/zone_map.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The rows of a DictionaryColumn that match the pattern: those whose ValueID lies within [begin, end) and, if there is
+// a bitmap, whose bit is set. Bit i of the bitmap belongs to ValueID begin + i.
+struct DictionaryMatches {
+  ValueID begin;
+  ValueID end;
+  std::vector<bool> bitmap;
+
+  bool contains(const ValueID value_id) const {
+    return value_id >= begin && value_id < end && (bitmap.empty() || bitmap[value_id - begin]);
+  }
+};
+
+class LikeMatcher {
+ public:
+  explicit LikeMatcher(const std::string& pattern) : _pattern{pattern} {
+    const auto wildcard = _pattern.find_first_of("%_");
+    _prefix = _pattern.substr(0, wildcard);
+    if (wildcard == std::string::npos) {
+      _kind = Kind::Equals;
+    } else if (_pattern.find_first_not_of('%', wildcard) == std::string::npos) {
+      _kind = Kind::Prefix;
+    }
+
+    // The values that start with the prefix are those in [prefix, successor), where the successor is the prefix
+    // without its trailing maximum characters and with the last remaining character incremented. If there is no such
+    // character, the range is unbounded.
+    auto successor = _prefix;
+    while (!successor.empty() && static_cast<unsigned char>(successor.back()) == 0xFF) successor.pop_back();
+    if (!successor.empty()) {
+      ++successor.back();
+      _prefix_successor = successor;
+    }
+  }
+
+  bool matches(const std::string_view value) const {
+    switch (_kind) {
+      case Kind::Equals:
+        return value == _pattern;
+      case Kind::Prefix:
+        return value.substr(0, _prefix.size()) == _prefix;
+      case Kind::General:
+        return _matches_pattern(value);
+    }
+    return false;
+  }
+
+  bool can_prune(const Chunk& chunk, const ColumnID column_id) const {
+    const auto zone_map = std::dynamic_pointer_cast<const ZoneMap<std::string>>(chunk.zone_map(column_id));
+    if (!zone_map || zone_map->is_empty()) return false;
+    if (_kind == Kind::Equals) return zone_map->can_prune(ScanType::OpEquals, _pattern);
+    return zone_map->typed_max() < _prefix || (_prefix_successor && zone_map->typed_min() >= *_prefix_successor);
+  }
+
+  // Only the dictionary entries that start with the prefix can match. If the pattern is no more than the prefix, these
+  // are exactly the matches. Otherwise, the pattern is matched against each of them.
+  DictionaryMatches dictionary_matches(const DictionaryColumn<std::string>& column) const {
+    const auto unique_values_count = ValueID{static_cast<ValueID::base_type>(column.unique_values_count())};
+    // INVALID_VALUE_ID means that all entries are smaller than the searched string
+    const auto bound = [&](const ValueID value_id) {
+      return value_id == INVALID_VALUE_ID ? unique_values_count : value_id;
+    };
+
+    auto result = DictionaryMatches{};
+    result.begin = bound(column.lower_bound(_prefix));
+    if (_kind == Kind::Equals) {
+      result.end = bound(column.upper_bound(_prefix));
+    } else {
+      result.end = _prefix_successor ? bound(column.lower_bound(*_prefix_successor)) : unique_values_count;
+    }
+    if (_kind != Kind::General || result.begin >= result.end) return result;
+
+    const auto& dictionary = *column.dictionary();
+    result.bitmap.resize(result.end - result.begin);
+    for (auto value_id = result.begin; value_id < result.end; ++value_id) {
+      result.bitmap[value_id - result.begin] = _matches_pattern(dictionary[value_id]);
+    }
+    return result;
+  }
+
+ protected:
+  enum class Kind { Equals, Prefix, General };
+
+  // Matches the value from left to right. When a character does not match, the last '%' is made to cover one more
+  // character, so that each '%' is only backtracked to once.
+  bool _matches_pattern(const std::string_view value) const {
+    size_t value_index = 0;
+    size_t pattern_index = 0;
+    auto last_wildcard = std::string::npos;
+    size_t last_wildcard_value_index = 0;
+
+    while (value_index < value.size()) {
+      if (pattern_index < _pattern.size() && _pattern[pattern_index] == '%') {
+        last_wildcard = pattern_index++;
+        last_wildcard_value_index = value_index;
+      } else if (pattern_index < _pattern.size() &&
+                 (_pattern[pattern_index] == '_' || _pattern[pattern_index] == value[value_index])) {
+        ++value_index;
+        ++pattern_index;
+      } else if (last_wildcard != std::string::npos) {
+        pattern_index = last_wildcard + 1;
+        value_index = ++last_wildcard_value_index;
+      } else {
+        return false;
+      }
+    }
+
+    while (pattern_index < _pattern.size() && _pattern[pattern_index] == '%') ++pattern_index;
+    return pattern_index == _pattern.size();
+  }
+
+  const std::string _pattern;
+  std::string _prefix;
+  std::optional<std::string> _prefix_successor;
+  Kind _kind = Kind::General;
+};
+
+class LikeScanImpl : public BaseColumnScanImpl {
+ public:
+  explicit LikeScanImpl(const std::string& pattern) : _matcher{pattern} {}
+
+  bool can_prune_by_zone_map(const Chunk& chunk, const ColumnID column_id) const override {
+    return _matcher.can_prune(chunk, column_id);
+  }
+
+  void scan_column(const BaseColumn& column, const std::vector<ChunkOffset>* selection,
+                   std::vector<ChunkOffset>& matches) const override {
+    if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<std::string>*>(&column)) {
+      _scan_dictionary_column(*dictionary_column, _matcher.dictionary_matches(*dictionary_column), selection, matches);
+      return;
+    }
+
+    const auto run_length_column = dynamic_cast<const RunLengthColumn<std::string>*>(&column);
+    if (run_length_column && selection == nullptr) {
+      const auto& values = *run_length_column->values();
+      const auto& end_positions = *run_length_column->end_positions();
+      ChunkOffset run_begin = 0;
+      for (size_t run = 0; run < values.size(); ++run) {
+        if (_matcher.matches(values[run])) {
+          for (auto chunk_offset = run_begin; chunk_offset <= end_positions[run]; ++chunk_offset) {
+            matches.push_back(chunk_offset);
+          }
+        }
+        run_begin = end_positions[run] + 1;
+      }
+      return;
+    }
+
+    detail::for_each_value_in_selection<std::string>(
+        column, selection, [&](const ChunkOffset index, const std::string_view value) {
+          if (_matcher.matches(value)) matches.push_back(index);
+        });
+  }
+
+ protected:
+  // The DictionaryMatches of a referenced chunk are only computed once, even if several runs point into it. All
+  // ReferenceColumns of the input column reference the same table, so the ChunkID identifies the chunk.
+  void _scan_referenced_column(const ChunkID chunk_id, const BaseColumn& column,
+                               const std::vector<ChunkOffset>& referenced_offsets,
+                               std::vector<ChunkOffset>& matches) const override {
+    const auto dictionary_column = dynamic_cast<const DictionaryColumn<std::string>*>(&column);
+    if (!dictionary_column) {
+      scan_column(column, &referenced_offsets, matches);
+      return;
+    }
+
+    auto chunk_matches = _dictionary_matches.find(chunk_id);
+    if (chunk_matches == _dictionary_matches.end()) {
+      chunk_matches = _dictionary_matches.emplace(chunk_id, _matcher.dictionary_matches(*dictionary_column)).first;
+    }
+    _scan_dictionary_column(*dictionary_column, chunk_matches->second, &referenced_offsets, matches);
+  }
+
+  void _scan_dictionary_column(const DictionaryColumn<std::string>& column,
+                               const DictionaryMatches& dictionary_matches, const std::vector<ChunkOffset>* selection,
+                               std::vector<ChunkOffset>& matches) const {
+    if (dictionary_matches.begin >= dictionary_matches.end) return;
+
+    const auto& attribute_vector = *column.attribute_vector();
+    if (selection != nullptr) {
+      for (ChunkOffset index = 0; index < selection->size(); ++index) {
+        if (dictionary_matches.contains(attribute_vector.get((*selection)[index]))) matches.push_back(index);
+      }
+      return;
+    }
+
+    if (dictionary_matches.bitmap.empty()) {
+      scan_value_id_range_to_offsets(attribute_vector, dictionary_matches.begin, dictionary_matches.end, false,
+                                     matches);
+      return;
+    }
+    for (ChunkOffset chunk_offset = 0; chunk_offset < attribute_vector.size(); ++chunk_offset) {
+      if (dictionary_matches.contains(attribute_vector.get(chunk_offset))) matches.push_back(chunk_offset);
+    }
+  }
+
+  const LikeMatcher _matcher;
+
+  // the matches of referenced DictionaryColumns, by their chunk
+  mutable std::map<ChunkID, DictionaryMatches> _dictionary_matches;
+};
+
+}  // namespace
+
+LikeScan::LikeScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
+                   const std::string& pattern)
+    : AbstractScanOperator(in, column_id), _pattern{pattern} {}
+
+const std::string& LikeScan::pattern() const { return _pattern; }
+
+std::unique_ptr<BaseColumnScanImpl> LikeScan::_create_impl(const Table& table_in, const size_t) const {
+  Assert(table_in.column_type(column_id()) == "string", "LIKE is only supported for string columns!");
+  return std::make_unique<LikeScanImpl>(_pattern);
+}
+
+}  // namespace opossum
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_scan_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that filters a table by the predicate "value LIKE pattern" on one of its string columns. In the pattern,
+// '%' matches any sequence of characters and '_' matches a single character. There is no escape character.
+//
+// DictionaryColumns are never matched row by row: a pattern of the form "prefix%" becomes the range of ValueIDs of
+// all dictionary entries that start with the prefix, and chunks whose zone map lies outside of that range are skipped.
+// All other patterns are matched once per dictionary entry, which yields a bitmap over the ValueIDs that is then
+// looked up for each row. Other columns are matched row by row, RunLengthColumns once per run.
+class LikeScan : public AbstractScanOperator {
+ public:
+  LikeScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const std::string& pattern);
+
+  const std::string& pattern() const;
+
+ protected:
+  std::unique_ptr<BaseColumnScanImpl> _create_impl(const Table& table_in, const size_t predicate_index) const override;
+
+  const std::string _pattern;
+};
+
+}  // namespace opossum
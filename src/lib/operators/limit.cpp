@@ -0,0 +1,42 @@
+#include "limit.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+Limit::Limit(const std::shared_ptr<const AbstractOperator> in, const size_t row_count)
+    : AbstractOperator(in), _row_count{row_count} {}
+
+size_t Limit::row_count() const { return _row_count; }
+
+std::shared_ptr<const Table> Limit::_on_execute() {
+  const auto input = _input_table_left();
+
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(std::min(_row_count, static_cast<size_t>(input->row_count())));
+  for (ChunkID chunk_id{0}; chunk_id < input->chunk_count() && pos_list->size() < _row_count; ++chunk_id) {
+    const auto chunk_size = input->get_chunk(chunk_id).size();
+    const auto end = static_cast<ChunkOffset>(std::min(static_cast<size_t>(chunk_size), _row_count - pos_list->size()));
+    for (ChunkOffset chunk_offset = 0; chunk_offset < end; ++chunk_offset) {
+      pos_list->push_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  auto output = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input->col_count(); ++column_id) {
+    output->add_column_definition(input->column_name(column_id), input->column_type(column_id));
+  }
+
+  auto chunk = Chunk{};
+  add_reference_columns(chunk, input, pos_list);
+  output->emplace_chunk(std::move(chunk));
+
+  return output;
+}
+
+}  // namespace opossum
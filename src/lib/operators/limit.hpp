@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that outputs the first row_count rows of its input, in their order, as a single chunk of ReferenceColumns.
+// Only the chunks up to the last row in the output are looked at.
+class Limit : public AbstractOperator {
+ public:
+  Limit(const std::shared_ptr<const AbstractOperator> in, const size_t row_count);
+
+  size_t row_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const size_t _row_count;
+};
+
+}  // namespace opossum
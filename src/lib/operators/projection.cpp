@@ -0,0 +1,380 @@
+#include "projection.hpp"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/column_iteration.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr size_t MIN_ROWS_PER_THREAD = 10'000;
+
+// the number of rows an expression is evaluated for at a time
+constexpr size_t BATCH_SIZE = 1024;
+
+// the numeric types, in the order in which arithmetic widens them
+constexpr std::array<const char*, 4> NUMERIC_TYPES{{"int", "long", "float", "double"}};
+
+template <typename T>
+std::string data_type_name() {
+  std::string name;
+  hana::for_each(column_types, [&](auto column_type) {
+    if (hana::second(column_type) == hana::type_c<T>) name = hana::first(column_type);
+  });
+  return name;
+}
+
+const char* operator_symbol(const ArithmeticOperator arithmetic_operator) {
+  switch (arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+      return "+";
+    case ArithmeticOperator::Subtraction:
+      return "-";
+    case ArithmeticOperator::Multiplication:
+      return "*";
+    case ArithmeticOperator::Division:
+      return "/";
+  }
+  Fail("Unknown arithmetic operator!");
+  return "";
+}
+
+// The values of an input column in a chunk. The values of NULL rows are unspecified.
+struct BaseInputValues {
+  virtual ~BaseInputValues() = default;
+};
+
+template <typename T>
+struct InputValues : BaseInputValues {
+  // only used for columns that are not ValueColumns
+  std::vector<T> decoded_values;
+  const T* values = nullptr;
+};
+
+// Evaluates numeric expressions for all rows of a chunk
+class ChunkEvaluator {
+ public:
+  ChunkEvaluator(const Table& input, const Chunk& chunk) : _input{input}, _chunk{chunk} {}
+
+  // returns the values of the expression, where the rows that are NULL in any of its input columns are set in nulls
+  template <typename T>
+  std::vector<T> evaluate(const ProjectionExpression& expression, std::vector<uint8_t>& nulls) {
+    const auto chunk_size = static_cast<size_t>(_chunk.size());
+    nulls.assign(chunk_size, 0);
+    _nulls = &nulls;
+    _load_inputs(expression);
+
+    std::vector<T> values(chunk_size);
+    for (size_t begin = 0; begin < chunk_size; begin += BATCH_SIZE) {
+      _evaluate_batch(expression, begin, std::min(BATCH_SIZE, chunk_size - begin), values.data() + begin);
+    }
+    return values;
+  }
+
+ protected:
+  void _load_inputs(const ProjectionExpression& expression) {
+    if (expression.type == ProjectionExpression::Type::Arithmetic) {
+      _load_inputs(*expression.left);
+      _load_inputs(*expression.right);
+      return;
+    }
+    if (expression.type != ProjectionExpression::Type::Column) return;
+
+    const auto& column = *_chunk.get_column(expression.column_id);
+    if (const auto reference_column = dynamic_cast<const ReferenceColumn*>(&column)) {
+      const auto& pos_list = *reference_column->pos_list();
+      for (ChunkOffset chunk_offset = 0; chunk_offset < pos_list.size(); ++chunk_offset) {
+        if (pos_list[chunk_offset] == NULL_ROW_ID) (*_nulls)[chunk_offset] = 1;
+      }
+    }
+
+    auto& input_values = _inputs[expression.column_id];
+    if (input_values) return;
+    resolve_data_type(_input.column_type(expression.column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      if constexpr (!std::is_same<Type, std::string>::value) {
+        auto typed_input_values = std::make_shared<InputValues<Type>>();
+        if (const auto value_column = dynamic_cast<const ValueColumn<Type>*>(&column)) {
+          typed_input_values->values = value_column->values().data();
+        } else {
+          auto& decoded_values = typed_input_values->decoded_values;
+          decoded_values.resize(column.size());
+          for_each_value<Type>(column, [&](const ChunkOffset chunk_offset, const Type value) {
+            decoded_values[chunk_offset] = value;
+          });
+          typed_input_values->values = decoded_values.data();
+        }
+        input_values = typed_input_values;
+      }
+    });
+  }
+
+  // writes the values of the expression for count rows starting at begin to values, converted to T
+  template <typename T>
+  void _evaluate_batch(const ProjectionExpression& expression, const size_t begin, const size_t count, T* values) {
+    switch (expression.type) {
+      case ProjectionExpression::Type::Column:
+        resolve_data_type(_input.column_type(expression.column_id), [&](auto type) {
+          using Type = typename decltype(type)::type;
+          if constexpr (!std::is_same<Type, std::string>::value) {
+            const auto input_values =
+                static_cast<const InputValues<Type>&>(*_inputs.at(expression.column_id)).values + begin;
+            std::transform(input_values, input_values + count, values,
+                           [](const Type value) { return static_cast<T>(value); });
+          }
+        });
+        return;
+
+      case ProjectionExpression::Type::Literal:
+        std::fill(values, values + count, type_cast<T>(expression.value));
+        return;
+
+      case ProjectionExpression::Type::Arithmetic:
+        // the operation is done in its own type, e.g., for an integer division within a double expression
+        const auto data_type = expression.data_type(_input);
+        if (data_type == data_type_name<T>()) {
+          _evaluate_arithmetic(expression, begin, count, values);
+          return;
+        }
+        resolve_data_type(data_type, [&](auto type) {
+          using Type = typename decltype(type)::type;
+          if constexpr (!std::is_same<Type, std::string>::value) {
+            std::vector<Type> typed_values(count);
+            _evaluate_arithmetic(expression, begin, count, typed_values.data());
+            std::transform(typed_values.cbegin(), typed_values.cend(), values,
+                           [](const Type value) { return static_cast<T>(value); });
+          }
+        });
+        return;
+    }
+  }
+
+  template <typename T>
+  void _evaluate_arithmetic(const ProjectionExpression& expression, const size_t begin, const size_t count,
+                            T* values) {
+    std::vector<T> right_values(count);
+    _evaluate_batch(*expression.left, begin, count, values);
+    _evaluate_batch(*expression.right, begin, count, right_values.data());
+
+    switch (expression.arithmetic_operator) {
+      case ArithmeticOperator::Addition:
+        for (size_t index = 0; index < count; ++index) values[index] += right_values[index];
+        return;
+      case ArithmeticOperator::Subtraction:
+        for (size_t index = 0; index < count; ++index) values[index] -= right_values[index];
+        return;
+      case ArithmeticOperator::Multiplication:
+        for (size_t index = 0; index < count; ++index) values[index] *= right_values[index];
+        return;
+      case ArithmeticOperator::Division:
+        if constexpr (std::is_integral<T>::value) {
+          // the values of NULL rows may be zero
+          for (size_t index = 0; index < count; ++index) {
+            if (right_values[index] != 0) continue;
+            Assert((*_nulls)[begin + index], "Division by zero!");
+            right_values[index] = 1;
+          }
+        }
+        for (size_t index = 0; index < count; ++index) values[index] /= right_values[index];
+        return;
+    }
+  }
+
+  const Table& _input;
+  const Chunk& _chunk;
+  std::vector<uint8_t>* _nulls = nullptr;
+  std::map<ColumnID, std::shared_ptr<BaseInputValues>> _inputs;
+};
+
+}  // namespace
+
+std::shared_ptr<const ProjectionExpression> ProjectionExpression::column(const ColumnID column_id) {
+  auto expression = std::make_shared<ProjectionExpression>();
+  expression->type = Type::Column;
+  expression->column_id = column_id;
+  return expression;
+}
+
+std::shared_ptr<const ProjectionExpression> ProjectionExpression::literal(const AllTypeVariant& value) {
+  auto expression = std::make_shared<ProjectionExpression>();
+  expression->type = Type::Literal;
+  expression->value = value;
+  return expression;
+}
+
+std::shared_ptr<const ProjectionExpression> ProjectionExpression::arithmetic(
+    const ArithmeticOperator arithmetic_operator, const std::shared_ptr<const ProjectionExpression>& left,
+    const std::shared_ptr<const ProjectionExpression>& right) {
+  Assert(left && right, "Arithmetic expressions need two operands!");
+  auto expression = std::make_shared<ProjectionExpression>();
+  expression->type = Type::Arithmetic;
+  expression->arithmetic_operator = arithmetic_operator;
+  expression->left = left;
+  expression->right = right;
+  return expression;
+}
+
+std::string ProjectionExpression::data_type(const Table& input) const {
+  switch (type) {
+    case Type::Column:
+      Assert(column_id < input.col_count(), "Column ID out of range!");
+      return input.column_type(column_id);
+
+    case Type::Literal: {
+      std::string name;
+      hana::for_each(column_types, [&](auto column_type) {
+        using ColumnType = typename decltype(+hana::second(column_type))::type;
+        if (value.type() == typeid(ColumnType)) name = hana::first(column_type);
+      });
+      return name;
+    }
+
+    case Type::Arithmetic: {
+      const auto left_position = std::find(NUMERIC_TYPES.cbegin(), NUMERIC_TYPES.cend(), left->data_type(input));
+      const auto right_position = std::find(NUMERIC_TYPES.cbegin(), NUMERIC_TYPES.cend(), right->data_type(input));
+      Assert(left_position != NUMERIC_TYPES.cend() && right_position != NUMERIC_TYPES.cend(),
+             "Arithmetic is only defined for numbers!");
+      return *std::max(left_position, right_position);
+    }
+  }
+  Fail("Unknown expression type!");
+  return "";
+}
+
+std::string ProjectionExpression::description(const Table& input) const {
+  switch (type) {
+    case Type::Column:
+      return input.column_name(column_id);
+    case Type::Literal:
+      return type_cast<std::string>(value);
+    case Type::Arithmetic:
+      return "(" + left->description(input) + " " + operator_symbol(arithmetic_operator) + " " +
+             right->description(input) + ")";
+  }
+  Fail("Unknown expression type!");
+  return "";
+}
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator> in,
+                       const std::vector<ProjectionColumnDefinition>& columns)
+    : AbstractOperator(in), _columns{columns} {
+  for (const auto& column : _columns) Assert(column.expression, "Projection columns need an expression!");
+}
+
+const std::vector<ProjectionColumnDefinition>& Projection::columns() const { return _columns; }
+
+std::shared_ptr<const Table> Projection::_on_execute() {
+  const auto input = _input_table_left();
+
+  // chunks without columns are the empty first chunk of a table that only has column definitions
+  std::vector<ChunkID> chunk_ids;
+  for (ChunkID chunk_id{0}; chunk_id < input->chunk_count(); ++chunk_id) {
+    if (input->get_chunk(chunk_id).col_count() > 0) chunk_ids.push_back(chunk_id);
+  }
+  const auto chunk_count = chunk_ids.size();
+
+  auto output = std::make_shared<Table>();
+  std::vector<std::string> data_types;
+  for (const auto& column : _columns) {
+    data_types.push_back(column.expression->data_type(*input));
+    const auto& name = column.name.empty() ? column.expression->description(*input) : column.name;
+    output->add_column_definition(name, data_types.back());
+  }
+
+  // an input without chunks with columns results in a chunk of empty columns, so that the output can be used by
+  // further operators
+  if (chunk_ids.empty()) {
+    auto chunk = Chunk{};
+    for (const auto& data_type : data_types) {
+      chunk.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(data_type));
+    }
+    output->emplace_chunk(std::move(chunk));
+    return output;
+  }
+
+  // the table that holds the computed columns of reference tables, with one chunk per input chunk with columns
+  std::shared_ptr<Table> computed_table;
+  std::vector<ColumnID> computed_column_ids(_columns.size());
+  if (dynamic_cast<const ReferenceColumn*>(&*input->get_chunk(chunk_ids.front()).get_column(ColumnID{0}))) {
+    for (size_t index = 0; index < _columns.size(); ++index) {
+      if (_columns[index].expression->type == ProjectionExpression::Type::Column) continue;
+      if (!computed_table) computed_table = std::make_shared<Table>();
+      computed_column_ids[index] = ColumnID{computed_table->col_count()};
+      computed_table->add_column_definition(output->column_name(ColumnID{static_cast<uint16_t>(index)}),
+                                            data_types[index]);
+    }
+  }
+
+  std::vector<Chunk> output_chunks(chunk_count);
+  std::vector<Chunk> computed_chunks(computed_table ? chunk_count : 0);
+  const auto thread_count = std::min(chunk_count, parallel_thread_count(input->row_count(), MIN_ROWS_PER_THREAD));
+  parallel_for_each_range(chunk_count, thread_count, [&](const size_t, const size_t begin, const size_t end) {
+    for (auto chunk_index = begin; chunk_index < end; ++chunk_index) {
+      const auto& chunk = input->get_chunk(chunk_ids[chunk_index]);
+      auto& output_chunk = output_chunks[chunk_index];
+      ChunkEvaluator evaluator{*input, chunk};
+
+      for (size_t index = 0; index < _columns.size(); ++index) {
+        const auto& expression = *_columns[index].expression;
+        if (expression.type == ProjectionExpression::Type::Column) {
+          output_chunk.add_column_of(chunk, expression.column_id);
+          continue;
+        }
+
+        std::shared_ptr<BaseColumn> column;
+        std::vector<uint8_t> nulls;
+        resolve_data_type(data_types[index], [&](auto type) {
+          using Type = typename decltype(type)::type;
+          if constexpr (std::is_same<Type, std::string>::value) {
+            // only string literals have the type string
+            ValueVector<std::string> values;
+            values.reserve(chunk.size());
+            const auto value = type_cast<std::string>(expression.value);
+            for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) values.push_back(value);
+            column = std::make_shared<ValueColumn<std::string>>(std::move(values));
+          } else {
+            column = std::make_shared<ValueColumn<Type>>(evaluator.evaluate<Type>(expression, nulls));
+          }
+        });
+
+        if (!computed_table) {
+          output_chunk.add_column(column);
+          continue;
+        }
+
+        // the computed table has one chunk per input chunk with columns
+        const auto computed_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_index)};
+        computed_chunks[chunk_index].add_column(column);
+        auto pos_list = std::make_shared<PosList>(chunk.size());
+        for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+          const auto is_null = !nulls.empty() && nulls[chunk_offset];
+          (*pos_list)[chunk_offset] = is_null ? NULL_ROW_ID : RowID{computed_chunk_id, chunk_offset};
+        }
+        output_chunk.add_column(
+            std::make_shared<ReferenceColumn>(computed_table, computed_column_ids[index], pos_list));
+      }
+    }
+  });
+
+  for (auto& chunk : computed_chunks) computed_table->emplace_chunk(std::move(chunk));
+  for (auto& chunk : output_chunks) output->emplace_chunk(std::move(chunk));
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class ArithmeticOperator { Addition, Subtraction, Multiplication, Division };
+
+// An expression that computes a column of the Projection's output: a column of the input, a literal, or an arithmetic
+// operation on two expressions. Arithmetic is only defined for numbers. Its type is the wider type of both operands in
+// the order int, long, float, double, e.g., an int divided by an int is an int. Integer division by zero fails.
+struct ProjectionExpression {
+  enum class Type { Column, Literal, Arithmetic };
+
+  static std::shared_ptr<const ProjectionExpression> column(const ColumnID column_id);
+  static std::shared_ptr<const ProjectionExpression> literal(const AllTypeVariant& value);
+  static std::shared_ptr<const ProjectionExpression> arithmetic(
+      const ArithmeticOperator arithmetic_operator, const std::shared_ptr<const ProjectionExpression>& left,
+      const std::shared_ptr<const ProjectionExpression>& right);
+
+  // returns the type of the expression's values, e.g., "long"
+  std::string data_type(const Table& input) const;
+
+  // returns a description like "(a + 2)"
+  std::string description(const Table& input) const;
+
+  Type type;
+  ColumnID column_id{0};
+  AllTypeVariant value;
+  ArithmeticOperator arithmetic_operator = ArithmeticOperator::Addition;
+  std::shared_ptr<const ProjectionExpression> left;
+  std::shared_ptr<const ProjectionExpression> right;
+};
+
+struct ProjectionColumnDefinition {
+  std::shared_ptr<const ProjectionExpression> expression;
+  // the name of the output column. If empty, it is the name of the input column or the expression's description.
+  std::string name = "";
+};
+
+// Operator that outputs one column per definition. Columns of the input are passed through without copying them,
+// together with their zone maps and Bloom filters, so that selecting columns costs nothing regardless of whether the
+// input consists of data or ReferenceColumns.
+//
+// Other expressions are computed chunk by chunk in parallel. Within a chunk, each expression is evaluated in batches of
+// rows, one operation at a time, so that the loops over the values can be vectorized and the batches stay in the
+// cache. The input columns are read directly from ValueColumns and decoded once per chunk from other columns. For
+// data tables, the results are new ValueColumns. As a table must not mix ReferenceColumns and other columns, the
+// results for reference tables are stored in a new table instead, which the output references. Rows that are NULL in
+// any input column of an expression are NULL in its result.
+class Projection : public AbstractOperator {
+ public:
+  Projection(const std::shared_ptr<const AbstractOperator> in, const std::vector<ProjectionColumnDefinition>& columns);
+
+  const std::vector<ProjectionColumnDefinition>& columns() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<ProjectionColumnDefinition> _columns;
+};
+
+}  // namespace opossum
@@ -0,0 +1,391 @@
+#include "sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "storage/column_iteration.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr size_t MIN_ROWS_PER_THREAD = 10'000;
+
+// the number of bytes of a string that are part of the key
+constexpr size_t STRING_PREFIX_LENGTH = 8;
+
+template <typename T>
+constexpr size_t normalized_width() {
+  return std::is_same<T, std::string>::value ? STRING_PREFIX_LENGTH : sizeof(T);
+}
+
+// Writes the bytes of a value so that memcmp orders them like the values. Strings are cut off after their prefix and
+// padded with zeros.
+template <typename T>
+void normalize_value(const ValueView<T>& value, uint8_t* key) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    const auto length = std::min(value.size(), STRING_PREFIX_LENGTH);
+    std::memcpy(key, value.data(), length);
+    std::memset(key + length, 0, STRING_PREFIX_LENGTH - length);
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(Bits) * 8 - 1);
+
+    Bits bits;
+    if constexpr (std::is_floating_point<T>::value) {
+      // -0.0 equals 0.0. Negative numbers are ordered inversely to their bits, so all their bits are flipped.
+      const T normalized = value == 0 ? T{0} : value;
+      std::memcpy(&bits, &normalized, sizeof(bits));
+      bits = (bits & sign_bit) ? ~bits : bits | sign_bit;
+    } else {
+      std::memcpy(&bits, &value, sizeof(bits));
+      bits ^= sign_bit;
+    }
+
+    for (size_t byte = 0; byte < sizeof(Bits); ++byte) {
+      key[byte] = static_cast<uint8_t>(bits >> ((sizeof(Bits) - 1 - byte) * 8));
+    }
+  }
+}
+
+// Sorts the elements by their keys, stable. This is a least significant digit radix sort over the bytes of the keys,
+// which skips bytes that are the same in all keys.
+void radix_sort(std::vector<std::pair<uint64_t, size_t>>& elements) {
+  std::vector<std::pair<uint64_t, size_t>> sorted_elements(elements.size());
+  for (size_t shift = 0; shift < 64; shift += 8) {
+    std::array<size_t, 256> offsets{};
+    for (const auto& element : elements) ++offsets[(element.first >> shift) & 0xFF];
+    if (offsets[(elements[0].first >> shift) & 0xFF] == elements.size()) continue;
+
+    size_t offset = 0;
+    for (auto& bucket_offset : offsets) offset += std::exchange(bucket_offset, offset);
+    for (const auto& element : elements) sorted_elements[offsets[(element.first >> shift) & 0xFF]++] = element;
+    elements.swap(sorted_elements);
+  }
+}
+
+// The part of a key that belongs to a sort column. Nullable columns start with a byte that is 1 for NULL values.
+struct KeySegment {
+  size_t offset;
+  size_t width;
+  bool is_nullable;
+  bool is_descending;
+  // the index of the column's strings in SortImpl::_strings, or -1 if it is not a string column
+  int string_index;
+};
+
+// The end of a string prefix in a key. If the keys of two rows are equal up to there, their full strings decide.
+struct StringPrefix {
+  size_t end;
+  int string_index;
+  bool is_descending;
+};
+
+// The keys of a number of rows, each of them width bytes
+struct Keys {
+  const uint8_t* key(const size_t index) const { return bytes.data() + index * width; }
+
+  // Keys without string prefixes are exact, i.e., equal keys mean equal rows.
+  bool is_exact() const { return string_prefixes.empty(); }
+
+  std::vector<uint8_t> bytes;
+  size_t width = 0;
+  std::vector<StringPrefix> string_prefixes;
+};
+
+class SortImpl {
+ public:
+  SortImpl(const Table& input, const std::vector<SortColumnDefinition>& sort_definitions)
+      : _input{input}, _sort_definitions{sort_definitions} {}
+
+  std::shared_ptr<PosList> execute() {
+    const auto chunk_count = static_cast<size_t>(_input.chunk_count());
+    size_t row_count = 0;
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      _chunk_begins.push_back(row_count);
+      row_count += _input.get_chunk(chunk_id).size();
+    }
+    _chunk_begins.push_back(row_count);
+    if (row_count == 0) return std::make_shared<PosList>();
+
+    _init_segments();
+    _keys.bytes.resize(row_count * _keys.width);
+    for (auto& strings : _strings) strings.resize(row_count);
+    _row_ids.resize(row_count);
+    _local_keys.resize(chunk_count);
+
+    const auto thread_count = parallel_thread_count(row_count, MIN_ROWS_PER_THREAD);
+    parallel_for_each_range(chunk_count, std::min(chunk_count, thread_count),
+                            [&](const size_t, const size_t begin, const size_t end) {
+                              for (auto chunk_index = begin; chunk_index < end; ++chunk_index) {
+                                _build_keys(ChunkID{static_cast<ChunkID::base_type>(chunk_index)});
+                              }
+                            });
+
+    // runs never span chunks, but large chunks are split so that all threads get to sort
+    struct Run {
+      ChunkID chunk_id;
+      size_t begin;
+      size_t end;
+    };
+    std::vector<Run> runs;
+    const auto max_run_size = std::max(size_t{1}, (row_count + thread_count - 1) / thread_count);
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      for (auto begin = _chunk_begins[chunk_id]; begin < _chunk_begins[chunk_id + 1]; begin += max_run_size) {
+        runs.push_back({chunk_id, begin, std::min(begin + max_run_size, _chunk_begins[chunk_id + 1])});
+      }
+    }
+
+    _order.resize(row_count);
+    std::iota(_order.begin(), _order.end(), size_t{0});
+    parallel_for_each_range(runs.size(), std::min(runs.size(), thread_count),
+                            [&](const size_t, const size_t begin, const size_t end) {
+                              for (auto run_index = begin; run_index < end; ++run_index) {
+                                _sort_run(runs[run_index].chunk_id, runs[run_index].begin, runs[run_index].end);
+                              }
+                            });
+
+    std::vector<size_t> run_offsets{0};
+    for (const auto& run : runs) run_offsets.push_back(run.end);
+    parallel_merge_runs(_order.begin(), std::move(run_offsets),
+                        [&](const size_t left, const size_t right) { return _less(_keys, 0, left, right); },
+                        thread_count);
+
+    auto pos_list = std::make_shared<PosList>();
+    pos_list->reserve(row_count);
+    for (const auto index : _order) pos_list->push_back(_row_ids[index]);
+    return pos_list;
+  }
+
+ protected:
+  void _init_segments() {
+    for (const auto& sort_definition : _sort_definitions) {
+      const auto column_id = sort_definition.column_id;
+      Assert(column_id < _input.col_count(), "Sort column ID out of range!");
+
+      // only ReferenceColumns can hold NULL values
+      auto is_nullable = false;
+      for (ChunkID chunk_id{0}; chunk_id < _input.chunk_count(); ++chunk_id) {
+        const auto& chunk = _input.get_chunk(chunk_id);
+        is_nullable |= chunk.col_count() > 0 && dynamic_cast<const ReferenceColumn*>(&*chunk.get_column(column_id));
+      }
+
+      const auto& column_type = _input.column_type(column_id);
+      size_t value_width = 0;
+      resolve_data_type(column_type, [&](auto type) {
+        using Type = typename decltype(type)::type;
+        value_width = normalized_width<Type>();
+      });
+
+      auto string_index = -1;
+      if (column_type == "string") {
+        string_index = static_cast<int>(_strings.size());
+        _strings.emplace_back();
+      }
+
+      const auto width = value_width + (is_nullable ? 1 : 0);
+      const auto is_descending = sort_definition.order_by_mode == OrderByMode::Descending;
+      _segments.push_back(KeySegment{_keys.width, width, is_nullable, is_descending, string_index});
+      _keys.width += width;
+      if (string_index >= 0) _keys.string_prefixes.push_back(StringPrefix{_keys.width, string_index, is_descending});
+    }
+  }
+
+  // Fills the keys of the chunk's rows and, if a sort column of the chunk is dictionary-encoded, the local keys
+  void _build_keys(const ChunkID chunk_id) {
+    const auto& chunk = _input.get_chunk(chunk_id);
+    const auto chunk_begin = _chunk_begins[chunk_id];
+    const auto chunk_size = chunk.size();
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      _row_ids[chunk_begin + chunk_offset] = RowID{chunk_id, chunk_offset};
+    }
+    if (chunk_size == 0) return;
+
+    auto& local_keys = _local_keys[chunk_id];
+    std::vector<const BaseDictionaryColumn*> dictionary_columns;
+    std::vector<size_t> value_id_widths;
+
+    for (size_t index = 0; index < _sort_definitions.size(); ++index) {
+      const auto& segment = _segments[index];
+      const auto& column = *chunk.get_column(_sort_definitions[index].column_id);
+
+      resolve_data_type(_input.column_type(_sort_definitions[index].column_id), [&](auto type) {
+        using Type = typename decltype(type)::type;
+        if (segment.is_nullable) {
+          for (auto row = chunk_begin; row < chunk_begin + chunk_size; ++row) {
+            auto key = &_keys.bytes[row * _keys.width + segment.offset];
+            key[0] = 1;
+            std::memset(key + 1, 0, segment.width - 1);
+          }
+        }
+
+        for_each_value<Type>(column, [&](const ChunkOffset chunk_offset, const ValueView<Type>& value) {
+          const auto row = chunk_begin + chunk_offset;
+          auto key = &_keys.bytes[row * _keys.width + segment.offset];
+          if (segment.is_nullable) *key++ = 0;
+          normalize_value<Type>(value, key);
+          if constexpr (std::is_same<Type, std::string>::value) _strings[segment.string_index][row] = value;
+        });
+      });
+
+      if (segment.is_descending) {
+        for (auto row = chunk_begin; row < chunk_begin + chunk_size; ++row) {
+          auto key = &_keys.bytes[row * _keys.width + segment.offset];
+          for (size_t byte = 0; byte < segment.width; ++byte) key[byte] = ~key[byte];
+        }
+      }
+
+      // the fewest bytes that hold all ValueIDs of the column
+      const auto dictionary_column = dynamic_cast<const BaseDictionaryColumn*>(&column);
+      dictionary_columns.push_back(dictionary_column);
+      size_t width = segment.width;
+      if (dictionary_column) {
+        const auto unique_values_count = dictionary_column->unique_values_count();
+        width = unique_values_count <= (size_t{1} << 8) ? 1 : unique_values_count <= (size_t{1} << 16) ? 2 : 4;
+      }
+      value_id_widths.push_back(width);
+      local_keys.width += width;
+      if (!dictionary_column && segment.string_index >= 0) {
+        local_keys.string_prefixes.push_back(
+            StringPrefix{local_keys.width, segment.string_index, segment.is_descending});
+      }
+    }
+
+    const auto is_dictionary_column = [](const BaseDictionaryColumn* column) { return column != nullptr; };
+    if (std::none_of(dictionary_columns.cbegin(), dictionary_columns.cend(), is_dictionary_column)) {
+      local_keys = Keys{};
+      return;
+    }
+
+    // Local keys are only compared within the chunk. DictionaryColumns are represented by their ValueIDs, all other
+    // columns by the same bytes as in the keys.
+    local_keys.bytes.resize(chunk_size * local_keys.width);
+    size_t local_offset = 0;
+    for (size_t index = 0; index < _sort_definitions.size(); ++index) {
+      const auto& segment = _segments[index];
+      const auto width = value_id_widths[index];
+
+      if (const auto dictionary_column = dictionary_columns[index]) {
+        const auto& attribute_vector = *dictionary_column->attribute_vector();
+        for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+          auto value_id = static_cast<uint32_t>(attribute_vector.get(chunk_offset));
+          if (segment.is_descending) value_id = ~value_id;
+          auto key = &local_keys.bytes[chunk_offset * local_keys.width + local_offset];
+          for (size_t byte = 0; byte < width; ++byte) {
+            key[byte] = static_cast<uint8_t>(value_id >> ((width - 1 - byte) * 8));
+          }
+        }
+      } else {
+        for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+          std::memcpy(&local_keys.bytes[chunk_offset * local_keys.width + local_offset],
+                      _keys.key(chunk_begin + chunk_offset) + segment.offset, width);
+        }
+      }
+      local_offset += width;
+    }
+  }
+
+  // sorts the rows [begin, end) of a chunk, using its local keys if it has any
+  void _sort_run(const ChunkID chunk_id, const size_t begin, const size_t end) {
+    const auto& local_keys = _local_keys[chunk_id];
+    const auto& keys = local_keys.width > 0 ? local_keys : _keys;
+    const auto key_index_base = local_keys.width > 0 ? _chunk_begins[chunk_id] : 0;
+
+    if (keys.is_exact() && keys.width <= sizeof(uint64_t)) {
+      std::vector<std::pair<uint64_t, size_t>> elements;
+      elements.reserve(end - begin);
+      for (auto index = begin; index < end; ++index) {
+        const auto key = keys.key(index - key_index_base);
+        uint64_t packed_key = 0;
+        for (size_t byte = 0; byte < keys.width; ++byte) packed_key = (packed_key << 8) | key[byte];
+        elements.emplace_back(packed_key, index);
+      }
+
+      radix_sort(elements);
+      for (auto index = begin; index < end; ++index) _order[index] = elements[index - begin].second;
+      return;
+    }
+
+    std::sort(_order.begin() + begin, _order.begin() + end,
+              [&](const size_t left, const size_t right) { return _less(keys, key_index_base, left, right); });
+  }
+
+  // Compares two rows by their keys, where equal string prefixes are followed by the full strings. Rows that are equal
+  // are ordered by their position.
+  bool _less(const Keys& keys, const size_t key_index_base, const size_t left, const size_t right) const {
+    const auto left_key = keys.key(left - key_index_base);
+    const auto right_key = keys.key(right - key_index_base);
+
+    size_t compared_bytes = 0;
+    for (const auto& string_prefix : keys.string_prefixes) {
+      const auto result =
+          std::memcmp(left_key + compared_bytes, right_key + compared_bytes, string_prefix.end - compared_bytes);
+      if (result != 0) return result < 0;
+      compared_bytes = string_prefix.end;
+
+      const auto& strings = _strings[string_prefix.string_index];
+      const auto string_result = strings[left].compare(strings[right]);
+      if (string_result != 0) return string_prefix.is_descending ? string_result > 0 : string_result < 0;
+    }
+
+    const auto result = std::memcmp(left_key + compared_bytes, right_key + compared_bytes, keys.width - compared_bytes);
+    if (result != 0) return result < 0;
+    return left < right;
+  }
+
+  const Table& _input;
+  const std::vector<SortColumnDefinition>& _sort_definitions;
+
+  // the rows of the input are numbered consecutively, chunk by chunk
+  std::vector<size_t> _chunk_begins;
+  std::vector<RowID> _row_ids;
+
+  std::vector<KeySegment> _segments;
+  Keys _keys;
+  std::vector<Keys> _local_keys;
+  std::vector<std::vector<std::string_view>> _strings;
+
+  std::vector<size_t> _order;
+};
+
+}  // namespace
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions)
+    : AbstractOperator(in), _sort_definitions{sort_definitions} {
+  Assert(!_sort_definitions.empty(), "Sort needs at least one column to sort by!");
+}
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input = _input_table_left();
+  const auto pos_list = SortImpl{*input, _sort_definitions}.execute();
+
+  auto output = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input->col_count(); ++column_id) {
+    output->add_column_definition(input->column_name(column_id), input->column_type(column_id));
+  }
+
+  auto chunk = Chunk{};
+  add_reference_columns(chunk, input, pos_list);
+  output->emplace_chunk(std::move(chunk));
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class OrderByMode { Ascending, Descending };
+
+struct SortColumnDefinition {
+  ColumnID column_id;
+  OrderByMode order_by_mode = OrderByMode::Ascending;
+};
+
+// Operator that sorts its input by one or more columns, the first definition being the most significant one. The
+// output is a single chunk of ReferenceColumns that share one PosList. NULL values (see NULL_ROW_ID) are greater than
+// all other values, i.e., they come last in ascending and first in descending order.
+//
+// The values of each row are normalized into a key that compares like the row under memcmp: numbers are stored
+// big-endian with their sign bit flipped, strings by their first bytes, and descending columns are inverted. Only
+// strings that share their prefix are compared in full. The rows are split into runs of about equal size, which are
+// sorted in parallel. Within a chunk, DictionaryColumns take part in the key with their ValueIDs, which are ordered
+// like the values, so strings of dictionary-encoded chunks are not looked at. Keys of up to eight bytes that need no
+// comparison of full strings are sorted by a radix sort, all others by comparisons. Finally, the sorted runs are merged
+// pairwise in parallel.
+class Sort : public AbstractOperator {
+ public:
+  Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+};
+
+}  // namespace opossum
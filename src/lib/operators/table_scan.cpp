@@ -0,0 +1,397 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/attribute_vector_scan.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/base_index.hpp"
+#include "storage/bloom_filter.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "storage/zone_map.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// An index is only used if at most this share of the chunk's rows matches. For less selective predicates, the matching
+// positions are scattered over the whole chunk and sorting them costs more than scanning the column sequentially.
+constexpr auto MAX_INDEX_SCAN_SELECTIVITY = 0.05;
+
+// Calls func with the comparison functor that corresponds to the scan type. This way, the scan loops are instantiated
+// once per comparison and do not have to switch on the scan type for every row.
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& func) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return func(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return func(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return func(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return func(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return func(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return func(std::greater_equal<>{});
+    default:
+      Fail("Unsupported scan type");
+  }
+}
+
+// Calls func(index, chunk_offset) for every row that is to be scanned. Without a selection, these are all rows of the
+// column and index equals chunk_offset. With a selection, only the listed offsets are visited and index is the position
+// within the selection.
+template <typename Functor>
+void for_each_offset(const size_t column_size, const std::vector<ChunkOffset>* selection, const Functor& func) {
+  if (selection == nullptr) {
+    for (ChunkOffset chunk_offset = 0; chunk_offset < column_size; ++chunk_offset) {
+      func(chunk_offset, chunk_offset);
+    }
+    return;
+  }
+
+  for (ChunkOffset index = 0; index < selection->size(); ++index) {
+    func(index, (*selection)[index]);
+  }
+}
+
+// A predicate on a dictionary column, translated into ValueIDs: a row matches if its ValueID lies within
+// [begin, end) - or outside of it, if the range is negated.
+struct ValueIDRange {
+  ValueID begin;
+  ValueID end;
+  bool negated;
+
+  bool matches_none(const ValueID unique_values_count) const {
+    return negated ? _is_full(unique_values_count) : _is_empty();
+  }
+
+  bool matches_all(const ValueID unique_values_count) const {
+    return negated ? _is_empty() : _is_full(unique_values_count);
+  }
+
+ private:
+  bool _is_empty() const { return begin >= end; }
+  bool _is_full(const ValueID unique_values_count) const { return begin == ValueID{0} && end >= unique_values_count; }
+};
+
+// Translates a predicate into a ValueIDRange, given the first ValueID whose value is not smaller than the search value
+// (lower_bound) and the first ValueID whose value is greater than it (upper_bound). Both may equal unique_values_count.
+ValueIDRange value_id_range(const ScanType scan_type, const ValueID lower_bound, const ValueID upper_bound,
+                            const ValueID unique_values_count) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return {lower_bound, upper_bound, false};
+    case ScanType::OpNotEquals:
+      return {lower_bound, upper_bound, true};
+    case ScanType::OpLessThan:
+      return {ValueID{0}, lower_bound, false};
+    case ScanType::OpLessThanEquals:
+      return {ValueID{0}, upper_bound, false};
+    case ScanType::OpGreaterThan:
+      return {upper_bound, unique_values_count, false};
+    case ScanType::OpGreaterThanEquals:
+      return {lower_bound, unique_values_count, false};
+    default:
+      Fail("Unsupported scan type");
+  }
+  return {ValueID{0}, ValueID{0}, false};
+}
+
+// TableScan resolves the column type only once per execution (see make_unique_by_column_type), so that all loops below
+// work on typed values instead of AllTypeVariants.
+template <typename T>
+class TableScanImpl : public BaseColumnScanImpl {
+ public:
+  TableScanImpl(const ScanType scan_type, const AllTypeVariant& search_value)
+      : _scan_type{scan_type},
+        _search_value{type_cast<T>(search_value)},
+        _search_variant{_search_value},
+        _search_value_hash{bloom_filter_hash(_search_value)} {}
+
+  bool can_prune_by_zone_map(const Chunk& chunk, const ColumnID column_id) const override {
+    const auto zone_map = std::dynamic_pointer_cast<const ZoneMap<T>>(chunk.zone_map(column_id));
+    return zone_map && zone_map->can_prune(_scan_type, _search_value);
+  }
+
+  // only equality predicates can be ruled out by a Bloom filter
+  bool can_prune_by_bloom_filter(const Chunk& chunk, const ColumnID column_id) const override {
+    if (_scan_type != ScanType::OpEquals) return false;
+    const auto bloom_filter = chunk.bloom_filter(column_id);
+    return bloom_filter && !bloom_filter->may_contain(_search_value_hash);
+  }
+
+  bool scan_chunk_with_index(const Chunk& chunk, const ColumnID column_id,
+                             std::vector<ChunkOffset>& matches) const override {
+    const auto indices = chunk.get_indices({column_id});
+    if (indices.empty()) return false;
+    const auto& index = *indices.front();
+
+    // the positions of all matching rows, as up to two ranges of the index
+    auto ranges = std::vector<std::pair<BaseIndex::Iterator, BaseIndex::Iterator>>{};
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        ranges.push_back(index.equal_range({_search_variant}));
+        break;
+      case ScanType::OpNotEquals:
+        ranges.emplace_back(index.cbegin(), index.lower_bound({_search_variant}));
+        ranges.emplace_back(index.upper_bound({_search_variant}), index.cend());
+        break;
+      case ScanType::OpLessThan:
+        ranges.emplace_back(index.cbegin(), index.lower_bound({_search_variant}));
+        break;
+      case ScanType::OpLessThanEquals:
+        ranges.emplace_back(index.cbegin(), index.upper_bound({_search_variant}));
+        break;
+      case ScanType::OpGreaterThan:
+        ranges.emplace_back(index.upper_bound({_search_variant}), index.cend());
+        break;
+      case ScanType::OpGreaterThanEquals:
+        ranges.emplace_back(index.lower_bound({_search_variant}), index.cend());
+        break;
+      default:
+        return false;
+    }
+
+    size_t match_count = 0;
+    for (const auto& range : ranges) match_count += static_cast<size_t>(range.second - range.first);
+    if (static_cast<double>(match_count) > MAX_INDEX_SCAN_SELECTIVITY * chunk.size()) return false;
+
+    // The index orders the positions by value, the output is expected in the order of the rows. Only the positions of
+    // a single value are already sorted.
+    const auto first_match = matches.size();
+    for (const auto& range : ranges) matches.insert(matches.end(), range.first, range.second);
+    if (_scan_type != ScanType::OpEquals) std::sort(matches.begin() + first_match, matches.end());
+    return true;
+  }
+
+  void scan_column(const BaseColumn& column, const std::vector<ChunkOffset>* selection,
+                   std::vector<ChunkOffset>& matches) const override {
+    if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+      _scan_value_column(*value_column, selection, matches);
+    } else if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+      _scan_dictionary_column(*dictionary_column, selection, matches);
+    } else if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+      _scan_run_length_column(*run_length_column, selection, matches);
+    } else {
+      // FrameOfReferenceColumns only exist for integral types
+      if constexpr (std::is_integral<T>::value) {
+        if (const auto frame_of_reference_column = dynamic_cast<const FrameOfReferenceColumn<T>*>(&column)) {
+          _scan_frame_of_reference_column(*frame_of_reference_column, selection, matches);
+          return;
+        }
+      }
+      Fail("Unsupported column type");
+    }
+  }
+
+ protected:
+  void _scan_value_column(const ValueColumn<T>& column, const std::vector<ChunkOffset>* selection,
+                          std::vector<ChunkOffset>& matches) const {
+    const auto& values = column.values();
+
+    // Strings are compared in the StringStorage, which decides most comparisons by the length and inline prefix
+    if constexpr (std::is_same<T, std::string>::value) {
+      if (_scan_type == ScanType::OpEquals || _scan_type == ScanType::OpNotEquals) {
+        const auto negated = _scan_type == ScanType::OpNotEquals;
+        for_each_offset(values.size(), selection, [&](const ChunkOffset index, const ChunkOffset chunk_offset) {
+          if (values.equals(chunk_offset, _search_value) != negated) matches.push_back(index);
+        });
+        return;
+      }
+
+      with_comparator(_scan_type, [&](auto comparator) {
+        for_each_offset(values.size(), selection, [&](const ChunkOffset index, const ChunkOffset chunk_offset) {
+          if (comparator(values.compare(chunk_offset, _search_value), 0)) matches.push_back(index);
+        });
+      });
+    } else {
+      with_comparator(_scan_type, [&](auto comparator) {
+        for_each_offset(values.size(), selection, [&](const ChunkOffset index, const ChunkOffset chunk_offset) {
+          if (comparator(values[chunk_offset], _search_value)) matches.push_back(index);
+        });
+      });
+    }
+  }
+
+  void _scan_dictionary_column(const DictionaryColumn<T>& column, const std::vector<ChunkOffset>* selection,
+                               std::vector<ChunkOffset>& matches) const {
+    const auto& attribute_vector = *column.attribute_vector();
+    const auto unique_values_count = ValueID{static_cast<ValueID::base_type>(column.unique_values_count())};
+    const auto range = _value_id_range(column);
+
+    if (range.matches_none(unique_values_count)) return;
+
+    if (range.matches_all(unique_values_count)) {
+      for_each_offset(attribute_vector.size(), selection,
+                      [&](const ChunkOffset index, const ChunkOffset) { matches.push_back(index); });
+      return;
+    }
+
+    if (selection == nullptr) {
+      scan_value_id_range_to_offsets(attribute_vector, range.begin, range.end, range.negated, matches);
+      return;
+    }
+
+    for_each_offset(attribute_vector.size(), selection, [&](const ChunkOffset index, const ChunkOffset chunk_offset) {
+      const auto value_id = attribute_vector.get(chunk_offset);
+      if ((value_id >= range.begin && value_id < range.end) != range.negated) matches.push_back(index);
+    });
+  }
+
+  // The predicate is evaluated only once per run. Without a selection, matching runs are emitted as a whole.
+  void _scan_run_length_column(const RunLengthColumn<T>& column, const std::vector<ChunkOffset>* selection,
+                               std::vector<ChunkOffset>& matches) const {
+    const auto& values = *column.values();
+    const auto& end_positions = *column.end_positions();
+
+    with_comparator(_scan_type, [&](auto comparator) {
+      if (selection == nullptr) {
+        ChunkOffset run_begin = 0;
+        for (size_t run = 0; run < values.size(); ++run) {
+          const auto run_end = end_positions[run];
+          if (comparator(values[run], _search_value)) {
+            for (auto chunk_offset = run_begin; chunk_offset <= run_end; ++chunk_offset) {
+              matches.push_back(chunk_offset);
+            }
+          }
+          run_begin = run_end + 1;
+        }
+        return;
+      }
+
+      // Selections are usually sorted, so the run of the previous offset is checked first. Only if the offset lies
+      // outside of it, the run is looked up via binary search.
+      ChunkOffset run_begin = 1;
+      ChunkOffset run_end = 0;
+      auto run_matches = false;
+      for_each_offset(column.size(), selection, [&](const ChunkOffset index, const ChunkOffset chunk_offset) {
+        if (chunk_offset < run_begin || chunk_offset > run_end) {
+          const auto run = column.run_index(chunk_offset);
+          run_begin = run == 0 ? 0 : end_positions[run - 1] + 1;
+          run_end = end_positions[run];
+          run_matches = comparator(values[run], _search_value);
+        }
+        if (run_matches) matches.push_back(index);
+      });
+    });
+  }
+
+  // Without a selection, the search value is translated into an offset range for each block, so that the bit-packed
+  // offsets can be compared without decompressing them, just like the ValueIDs of a dictionary column.
+  void _scan_frame_of_reference_column(const FrameOfReferenceColumn<T>& column,
+                                       const std::vector<ChunkOffset>* selection,
+                                       std::vector<ChunkOffset>& matches) const {
+    if (selection != nullptr) {
+      with_comparator(_scan_type, [&](auto comparator) {
+        for_each_offset(column.size(), selection, [&](const ChunkOffset index, const ChunkOffset chunk_offset) {
+          if (comparator(column.get(chunk_offset), _search_value)) matches.push_back(index);
+        });
+      });
+      return;
+    }
+
+    const auto& block_minimums = *column.block_minimums();
+    const auto& offsets = *column.offsets();
+
+    // All offsets are smaller than offset_count. Offsets never reach INVALID_VALUE_ID, so offset_count fits a ValueID.
+    const auto offset_count = ValueID{static_cast<ValueID::base_type>(
+        std::min(uint64_t{1} << offsets.bit_width(), static_cast<uint64_t>(INVALID_VALUE_ID)))};
+
+    for (size_t block = 0; block < block_minimums.size(); ++block) {
+      const auto block_begin = block * FrameOfReferenceColumn<T>::BLOCK_SIZE;
+      const auto block_end = std::min(column.size(), block_begin + FrameOfReferenceColumn<T>::BLOCK_SIZE);
+
+      // If the search value lies outside of the block's frame, the bounds are both 0 or both offset_count
+      auto lower_bound = offset_count;
+      auto upper_bound = offset_count;
+      if (_search_value < block_minimums[block]) {
+        lower_bound = ValueID{0};
+        upper_bound = ValueID{0};
+      } else {
+        const auto search_offset =
+            static_cast<uint64_t>(_search_value) - static_cast<uint64_t>(block_minimums[block]);
+        if (search_offset < static_cast<uint64_t>(offset_count)) {
+          lower_bound = ValueID{static_cast<ValueID::base_type>(search_offset)};
+          upper_bound = ValueID{static_cast<ValueID::base_type>(search_offset + 1)};
+        }
+      }
+
+      const auto range = value_id_range(_scan_type, lower_bound, upper_bound, offset_count);
+      if (range.matches_none(offset_count)) continue;
+
+      if (range.matches_all(offset_count)) {
+        for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+          matches.push_back(static_cast<ChunkOffset>(chunk_offset));
+        }
+        continue;
+      }
+
+      scan_value_id_range_to_offsets(offsets, block_begin, block_end, range.begin, range.end, range.negated, matches);
+    }
+  }
+
+  ValueIDRange _value_id_range(const DictionaryColumn<T>& column) const {
+    const auto unique_values_count = ValueID{static_cast<ValueID::base_type>(column.unique_values_count())};
+
+    // INVALID_VALUE_ID means that all values are smaller than the search value, i.e., the bound is the end of the
+    // dictionary
+    auto lower_bound = column.lower_bound(_search_value);
+    if (lower_bound == INVALID_VALUE_ID) lower_bound = unique_values_count;
+    auto upper_bound = column.upper_bound(_search_value);
+    if (upper_bound == INVALID_VALUE_ID) upper_bound = unique_values_count;
+
+    return value_id_range(_scan_type, lower_bound, upper_bound, unique_values_count);
+  }
+
+  const ScanType _scan_type;
+  const T _search_value;
+  const AllTypeVariant _search_variant;
+  const size_t _search_value_hash;
+};
+
+std::vector<ColumnID> column_ids(const std::vector<ScanPredicate>& predicates) {
+  Assert(!predicates.empty(), "TableScan needs at least one predicate!");
+  std::vector<ColumnID> column_ids;
+  for (const auto& predicate : predicates) column_ids.push_back(predicate.column_id);
+  return column_ids;
+}
+
+}  // namespace
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value)
+    : TableScan(in, {ScanPredicate{column_id, scan_type, search_value}}) {}
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, const std::vector<ScanPredicate>& predicates)
+    : AbstractScanOperator(in, column_ids(predicates)), _predicates{predicates} {}
+
+ScanType TableScan::scan_type() const { return _predicates.front().scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _predicates.front().search_value; }
+
+const std::vector<ScanPredicate>& TableScan::predicates() const { return _predicates; }
+
+const std::vector<size_t>& TableScan::predicate_order() const { return _predicate_order; }
+
+std::unique_ptr<BaseColumnScanImpl> TableScan::_create_impl(const Table& table_in, const size_t predicate_index) const {
+  const auto& predicate = _predicates[predicate_index];
+  return make_unique_by_column_type<BaseColumnScanImpl, TableScanImpl>(table_in.column_type(predicate.column_id),
+                                                                       predicate.scan_type, predicate.search_value);
+}
+
+}  // namespace opossum
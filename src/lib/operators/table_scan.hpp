@@ -5,29 +5,45 @@
 #include <string>
 #include <vector>
 
-#include "abstract_operator.hpp"
+#include "abstract_scan_operator.hpp"
 #include "all_type_variant.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-class BaseTableScanImpl;
 class Table;
 
-class TableScan : public AbstractOperator {
+// A comparison of a column with a search value: "value <scan_type> search_value"
+struct ScanPredicate {
+  ColumnID column_id;
+  ScanType scan_type;
+  AllTypeVariant search_value;
+};
+
+// Operator that filters a table by comparing one of its columns with a search value, or by a conjunction of such
+// predicates. Pruning, index use, and the evaluation of multiple predicates are described in AbstractScanOperator.
+class TableScan : public AbstractScanOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
             const AllTypeVariant search_value);
 
-  ~TableScan();
+  TableScan(const std::shared_ptr<const AbstractOperator> in, const std::vector<ScanPredicate>& predicates);
 
-  ColumnID column_id() const;
+  // the scan type and search value of the first predicate
   ScanType scan_type() const;
   const AllTypeVariant& search_value() const;
 
+  const std::vector<ScanPredicate>& predicates() const;
+
+  // returns the order in which the predicates were evaluated for the last chunk of the last execution, as indices
+  // into predicates()
+  const std::vector<size_t>& predicate_order() const;
+
  protected:
-  std::shared_ptr<const Table> _on_execute() override;
+  std::unique_ptr<BaseColumnScanImpl> _create_impl(const Table& table_in, const size_t predicate_index) const override;
+
+  const std::vector<ScanPredicate> _predicates;
 };
 
 }  // namespace opossum
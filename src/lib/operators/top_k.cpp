@@ -0,0 +1,217 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/column_iteration.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/zone_map.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr size_t MIN_ROWS_PER_THREAD = 10'000;
+
+// only ReferenceColumns can hold NULL values, see NULL_ROW_ID
+bool is_null(const BaseColumn& column, const ChunkOffset chunk_offset) {
+  const auto reference_column = dynamic_cast<const ReferenceColumn*>(&column);
+  return reference_column && (*reference_column->pos_list())[chunk_offset] == NULL_ROW_ID;
+}
+
+// T is the type of the first sort column
+template <typename T>
+class TopKImpl {
+ public:
+  TopKImpl(const Table& input, const std::vector<SortColumnDefinition>& sort_definitions, const size_t k)
+      : _input{input}, _sort_definitions{sort_definitions}, _k{k} {}
+
+  std::shared_ptr<PosList> execute() {
+    auto pos_list = std::make_shared<PosList>();
+    if (_k == 0) return pos_list;
+
+    // chunks without zone map come first, then the others by their best value. Chunks without columns are skipped.
+    std::vector<ChunkID> chunk_ids;
+    for (ChunkID chunk_id{0}; chunk_id < _input.chunk_count(); ++chunk_id) {
+      if (_input.get_chunk(chunk_id).col_count() > 0) chunk_ids.push_back(chunk_id);
+    }
+    if (chunk_ids.empty()) return pos_list;
+    std::stable_sort(chunk_ids.begin(), chunk_ids.end(), [&](const ChunkID left, const ChunkID right) {
+      const auto left_zone_map = _zone_map(left);
+      const auto right_zone_map = _zone_map(right);
+      if (!left_zone_map || !right_zone_map) return !left_zone_map && right_zone_map;
+      return _compare_first(false, _best_value(*left_zone_map), false, _best_value(*right_zone_map)) < 0;
+    });
+
+    const auto thread_count =
+        std::min(chunk_ids.size(), parallel_thread_count(_input.row_count(), MIN_ROWS_PER_THREAD));
+    std::vector<Heap> heaps(thread_count, Heap{[&](const Candidate& left, const Candidate& right) {
+                                                 return _less(left, right);
+                                               }});
+
+    // each thread visits every thread_count-th chunk, so that all threads start with chunks of good rows
+    parallel_for_each_range(thread_count, thread_count, [&](const size_t, const size_t begin, const size_t end) {
+      for (auto thread_index = begin; thread_index < end; ++thread_index) {
+        auto& heap = heaps[thread_index];
+        for (auto index = thread_index; index < chunk_ids.size(); index += thread_count) {
+          const auto zone_map = _zone_map(chunk_ids[index]);
+          if (zone_map && heap.size() == _k &&
+              _compare_first(false, _best_value(*zone_map), heap.top().is_null, heap.top().value) > 0) {
+            break;
+          }
+          _add_chunk(chunk_ids[index], heap);
+        }
+      }
+    });
+
+    std::vector<Candidate> candidates;
+    for (auto& heap : heaps) {
+      for (; !heap.empty(); heap.pop()) candidates.push_back(heap.top());
+    }
+    const auto output_size = std::min(_k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + output_size, candidates.end(),
+                      [&](const Candidate& left, const Candidate& right) { return _less(left, right); });
+
+    pos_list->reserve(output_size);
+    for (size_t index = 0; index < output_size; ++index) pos_list->push_back(candidates[index].row_id);
+    return pos_list;
+  }
+
+ protected:
+  struct Candidate {
+    RowID row_id;
+    bool is_null;
+    T value;
+    // the values of the other sort columns, std::nullopt for NULL values
+    std::vector<std::optional<AllTypeVariant>> other_values;
+  };
+
+  // the worst candidate is on top
+  using Heap = std::priority_queue<Candidate, std::vector<Candidate>,
+                                   std::function<bool(const Candidate&, const Candidate&)>>;
+
+  // returns the zone map of the first sort column in a chunk, or nullptr if there is none or it is empty
+  std::shared_ptr<const ZoneMap<T>> _zone_map(const ChunkID chunk_id) const {
+    const auto& chunk = _input.get_chunk(chunk_id);
+    auto zone_map = std::dynamic_pointer_cast<const ZoneMap<T>>(chunk.zone_map(_sort_definitions[0].column_id));
+    return zone_map && !zone_map->is_empty() ? zone_map : nullptr;
+  }
+
+  const T& _best_value(const ZoneMap<T>& zone_map) const {
+    return _sort_definitions[0].order_by_mode == OrderByMode::Descending ? zone_map.typed_max() : zone_map.typed_min();
+  }
+
+  // Returns a negative number if the first value comes first in the output, a positive one if the second one does.
+  template <typename Value>
+  int _compare_first(const bool left_is_null, const Value& left, const bool right_is_null, const T& right) const {
+    auto result = 0;
+    if (left_is_null || right_is_null) {
+      result = left_is_null - right_is_null;
+    } else {
+      result = left < right ? -1 : right < left ? 1 : 0;
+    }
+    return _sort_definitions[0].order_by_mode == OrderByMode::Descending ? -result : result;
+  }
+
+  bool _less(const Candidate& left, const Candidate& right) const {
+    auto result = _compare_first(left.is_null, left.value, right.is_null, right.value);
+    for (size_t index = 0; result == 0 && index < left.other_values.size(); ++index) {
+      const auto& left_value = left.other_values[index];
+      const auto& right_value = right.other_values[index];
+      if (!left_value || !right_value) {
+        result = !left_value - !right_value;
+      } else {
+        result = *left_value < *right_value ? -1 : *right_value < *left_value ? 1 : 0;
+      }
+      if (_sort_definitions[index + 1].order_by_mode == OrderByMode::Descending) result = -result;
+    }
+    if (result != 0) return result < 0;
+    return left.row_id < right.row_id;
+  }
+
+  void _add_chunk(const ChunkID chunk_id, Heap& heap) const {
+    const auto& chunk = _input.get_chunk(chunk_id);
+    const auto& column = *chunk.get_column(_sort_definitions[0].column_id);
+
+    const auto add_row = [&](const ChunkOffset chunk_offset, const bool row_is_null, const auto& value) {
+      // rows with the same first value as the worst one are decided by the other columns
+      if (heap.size() == _k && _compare_first(row_is_null, value, heap.top().is_null, heap.top().value) > 0) return;
+
+      auto candidate = Candidate{RowID{chunk_id, chunk_offset}, row_is_null, row_is_null ? T{} : T{value}, {}};
+      for (size_t index = 1; index < _sort_definitions.size(); ++index) {
+        const auto& other_column = *chunk.get_column(_sort_definitions[index].column_id);
+        candidate.other_values.push_back(
+            is_null(other_column, chunk_offset) ? std::nullopt : std::optional{other_column[chunk_offset]});
+      }
+
+      if (heap.size() < _k) {
+        heap.push(std::move(candidate));
+      } else if (_less(candidate, heap.top())) {
+        heap.pop();
+        heap.push(std::move(candidate));
+      }
+    };
+
+    for_each_value<T>(column, [&](const ChunkOffset chunk_offset, const ValueView<T>& value) {
+      add_row(chunk_offset, false, value);
+    });
+    if (const auto reference_column = dynamic_cast<const ReferenceColumn*>(&column)) {
+      const auto& pos_list = *reference_column->pos_list();
+      for (ChunkOffset chunk_offset = 0; chunk_offset < pos_list.size(); ++chunk_offset) {
+        if (pos_list[chunk_offset] == NULL_ROW_ID) add_row(chunk_offset, true, T{});
+      }
+    }
+  }
+
+  const Table& _input;
+  const std::vector<SortColumnDefinition>& _sort_definitions;
+  const size_t _k;
+};
+
+}  // namespace
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t k)
+    : AbstractOperator(in), _sort_definitions{sort_definitions}, _k{k} {
+  Assert(!_sort_definitions.empty(), "TopK needs at least one column to sort by!");
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+size_t TopK::k() const { return _k; }
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input = _input_table_left();
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column_id < input->col_count(), "Sort column ID out of range!");
+  }
+
+  std::shared_ptr<PosList> pos_list;
+  resolve_data_type(input->column_type(_sort_definitions[0].column_id), [&](auto type) {
+    using Type = typename decltype(type)::type;
+    pos_list = TopKImpl<Type>{*input, _sort_definitions, _k}.execute();
+  });
+
+  auto output = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input->col_count(); ++column_id) {
+    output->add_column_definition(input->column_name(column_id), input->column_type(column_id));
+  }
+
+  auto chunk = Chunk{};
+  add_reference_columns(chunk, input, pos_list);
+  output->emplace_chunk(std::move(chunk));
+
+  return output;
+}
+
+}  // namespace opossum
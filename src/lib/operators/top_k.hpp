@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "operators/sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that outputs the first k rows its input would have after a Sort by the same definitions, in sorted order,
+// without sorting the whole input. Like for Sort, the output is a single chunk of ReferenceColumns, NULL values are
+// greater than all other values, and equal rows keep their order.
+//
+// The chunks are distributed among threads, each of which keeps the best k rows it has seen in a heap. The rows of the
+// heaps are merged at the end. Only the first sort column is looked at for most rows: a row whose value is worse than
+// that of the worst row in the heap is skipped. The zone maps of the first sort column let the threads skip whole
+// chunks. As each thread visits its chunks with the best zone map bounds first, it stops as soon as a chunk can be
+// skipped, because all chunks after it can be skipped as well.
+class TopK : public AbstractOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t k);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  size_t k() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const size_t _k;
+};
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#include "union_positions.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace opossum {
+
+UnionPositions::UnionPositions(const std::shared_ptr<const AbstractOperator> left,
+                               const std::shared_ptr<const AbstractOperator> right)
+    : AbstractPositionsOperator(left, right) {}
+
+void UnionPositions::_merge(const std::vector<ChunkOffset>& left_offsets,
+                            const std::vector<ChunkOffset>& right_offsets, std::vector<ChunkOffset>& offsets) const {
+  std::set_union(left_offsets.cbegin(), left_offsets.cend(), right_offsets.cbegin(), right_offsets.cend(),
+                 std::back_inserter(offsets));
+}
+
+void UnionPositions::_combine_bitmaps(std::vector<uint8_t>& left_bitmap,
+                                      const std::vector<uint8_t>& right_bitmap) const {
+  for (size_t index = 0; index < left_bitmap.size(); ++index) left_bitmap[index] |= right_bitmap[index];
+}
+
+}  // namespace opossum
@@ -0,0 +1,497 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "column_iteration.hpp"
+#include "dictionary_column.hpp"
+#include "frame_of_reference_column.hpp"
+#include "resolve_type.hpp"
+#include "run_length_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+class ARTNode {
+ public:
+  enum class Type : uint8_t { Leaf, Node4, Node16, Node48, Node256 };
+
+  explicit ARTNode(const Type init_type) : type{init_type} {}
+  virtual ~ARTNode() = default;
+
+  const Type type;
+};
+
+class ARTLeaf : public ARTNode {
+ public:
+  ARTLeaf(std::string init_key, const ChunkOffset chunk_offset)
+      : ARTNode{Type::Leaf}, key{std::move(init_key)}, positions{chunk_offset} {}
+
+  const std::string key;
+  // rows are inserted in ascending order, so the positions are sorted
+  std::vector<ChunkOffset> positions;
+};
+
+class ARTInnerNode : public ARTNode {
+ public:
+  using ARTNode::ARTNode;
+
+  // the key bytes that all leaves below this node share after the byte that leads to it (path compression)
+  std::string prefix;
+  uint16_t child_count = 0;
+};
+
+// Node4 and Node16 store the bytes that lead to their children in ascending order and are searched linearly
+template <size_t capacity>
+class ARTSortedNode : public ARTInnerNode {
+ public:
+  ARTSortedNode() : ARTInnerNode{capacity == 4 ? Type::Node4 : Type::Node16} {}
+
+  std::array<uint8_t, capacity> keys{};
+  std::array<std::unique_ptr<ARTNode>, capacity> children;
+};
+
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
+
+class ARTNode48 : public ARTInnerNode {
+ public:
+  ARTNode48() : ARTInnerNode{Type::Node48} {}
+
+  // child_indices[byte] is the index of the byte's child plus one, or zero if there is none
+  std::array<uint8_t, 256> child_indices{};
+  std::array<std::unique_ptr<ARTNode>, 48> children;
+};
+
+class ARTNode256 : public ARTInnerNode {
+ public:
+  ARTNode256() : ARTInnerNode{Type::Node256} {}
+
+  std::array<std::unique_ptr<ARTNode>, 256> children;
+};
+
+namespace {
+
+// Appends the binary-comparable encoding of a value to a key. Numbers are stored big-endian with the sign bit flipped,
+// negative floating-point numbers additionally have all other bits flipped. Strings are terminated by two zero bytes,
+// zero bytes within them are followed by 0xFF. This way, no key is a prefix of another key.
+// The value is passed as ValueView<T>, i.e., std::string_view for strings, as for_each_value passes it.
+template <typename T>
+void append_key_part(const ValueView<T>& value, std::string& key) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    for (const auto character : value) {
+      key.push_back(character);
+      if (character == '\0') key.push_back('\xFF');
+    }
+    key.append(2, '\0');
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(T) * 8 - 1);
+
+    Bits bits;
+    if constexpr (std::is_floating_point<T>::value) {
+      // -0.0 equals 0.0, so both get the same key
+      const auto normalized = value == T{0} ? T{0} : value;
+      std::memcpy(&bits, &normalized, sizeof(bits));
+      bits = (bits & sign_bit) ? ~bits : bits | sign_bit;
+    } else {
+      bits = static_cast<Bits>(value) ^ sign_bit;
+    }
+
+    for (auto shift = static_cast<int>(sizeof(T) * 8) - 8; shift >= 0; shift -= 8) {
+      key.push_back(static_cast<char>(bits >> shift));
+    }
+  }
+}
+
+template <typename T>
+void append_variant_key_part(const AllTypeVariant& variant, std::string& key) {
+  append_key_part<T>(type_cast<T>(variant), key);
+}
+
+template <typename T>
+bool is_column_of_type(const BaseColumn& column) {
+  if (dynamic_cast<const ValueColumn<T>*>(&column) || dynamic_cast<const DictionaryColumn<T>*>(&column) ||
+      dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+    return true;
+  }
+  if constexpr (std::is_integral<T>::value) {
+    return dynamic_cast<const FrameOfReferenceColumn<T>*>(&column) != nullptr;
+  }
+  return false;
+}
+
+// returns the child that the given byte leads to, or nullptr
+const std::unique_ptr<ARTNode>* find_child(const ARTInnerNode& node, const uint8_t byte) {
+  switch (node.type) {
+    case ARTNode::Type::Node4: {
+      const auto& node4 = static_cast<const ARTNode4&>(node);
+      for (auto index = 0; index < node4.child_count; ++index) {
+        if (node4.keys[index] == byte) return &node4.children[index];
+      }
+      return nullptr;
+    }
+    case ARTNode::Type::Node16: {
+      const auto& node16 = static_cast<const ARTNode16&>(node);
+      for (auto index = 0; index < node16.child_count; ++index) {
+        if (node16.keys[index] == byte) return &node16.children[index];
+      }
+      return nullptr;
+    }
+    case ARTNode::Type::Node48: {
+      const auto& node48 = static_cast<const ARTNode48&>(node);
+      const auto index = node48.child_indices[byte];
+      return index == 0 ? nullptr : &node48.children[index - 1];
+    }
+    case ARTNode::Type::Node256: {
+      const auto& child = static_cast<const ARTNode256&>(node).children[byte];
+      return child ? &child : nullptr;
+    }
+    default:
+      Fail("Leaves have no children");
+  }
+  return nullptr;
+}
+
+// calls func for every child of the node in the order of the bytes that lead to them
+template <typename Functor>
+void for_each_child(const ARTInnerNode& node, const Functor& func) {
+  switch (node.type) {
+    case ARTNode::Type::Node4: {
+      const auto& node4 = static_cast<const ARTNode4&>(node);
+      for (auto index = 0; index < node4.child_count; ++index) func(*node4.children[index]);
+      return;
+    }
+    case ARTNode::Type::Node16: {
+      const auto& node16 = static_cast<const ARTNode16&>(node);
+      for (auto index = 0; index < node16.child_count; ++index) func(*node16.children[index]);
+      return;
+    }
+    case ARTNode::Type::Node48: {
+      const auto& node48 = static_cast<const ARTNode48&>(node);
+      for (const auto index : node48.child_indices) {
+        if (index != 0) func(*node48.children[index - 1]);
+      }
+      return;
+    }
+    case ARTNode::Type::Node256: {
+      for (const auto& child : static_cast<const ARTNode256&>(node).children) {
+        if (child) func(*child);
+      }
+      return;
+    }
+    default:
+      Fail("Leaves have no children");
+  }
+}
+
+// returns a copy of a full node with the next larger capacity
+std::unique_ptr<ARTNode> grow(ARTInnerNode& node) {
+  std::unique_ptr<ARTInnerNode> grown;
+
+  switch (node.type) {
+    case ARTNode::Type::Node4: {
+      auto& node4 = static_cast<ARTNode4&>(node);
+      auto node16 = std::make_unique<ARTNode16>();
+      for (auto index = 0; index < node4.child_count; ++index) {
+        node16->keys[index] = node4.keys[index];
+        node16->children[index] = std::move(node4.children[index]);
+      }
+      grown = std::move(node16);
+      break;
+    }
+    case ARTNode::Type::Node16: {
+      auto& node16 = static_cast<ARTNode16&>(node);
+      auto node48 = std::make_unique<ARTNode48>();
+      for (auto index = 0; index < node16.child_count; ++index) {
+        node48->child_indices[node16.keys[index]] = static_cast<uint8_t>(index + 1);
+        node48->children[index] = std::move(node16.children[index]);
+      }
+      grown = std::move(node48);
+      break;
+    }
+    case ARTNode::Type::Node48: {
+      auto& node48 = static_cast<ARTNode48&>(node);
+      auto node256 = std::make_unique<ARTNode256>();
+      for (size_t byte = 0; byte < node48.child_indices.size(); ++byte) {
+        const auto index = node48.child_indices[byte];
+        if (index != 0) node256->children[byte] = std::move(node48.children[index - 1]);
+      }
+      grown = std::move(node256);
+      break;
+    }
+    default:
+      Fail("Node cannot grow");
+  }
+
+  grown->prefix = std::move(node.prefix);
+  grown->child_count = node.child_count;
+  return grown;
+}
+
+// adds a child to the inner node in slot, which is replaced by a larger node if it is full
+void add_child(std::unique_ptr<ARTNode>& slot, const uint8_t byte, std::unique_ptr<ARTNode> child) {
+  auto* node = static_cast<ARTInnerNode*>(slot.get());
+  const auto is_full = (node->type == ARTNode::Type::Node4 && node->child_count == 4) ||
+                       (node->type == ARTNode::Type::Node16 && node->child_count == 16) ||
+                       (node->type == ARTNode::Type::Node48 && node->child_count == 48);
+  if (is_full) {
+    slot = grow(*node);
+    node = static_cast<ARTInnerNode*>(slot.get());
+  }
+
+  const auto add_sorted = [&](auto& sorted_node) {
+    auto index = sorted_node.child_count;
+    for (; index > 0 && sorted_node.keys[index - 1] > byte; --index) {
+      sorted_node.keys[index] = sorted_node.keys[index - 1];
+      sorted_node.children[index] = std::move(sorted_node.children[index - 1]);
+    }
+    sorted_node.keys[index] = byte;
+    sorted_node.children[index] = std::move(child);
+  };
+
+  switch (node->type) {
+    case ARTNode::Type::Node4:
+      add_sorted(static_cast<ARTNode4&>(*node));
+      break;
+    case ARTNode::Type::Node16:
+      add_sorted(static_cast<ARTNode16&>(*node));
+      break;
+    case ARTNode::Type::Node48: {
+      // children are never removed, so the slots are filled in order
+      auto& node48 = static_cast<ARTNode48&>(*node);
+      node48.children[node48.child_count] = std::move(child);
+      node48.child_indices[byte] = static_cast<uint8_t>(node48.child_count + 1);
+      break;
+    }
+    case ARTNode::Type::Node256:
+      static_cast<ARTNode256&>(*node).children[byte] = std::move(child);
+      break;
+    default:
+      Fail("Leaves have no children");
+  }
+  ++node->child_count;
+}
+
+// replaces the node in slot by a Node4 with the given prefix that holds the node and a new leaf
+void split(std::unique_ptr<ARTNode>& slot, std::string prefix, const uint8_t node_byte, std::string key,
+           const uint8_t key_byte, const ChunkOffset chunk_offset) {
+  auto node4 = std::make_unique<ARTNode4>();
+  node4->prefix = std::move(prefix);
+  std::unique_ptr<ARTNode> new_node = std::move(node4);
+  add_child(new_node, node_byte, std::move(slot));
+  add_child(new_node, key_byte, std::make_unique<ARTLeaf>(std::move(key), chunk_offset));
+  slot = std::move(new_node);
+}
+
+void insert_key(std::unique_ptr<ARTNode>& root, std::string key, const ChunkOffset chunk_offset) {
+  auto* slot = &root;
+  size_t depth = 0;
+
+  while (true) {
+    auto& node = *slot;
+    if (!node) {
+      node = std::make_unique<ARTLeaf>(std::move(key), chunk_offset);
+      return;
+    }
+
+    if (node->type == ARTNode::Type::Leaf) {
+      auto& leaf = static_cast<ARTLeaf&>(*node);
+      if (leaf.key == key) {
+        leaf.positions.push_back(chunk_offset);
+        return;
+      }
+
+      // no key is a prefix of another, so the keys differ before either ends
+      auto mismatch = depth;
+      while (leaf.key[mismatch] == key[mismatch]) ++mismatch;
+      const auto leaf_byte = static_cast<uint8_t>(leaf.key[mismatch]);
+      const auto key_byte = static_cast<uint8_t>(key[mismatch]);
+      auto prefix = key.substr(depth, mismatch - depth);
+      split(node, std::move(prefix), leaf_byte, std::move(key), key_byte, chunk_offset);
+      return;
+    }
+
+    auto& inner = static_cast<ARTInnerNode&>(*node);
+    size_t matched = 0;
+    while (matched < inner.prefix.size() && inner.prefix[matched] == key[depth + matched]) ++matched;
+
+    if (matched < inner.prefix.size()) {
+      // the key leaves the compressed path, so the path is split where it does
+      const auto inner_byte = static_cast<uint8_t>(inner.prefix[matched]);
+      const auto key_byte = static_cast<uint8_t>(key[depth + matched]);
+      auto prefix = inner.prefix.substr(0, matched);
+      inner.prefix.erase(0, matched + 1);
+      split(node, std::move(prefix), inner_byte, std::move(key), key_byte, chunk_offset);
+      return;
+    }
+
+    depth += matched;
+    const auto byte = static_cast<uint8_t>(key[depth]);
+    const auto child = find_child(inner, byte);
+    if (!child) {
+      add_child(node, byte, std::make_unique<ARTLeaf>(std::move(key), chunk_offset));
+      return;
+    }
+
+    // the node is not const, so neither are its children
+    slot = const_cast<std::unique_ptr<ARTNode>*>(child);
+    ++depth;
+  }
+}
+
+void collect_leaves(const ARTNode& node, std::vector<const ARTLeaf*>& leaves) {
+  if (node.type == ARTNode::Type::Leaf) {
+    leaves.push_back(static_cast<const ARTLeaf*>(&node));
+    return;
+  }
+  for_each_child(static_cast<const ARTInnerNode&>(node),
+                 [&](const ARTNode& child) { collect_leaves(child, leaves); });
+}
+
+}  // namespace
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns) {
+  Assert(!index_columns.empty(), "AdaptiveRadixTreeIndex requires at least one column!");
+
+  // The keys are built column by column from the typed values, without an AllTypeVariant per value
+  std::vector<Key> keys(index_columns.front()->size());
+  for (const auto& column : index_columns) {
+    Assert(column->size() == keys.size(), "Indexed columns must have the same size!");
+
+    void (*key_part_encoder)(const AllTypeVariant&, Key&) = nullptr;
+    hana::for_each(types, [&](auto type) {
+      using Type = typename decltype(type)::type;
+      if (key_part_encoder || !is_column_of_type<Type>(*column)) return;
+
+      key_part_encoder = &append_variant_key_part<Type>;
+      for_each_value<Type>(*column, [&](const ChunkOffset chunk_offset, const ValueView<Type>& value) {
+        append_key_part<Type>(value, keys[chunk_offset]);
+      });
+    });
+    Assert(key_part_encoder != nullptr, "AdaptiveRadixTreeIndex does not support this column type!");
+
+    _index_columns.push_back(column);
+    _key_part_encoders.push_back(key_part_encoder);
+  }
+
+  for (size_t chunk_offset = 0; chunk_offset < keys.size(); ++chunk_offset) {
+    insert_key(_root, std::move(keys[chunk_offset]), static_cast<ChunkOffset>(chunk_offset));
+  }
+}
+
+AdaptiveRadixTreeIndex::~AdaptiveRadixTreeIndex() = default;
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  _materialize();
+  const auto key = _encode_key(values);
+  const auto leaf_it =
+      std::lower_bound(_sorted_leaves.cbegin(), _sorted_leaves.cend(), key,
+                       [](const ARTLeaf* leaf, const Key& search_key) { return leaf->key < search_key; });
+  return _positions.cbegin() + _leaf_offsets[leaf_it - _sorted_leaves.cbegin()];
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  _materialize();
+  // leaves whose key starts with the search key are not greater than it
+  const auto key = _encode_key(values);
+  const auto leaf_it = std::upper_bound(_sorted_leaves.cbegin(), _sorted_leaves.cend(), key,
+                                        [](const Key& search_key, const ARTLeaf* leaf) {
+                                          return leaf->key.compare(0, search_key.size(), search_key) > 0;
+                                        });
+  return _positions.cbegin() + _leaf_offsets[leaf_it - _sorted_leaves.cbegin()];
+}
+
+std::pair<BaseIndex::Iterator, BaseIndex::Iterator> AdaptiveRadixTreeIndex::_equal_range(
+    const std::vector<AllTypeVariant>& values) const {
+  if (values.size() < _key_part_encoders.size()) return {_lower_bound(values), _upper_bound(values)};
+
+  static const auto no_positions = std::vector<ChunkOffset>{};
+  const auto leaf = _find_leaf(_encode_key(values));
+  if (!leaf) return {no_positions.cbegin(), no_positions.cend()};
+  return {leaf->positions.cbegin(), leaf->positions.cend()};
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const {
+  _materialize();
+  return _positions.cbegin();
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cend() const {
+  _materialize();
+  return _positions.cend();
+}
+
+std::vector<std::shared_ptr<const BaseColumn>> AdaptiveRadixTreeIndex::_get_index_columns() const {
+  std::vector<std::shared_ptr<const BaseColumn>> index_columns;
+  for (const auto& column : _index_columns) index_columns.push_back(column.lock());
+  return index_columns;
+}
+
+void AdaptiveRadixTreeIndex::_insert(const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values) {
+  Assert(values.size() == _key_part_encoders.size(), "Number of values does not match the indexed columns!");
+  insert_key(_root, _encode_key(values), chunk_offset);
+  _is_materialized = false;
+}
+
+AdaptiveRadixTreeIndex::Key AdaptiveRadixTreeIndex::_encode_key(const std::vector<AllTypeVariant>& values) const {
+  Key key;
+  for (size_t column_index = 0; column_index < values.size(); ++column_index) {
+    _key_part_encoders[column_index](values[column_index], key);
+  }
+  return key;
+}
+
+const ARTLeaf* AdaptiveRadixTreeIndex::_find_leaf(const Key& key) const {
+  const ARTNode* node = _root.get();
+  size_t depth = 0;
+
+  while (node) {
+    if (node->type == ARTNode::Type::Leaf) {
+      const auto leaf = static_cast<const ARTLeaf*>(node);
+      return leaf->key == key ? leaf : nullptr;
+    }
+
+    const auto& inner = static_cast<const ARTInnerNode&>(*node);
+    if (key.compare(depth, inner.prefix.size(), inner.prefix) != 0) return nullptr;
+    depth += inner.prefix.size();
+    if (depth >= key.size()) return nullptr;
+
+    const auto child = find_child(inner, static_cast<uint8_t>(key[depth]));
+    node = child ? child->get() : nullptr;
+    ++depth;
+  }
+  return nullptr;
+}
+
+void AdaptiveRadixTreeIndex::_materialize() const {
+  if (_is_materialized) return;
+
+  std::lock_guard<std::mutex> lock(_materialize_mutex);
+  if (_is_materialized) return;
+
+  _sorted_leaves.clear();
+  _leaf_offsets.clear();
+  _positions.clear();
+  if (_root) collect_leaves(*_root, _sorted_leaves);
+
+  for (const auto leaf : _sorted_leaves) {
+    _leaf_offsets.push_back(_positions.size());
+    _positions.insert(_positions.end(), leaf->positions.cbegin(), leaf->positions.cend());
+  }
+  // the end of the last leaf, so that a lookup past all leaves yields cend()
+  _leaf_offsets.push_back(_positions.size());
+
+  _is_materialized = true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ARTNode;
+class ARTLeaf;
+
+// An adaptive radix tree (Leis et al., "The Adaptive Radix Tree: ARTful Indexing for Main-Memory Databases") over one
+// or more columns of any type and encoding. Each row's values are encoded into a binary-comparable key, i.e., a byte
+// string whose order equals the order of the values. The inner nodes hold 4, 16, 48, or 256 children depending on
+// how many distinct bytes follow them, and common key segments are stored only once (path compression). Each leaf
+// holds a full key and the positions of all rows with that key.
+// Unlike GroupKeyIndex, the tree supports inserting rows, so Chunk::append keeps it up to date for chunks that are
+// still being filled. Lookups of complete keys (equal_range) only descend the tree. Range lookups and iteration need
+// the positions of all leaves in key order, which are collected on the first such lookup after an insert.
+// Like appending to a ValueColumn, inserting is not thread-safe with respect to concurrent lookups.
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+  ~AdaptiveRadixTreeIndex();
+
+ protected:
+  using Key = std::string;
+
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  std::pair<Iterator, Iterator> _equal_range(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+  std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const override;
+  void _insert(const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values) override;
+
+  // encodes the given values of the first values.size() columns into a binary-comparable key
+  Key _encode_key(const std::vector<AllTypeVariant>& values) const;
+
+  // returns the leaf with exactly the given key, or nullptr
+  const ARTLeaf* _find_leaf(const Key& key) const;
+
+  // collects the leaves and their positions in key order, if this has not happened since the last insert
+  void _materialize() const;
+
+  // The columns are not kept alive by the index. Once a chunk's columns are replaced by their encoded versions, the
+  // index still answers lookups, but is no longer reported as an index for any column.
+  std::vector<std::weak_ptr<const BaseColumn>> _index_columns;
+
+  // appends the encoding of a value of the corresponding column to a key
+  std::vector<void (*)(const AllTypeVariant&, Key&)> _key_part_encoders;
+
+  std::unique_ptr<ARTNode> _root;
+
+  mutable std::mutex _materialize_mutex;
+  mutable std::atomic_bool _is_materialized{false};
+  mutable std::vector<const ARTLeaf*> _sorted_leaves;
+  // _leaf_offsets[i] is the index of the first position of _sorted_leaves[i] in _positions
+  mutable std::vector<size_t> _leaf_offsets;
+  mutable std::vector<ChunkOffset> _positions;
+};
+
+}  // namespace opossum
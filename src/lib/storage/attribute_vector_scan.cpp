@@ -0,0 +1,417 @@
+#include "attribute_vector_scan.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define OPOSSUM_X86_SIMD 1
+#else
+#define OPOSSUM_X86_SIMD 0
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr size_t BITS_PER_WORD = 64;
+
+// All kernels check `static_cast<T>(value_id - begin) <= last` with last = end - begin - 1. Thanks to the unsigned
+// wrap-around, this tests both bounds of [begin, end) with a single comparison.
+template <typename T>
+void fill_bitmask_scalar(const T* data, const size_t size, const T begin, const T last, uint64_t* words) {
+  for (size_t word = 0; word * BITS_PER_WORD < size; ++word) {
+    const auto word_end = std::min(size, (word + 1) * BITS_PER_WORD);
+    uint64_t bits = 0;
+    for (auto i = word * BITS_PER_WORD; i < word_end; ++i) {
+      bits |= static_cast<uint64_t>(static_cast<T>(data[i] - begin) <= last) << (i % BITS_PER_WORD);
+    }
+    words[word] = bits;
+  }
+}
+
+#if OPOSSUM_X86_SIMD
+
+// There are no unsigned comparisons in SSE/AVX2, but unsigned minimums: x <= last holds iff min(x, last) == x.
+
+__attribute__((target("sse4.2"))) inline __m128i sse_in_range_epu8(const void* data, const __m128i begin,
+                                                                    const __m128i last) {
+  const auto values = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), begin);
+  return _mm_cmpeq_epi8(_mm_min_epu8(values, last), values);
+}
+
+__attribute__((target("sse4.2"))) inline __m128i sse_in_range_epu16(const void* data, const __m128i begin,
+                                                                     const __m128i last) {
+  const auto values = _mm_sub_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), begin);
+  return _mm_cmpeq_epi16(_mm_min_epu16(values, last), values);
+}
+
+__attribute__((target("sse4.2"))) inline __m128i sse_in_range_epu32(const void* data, const __m128i begin,
+                                                                     const __m128i last) {
+  const auto values = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), begin);
+  return _mm_cmpeq_epi32(_mm_min_epu32(values, last), values);
+}
+
+template <typename T>
+__attribute__((target("sse4.2"))) void fill_bitmask_sse42(const T* data, const size_t size, const T begin,
+                                                          const T last, uint64_t* words) {
+  size_t offset = 0;
+
+  if constexpr (sizeof(T) == 1) {
+    const auto begin_vec = _mm_set1_epi8(static_cast<char>(begin));
+    const auto last_vec = _mm_set1_epi8(static_cast<char>(last));
+    for (; offset + BITS_PER_WORD <= size; offset += BITS_PER_WORD) {
+      uint64_t bits = 0;
+      for (size_t i = 0; i < 4; ++i) {
+        const auto mask = _mm_movemask_epi8(sse_in_range_epu8(data + offset + i * 16, begin_vec, last_vec));
+        bits |= static_cast<uint64_t>(static_cast<uint16_t>(mask)) << (i * 16);
+      }
+      words[offset / BITS_PER_WORD] = bits;
+    }
+  } else if constexpr (sizeof(T) == 2) {
+    const auto begin_vec = _mm_set1_epi16(static_cast<int16_t>(begin));
+    const auto last_vec = _mm_set1_epi16(static_cast<int16_t>(last));
+    for (; offset + BITS_PER_WORD <= size; offset += BITS_PER_WORD) {
+      uint64_t bits = 0;
+      for (size_t i = 0; i < 4; ++i) {
+        // packing the two 16 bit masks into 8 bit lanes yields one movemask bit per entry
+        const auto low = sse_in_range_epu16(data + offset + i * 16, begin_vec, last_vec);
+        const auto high = sse_in_range_epu16(data + offset + i * 16 + 8, begin_vec, last_vec);
+        const auto mask = _mm_movemask_epi8(_mm_packs_epi16(low, high));
+        bits |= static_cast<uint64_t>(static_cast<uint16_t>(mask)) << (i * 16);
+      }
+      words[offset / BITS_PER_WORD] = bits;
+    }
+  } else {
+    const auto begin_vec = _mm_set1_epi32(static_cast<int32_t>(begin));
+    const auto last_vec = _mm_set1_epi32(static_cast<int32_t>(last));
+    for (; offset + BITS_PER_WORD <= size; offset += BITS_PER_WORD) {
+      uint64_t bits = 0;
+      for (size_t i = 0; i < 16; ++i) {
+        const auto mask = sse_in_range_epu32(data + offset + i * 4, begin_vec, last_vec);
+        bits |= static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(mask))) << (i * 4);
+      }
+      words[offset / BITS_PER_WORD] = bits;
+    }
+  }
+
+  fill_bitmask_scalar(data + offset, size - offset, begin, last, words + offset / BITS_PER_WORD);
+}
+
+__attribute__((target("avx2"))) inline __m256i avx2_in_range_epu8(const void* data, const __m256i begin,
+                                                                   const __m256i last) {
+  const auto values = _mm256_sub_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), begin);
+  return _mm256_cmpeq_epi8(_mm256_min_epu8(values, last), values);
+}
+
+__attribute__((target("avx2"))) inline __m256i avx2_in_range_epu16(const void* data, const __m256i begin,
+                                                                    const __m256i last) {
+  const auto values = _mm256_sub_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), begin);
+  return _mm256_cmpeq_epi16(_mm256_min_epu16(values, last), values);
+}
+
+__attribute__((target("avx2"))) inline __m256i avx2_in_range_epu32(const void* data, const __m256i begin,
+                                                                    const __m256i last) {
+  const auto values = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), begin);
+  return _mm256_cmpeq_epi32(_mm256_min_epu32(values, last), values);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) void fill_bitmask_avx2(const T* data, const size_t size, const T begin, const T last,
+                                                       uint64_t* words) {
+  size_t offset = 0;
+
+  if constexpr (sizeof(T) == 1) {
+    const auto begin_vec = _mm256_set1_epi8(static_cast<char>(begin));
+    const auto last_vec = _mm256_set1_epi8(static_cast<char>(last));
+    for (; offset + BITS_PER_WORD <= size; offset += BITS_PER_WORD) {
+      const auto low = _mm256_movemask_epi8(avx2_in_range_epu8(data + offset, begin_vec, last_vec));
+      const auto high = _mm256_movemask_epi8(avx2_in_range_epu8(data + offset + 32, begin_vec, last_vec));
+      words[offset / BITS_PER_WORD] =
+          static_cast<uint64_t>(static_cast<uint32_t>(low)) | static_cast<uint64_t>(static_cast<uint32_t>(high)) << 32;
+    }
+  } else if constexpr (sizeof(T) == 2) {
+    const auto begin_vec = _mm256_set1_epi16(static_cast<int16_t>(begin));
+    const auto last_vec = _mm256_set1_epi16(static_cast<int16_t>(last));
+    for (; offset + BITS_PER_WORD <= size; offset += BITS_PER_WORD) {
+      uint64_t bits = 0;
+      for (size_t i = 0; i < 2; ++i) {
+        // packs works within 128 bit lanes, so the 64 bit blocks have to be put back into order before the movemask
+        const auto low = avx2_in_range_epu16(data + offset + i * 32, begin_vec, last_vec);
+        const auto high = avx2_in_range_epu16(data + offset + i * 32 + 16, begin_vec, last_vec);
+        const auto packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(low, high), 0xD8);
+        bits |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(packed))) << (i * 32);
+      }
+      words[offset / BITS_PER_WORD] = bits;
+    }
+  } else {
+    const auto begin_vec = _mm256_set1_epi32(static_cast<int32_t>(begin));
+    const auto last_vec = _mm256_set1_epi32(static_cast<int32_t>(last));
+    for (; offset + BITS_PER_WORD <= size; offset += BITS_PER_WORD) {
+      uint64_t bits = 0;
+      for (size_t i = 0; i < 8; ++i) {
+        const auto mask = avx2_in_range_epu32(data + offset + i * 8, begin_vec, last_vec);
+        bits |= static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(mask))) << (i * 8);
+      }
+      words[offset / BITS_PER_WORD] = bits;
+    }
+  }
+
+  fill_bitmask_scalar(data + offset, size - offset, begin, last, words + offset / BITS_PER_WORD);
+}
+
+// Bit-packed ValueIDs are evaluated without unpacking them to memory: Eight ValueIDs always start at a byte boundary.
+// The first four are contained in the 16 bytes starting there, the last four in the 16 bytes starting at byte
+// (4 * bit_width) / 8. After loading these into the two lanes of a register, a byte shuffle moves each ValueID into a
+// 32 bit window, from where it is shifted and masked into place. This works for bit widths of up to 25, as a ValueID
+// may start at any bit within its first byte. Returns the number of entries that were evaluated, which is a multiple
+// of 64.
+__attribute__((target("avx2"))) size_t fill_bitmask_bit_packed_avx2(const BitPackedAttributeVector& attribute_vector,
+                                                                     const size_t offset, const size_t size,
+                                                                     const uint32_t begin, const uint32_t last,
+                                                                     uint64_t* words) {
+  const auto bit_width = attribute_vector.bit_width();
+  DebugAssert(bit_width <= 25 && offset % 8 == 0, "Unsupported bit-packed layout for AVX2 kernel");
+
+  const auto bytes = reinterpret_cast<const uint8_t*>(attribute_vector.words().data());
+  const auto high_lane_byte = static_cast<size_t>(4 * bit_width / 8);
+
+  std::array<int8_t, 32> shuffle_indices;
+  std::array<int32_t, 8> shifts;
+  for (size_t lane = 0; lane < 2; ++lane) {
+    const auto lane_bit_offset = lane == 0 ? 0 : 4 * bit_width - 8 * high_lane_byte;
+    for (size_t k = 0; k < 4; ++k) {
+      const auto bit_offset = lane_bit_offset + k * bit_width;
+      for (size_t byte = 0; byte < 4; ++byte) {
+        shuffle_indices[lane * 16 + k * 4 + byte] = static_cast<int8_t>(bit_offset / 8 + byte);
+      }
+      shifts[lane * 4 + k] = static_cast<int32_t>(bit_offset % 8);
+    }
+  }
+
+  const auto shuffle_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shuffle_indices.data()));
+  const auto shift_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shifts.data()));
+  const auto mask_vec = _mm256_set1_epi32(static_cast<int32_t>((uint64_t{1} << bit_width) - 1));
+  const auto begin_vec = _mm256_set1_epi32(static_cast<int32_t>(begin));
+  const auto last_vec = _mm256_set1_epi32(static_cast<int32_t>(last));
+
+  size_t processed = 0;
+  for (; processed + BITS_PER_WORD <= size; processed += BITS_PER_WORD) {
+    uint64_t bits = 0;
+    for (size_t block = 0; block < 8; ++block) {
+      const auto block_bytes = bytes + (offset + processed + block * 8) / 8 * bit_width;
+      const auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block_bytes));
+      const auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block_bytes + high_lane_byte));
+      const auto packed = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+
+      const auto value_ids = _mm256_and_si256(_mm256_srlv_epi32(_mm256_shuffle_epi8(packed, shuffle_vec), shift_vec),
+                                              mask_vec);
+      const auto shifted = _mm256_sub_epi32(value_ids, begin_vec);
+      const auto in_range = _mm256_cmpeq_epi32(_mm256_min_epu32(shifted, last_vec), shifted);
+      bits |= static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(in_range))) << (block * 8);
+    }
+    words[processed / BITS_PER_WORD] = bits;
+  }
+
+  return processed;
+}
+
+#endif
+
+// Converts [begin, end) into the begin and last value used by the kernels. ValueIDs beyond the fitted width cannot
+// occur in the attribute vector, so the range can be clamped to it. Returns false if the range is empty.
+template <typename T>
+bool to_typed_range(const ValueID begin, const ValueID end, T& typed_begin, T& typed_last) {
+  constexpr auto max_value_id = static_cast<uint64_t>(std::numeric_limits<T>::max());
+  const auto clamped_begin = static_cast<uint64_t>(begin);
+  const auto clamped_end = std::min(static_cast<uint64_t>(end), max_value_id + 1);
+  if (clamped_begin >= clamped_end) return false;
+
+  typed_begin = static_cast<T>(clamped_begin);
+  typed_last = static_cast<T>(clamped_end - clamped_begin - 1);
+  return true;
+}
+
+// Fills words with the bitmask for the entries [0, size) of data. size does not have to be a multiple of 64,
+// the remaining bits of the last word are zero.
+template <typename T>
+void fill_bitmask(const T* data, const size_t size, const ValueID begin, const ValueID end, uint64_t* words,
+                  const SimdLevel simd_level) {
+  T typed_begin;
+  T typed_last;
+  if (!to_typed_range(begin, end, typed_begin, typed_last)) {
+    std::fill(words, words + (size + BITS_PER_WORD - 1) / BITS_PER_WORD, uint64_t{0});
+    return;
+  }
+
+  switch (simd_level) {
+#if OPOSSUM_X86_SIMD
+    case SimdLevel::AVX2:
+      return fill_bitmask_avx2(data, size, typed_begin, typed_last, words);
+    case SimdLevel::SSE42:
+      return fill_bitmask_sse42(data, size, typed_begin, typed_last, words);
+#endif
+    default:
+      return fill_bitmask_scalar(data, size, typed_begin, typed_last, words);
+  }
+}
+
+// Fills words with the bitmask for the entries [offset, offset + size) of a bit-packed attribute vector. If possible,
+// the packed ValueIDs are compared directly. Otherwise, they are unpacked block by block and passed on to the 32 bit
+// kernels.
+void fill_bitmask_bit_packed(const BitPackedAttributeVector& attribute_vector, const size_t offset, const size_t size,
+                             const ValueID begin, const ValueID end, uint64_t* words, const SimdLevel simd_level) {
+  size_t processed = 0;
+
+#if OPOSSUM_X86_SIMD
+  uint32_t typed_begin;
+  uint32_t typed_last;
+  if (simd_level == SimdLevel::AVX2 && attribute_vector.bit_width() <= 25 && offset % 8 == 0 &&
+      to_typed_range(begin, end, typed_begin, typed_last)) {
+    processed = fill_bitmask_bit_packed_avx2(attribute_vector, offset, size, typed_begin, typed_last, words);
+  }
+#endif
+
+  std::array<ValueID::base_type, 16 * BITS_PER_WORD> unpacked;
+  for (; processed < size; processed += unpacked.size()) {
+    const auto count = std::min(unpacked.size(), size - processed);
+    attribute_vector.unpack(offset + processed, count, unpacked.data());
+    fill_bitmask(unpacked.data(), count, begin, end, words + processed / BITS_PER_WORD, simd_level);
+  }
+}
+
+// Fills words with the bitmask of the entries [offset, offset + size) of the attribute vector
+void fill_bitmask(const BaseAttributeVector& attribute_vector, const size_t offset, const size_t size,
+                  const ValueID begin, const ValueID end, const bool negated, uint64_t* words,
+                  const SimdLevel simd_level) {
+  const auto word_count = (size + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+  if (const auto fitted_8 = dynamic_cast<const FittedAttributeVector<uint8_t>*>(&attribute_vector)) {
+    fill_bitmask(fitted_8->values().data() + offset, size, begin, end, words, simd_level);
+  } else if (const auto fitted_16 = dynamic_cast<const FittedAttributeVector<uint16_t>*>(&attribute_vector)) {
+    fill_bitmask(fitted_16->values().data() + offset, size, begin, end, words, simd_level);
+  } else if (const auto fitted_32 = dynamic_cast<const FittedAttributeVector<uint32_t>*>(&attribute_vector)) {
+    fill_bitmask(fitted_32->values().data() + offset, size, begin, end, words, simd_level);
+  } else if (const auto bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    fill_bitmask_bit_packed(*bit_packed, offset, size, begin, end, words, simd_level);
+  } else {
+    // unknown attribute vector implementation, fall back to the virtual accessor
+    std::fill(words, words + word_count, uint64_t{0});
+    for (size_t i = 0; i < size; ++i) {
+      const auto value_id = attribute_vector.get(offset + i);
+      if (value_id >= begin && value_id < end) words[i / BITS_PER_WORD] |= uint64_t{1} << (i % BITS_PER_WORD);
+    }
+  }
+
+  if (negated) {
+    for (size_t word = 0; word < word_count; ++word) {
+      words[word] = ~words[word];
+    }
+    // bits beyond the last entry have to stay unset
+    if (size % BITS_PER_WORD != 0) {
+      words[word_count - 1] &= (uint64_t{1} << (size % BITS_PER_WORD)) - 1;
+    }
+  }
+}
+
+// Appends the offsets of the entries [offset, offset + size) whose ValueID is marked in value_id_matches
+template <typename T>
+void append_value_id_set_matches(const T* data, const size_t offset, const size_t size,
+                                 const std::vector<uint8_t>& value_id_matches, std::vector<ChunkOffset>& matches) {
+  for (size_t i = 0; i < size; ++i) {
+    DebugAssert(data[i] < value_id_matches.size(), "ValueID out of range!");
+    if (value_id_matches[data[i]]) matches.push_back(static_cast<ChunkOffset>(offset + i));
+  }
+}
+
+}  // namespace
+
+SimdLevel supported_simd_level() {
+#if OPOSSUM_X86_SIMD
+  static const auto simd_level = []() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse4.2")) return SimdLevel::SSE42;
+    return SimdLevel::Scalar;
+  }();
+  return simd_level;
+#else
+  return SimdLevel::Scalar;
+#endif
+}
+
+void scan_value_id_range_to_bitmask(const BaseAttributeVector& attribute_vector, const ValueID begin,
+                                    const ValueID end, const bool negated, std::vector<uint64_t>& bitmask,
+                                    const SimdLevel simd_level) {
+  Assert(simd_level <= supported_simd_level(), "Instruction set is not supported by this CPU");
+
+  const auto size = attribute_vector.size();
+  bitmask.resize((size + BITS_PER_WORD - 1) / BITS_PER_WORD);
+  fill_bitmask(attribute_vector, 0, size, begin, end, negated, bitmask.data(), simd_level);
+}
+
+void scan_value_id_range_to_offsets(const BaseAttributeVector& attribute_vector, const ValueID begin,
+                                    const ValueID end, const bool negated, std::vector<ChunkOffset>& matches,
+                                    const SimdLevel simd_level) {
+  scan_value_id_range_to_offsets(attribute_vector, 0, attribute_vector.size(), begin, end, negated, matches,
+                                 simd_level);
+}
+
+void scan_value_id_range_to_offsets(const BaseAttributeVector& attribute_vector, const size_t row_begin,
+                                    const size_t row_end, const ValueID begin, const ValueID end, const bool negated,
+                                    std::vector<ChunkOffset>& matches, const SimdLevel simd_level) {
+  Assert(simd_level <= supported_simd_level(), "Instruction set is not supported by this CPU");
+  DebugAssert(row_begin <= row_end && row_end <= attribute_vector.size(), "Row range out of bounds!");
+
+  // The attribute vector is processed in blocks that are small enough for the bitmask to stay in the L1 cache while the
+  // offsets are extracted from it
+  constexpr size_t block_size = 64 * BITS_PER_WORD;
+  std::array<uint64_t, block_size / BITS_PER_WORD> words;
+
+  for (auto block_offset = row_begin; block_offset < row_end; block_offset += block_size) {
+    const auto current_block_size = std::min(block_size, row_end - block_offset);
+    fill_bitmask(attribute_vector, block_offset, current_block_size, begin, end, negated, words.data(), simd_level);
+
+    for (size_t word = 0; word * BITS_PER_WORD < current_block_size; ++word) {
+      for (auto bits = words[word]; bits != 0; bits &= bits - 1) {
+        const auto bit = static_cast<size_t>(__builtin_ctzll(bits));
+        matches.push_back(static_cast<ChunkOffset>(block_offset + word * BITS_PER_WORD + bit));
+      }
+    }
+  }
+}
+
+void scan_value_id_set_to_offsets(const BaseAttributeVector& attribute_vector,
+                                  const std::vector<uint8_t>& value_id_matches, std::vector<ChunkOffset>& matches) {
+  const auto size = attribute_vector.size();
+
+  if (const auto fitted_8 = dynamic_cast<const FittedAttributeVector<uint8_t>*>(&attribute_vector)) {
+    append_value_id_set_matches(fitted_8->values().data(), 0, size, value_id_matches, matches);
+  } else if (const auto fitted_16 = dynamic_cast<const FittedAttributeVector<uint16_t>*>(&attribute_vector)) {
+    append_value_id_set_matches(fitted_16->values().data(), 0, size, value_id_matches, matches);
+  } else if (const auto fitted_32 = dynamic_cast<const FittedAttributeVector<uint32_t>*>(&attribute_vector)) {
+    append_value_id_set_matches(fitted_32->values().data(), 0, size, value_id_matches, matches);
+  } else if (const auto bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    std::array<ValueID::base_type, 16 * BITS_PER_WORD> unpacked;
+    for (size_t offset = 0; offset < size; offset += unpacked.size()) {
+      const auto count = std::min(unpacked.size(), size - offset);
+      bit_packed->unpack(offset, count, unpacked.data());
+      append_value_id_set_matches(unpacked.data(), offset, count, value_id_matches, matches);
+    }
+  } else {
+    // unknown attribute vector implementation, fall back to the virtual accessor
+    for (size_t i = 0; i < size; ++i) {
+      if (value_id_matches[attribute_vector.get(i)]) matches.push_back(static_cast<ChunkOffset>(i));
+    }
+  }
+}
+
+}  // namespace opossum
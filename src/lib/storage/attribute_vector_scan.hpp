@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+
+// Instruction sets for which attribute vector scan kernels exist.
+// By default, the best one supported by the executing CPU is picked at runtime.
+enum class SimdLevel { Scalar, SSE42, AVX2 };
+
+// returns the best instruction set supported by the executing CPU
+SimdLevel supported_simd_level();
+
+// Scans an attribute vector for all entries whose ValueID lies within [begin, end) - or outside of it, if negated.
+// The result is a bitmask with one bit per entry: entry i is represented by bit (i % 64) of bitmask[i / 64].
+// FittedAttributeVectors are compared in their fitted width using SIMD instructions. BitPackedAttributeVectors are
+// compared in their packed form where possible and unpacked in blocks otherwise. All other attribute vectors fall back
+// to a scalar loop over get().
+void scan_value_id_range_to_bitmask(const BaseAttributeVector& attribute_vector, const ValueID begin,
+                                    const ValueID end, const bool negated, std::vector<uint64_t>& bitmask,
+                                    const SimdLevel simd_level = supported_simd_level());
+
+// Same as scan_value_id_range_to_bitmask, but appends the offsets of all matching entries to matches
+void scan_value_id_range_to_offsets(const BaseAttributeVector& attribute_vector, const ValueID begin,
+                                    const ValueID end, const bool negated, std::vector<ChunkOffset>& matches,
+                                    const SimdLevel simd_level = supported_simd_level());
+
+// Same as above, but only scans the entries [row_begin, row_end)
+void scan_value_id_range_to_offsets(const BaseAttributeVector& attribute_vector, const size_t row_begin,
+                                    const size_t row_end, const ValueID begin, const ValueID end, const bool negated,
+                                    std::vector<ChunkOffset>& matches,
+                                    const SimdLevel simd_level = supported_simd_level());
+
+// Appends the offsets of all entries whose ValueID is marked in value_id_matches, which holds one entry per ValueID, to
+// matches. This is meant for sets of ValueIDs that do not form a range. FittedAttributeVectors are read in their fitted
+// width and BitPackedAttributeVectors are unpacked in blocks, so that get() is not called per entry.
+void scan_value_id_set_to_offsets(const BaseAttributeVector& attribute_vector,
+                                  const std::vector<uint8_t>& value_id_matches, std::vector<ChunkOffset>& matches);
+
+}  // namespace opossum
@@ -27,5 +27,8 @@ class BaseAttributeVector : private Noncopyable {
 
   // returns the width of the values in bytes
   virtual AttributeVectorWidth width() const = 0;
+
+  // returns the number of bytes occupied by the ValueIDs
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
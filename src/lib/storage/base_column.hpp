@@ -28,5 +28,8 @@ class BaseColumn : private Noncopyable {
 
   // returns the number of values
   virtual size_t size() const = 0;
+
+  // returns the number of bytes occupied by the column's data, e.g., to compare encodings
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
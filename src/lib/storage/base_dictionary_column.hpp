@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "base_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+
+// The non-templated interface of DictionaryColumn. It allows working with the ValueIDs of a dictionary column, e.g., in
+// an index, without resolving the column type.
+class BaseDictionaryColumn : public BaseColumn {
+ public:
+  // returns the ValueID of each row
+  virtual std::shared_ptr<const BaseAttributeVector> attribute_vector() const = 0;
+
+  // returns the first value ID that refers to a value >= the search value
+  // returns INVALID_VALUE_ID if all values are smaller than the search value
+  virtual ValueID lower_bound(const AllTypeVariant& value) const = 0;
+
+  // returns the first value ID that refers to a value > the search value
+  // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
+  virtual ValueID upper_bound(const AllTypeVariant& value) const = 0;
+
+  // return the number of unique_values (dictionary entries)
+  virtual size_t unique_values_count() const = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#include "base_index.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
+  return _get_index_columns() == columns;
+}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(!values.empty() && values.size() <= _get_index_columns().size(),
+         "Number of search values does not match the indexed columns!");
+  return _lower_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(!values.empty() && values.size() <= _get_index_columns().size(),
+         "Number of search values does not match the indexed columns!");
+  return _upper_bound(values);
+}
+
+std::pair<BaseIndex::Iterator, BaseIndex::Iterator> BaseIndex::equal_range(
+    const std::vector<AllTypeVariant>& values) const {
+  Assert(!values.empty() && values.size() <= _get_index_columns().size(),
+         "Number of search values does not match the indexed columns!");
+  return _equal_range(values);
+}
+
+BaseIndex::Iterator BaseIndex::cbegin() const { return _cbegin(); }
+
+BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
+
+std::vector<std::shared_ptr<const BaseColumn>> BaseIndex::index_columns() const { return _get_index_columns(); }
+
+void BaseIndex::insert(const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values) {
+  _insert(chunk_offset, values);
+}
+
+std::pair<BaseIndex::Iterator, BaseIndex::Iterator> BaseIndex::_equal_range(
+    const std::vector<AllTypeVariant>& values) const {
+  return {_lower_bound(values), _upper_bound(values)};
+}
+
+}  // namespace opossum
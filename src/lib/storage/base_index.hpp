@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// An index maps values of one or more columns of a chunk to the positions (ChunkOffsets) of the rows holding them.
+// The positions are returned in the order of the indexed values, so all rows with values in a range [a, b] lie
+// between lower_bound({a}) and upper_bound({b}). The positions of rows with equal values are sorted.
+// For composite indices, the values are compared lexicographically and the search values may be a prefix of the
+// indexed columns.
+// Indices are created through Chunk::create_index and stay valid when the columns are replaced by their encoded
+// versions, as this does not change any position.
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  BaseIndex() = default;
+  virtual ~BaseIndex() = default;
+
+  // returns true if the index covers exactly the given columns in the given order
+  bool is_index_for(const std::vector<std::shared_ptr<const BaseColumn>>& columns) const;
+
+  // returns an iterator to the position of the first row whose values are not smaller than the given ones
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // returns an iterator to the position of the first row whose values are greater than the given ones
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // Returns the positions of all rows with the given values. This is the same as lower_bound and upper_bound, but some
+  // indices answer it faster. The range does not necessarily lie within [cbegin(), cend()).
+  std::pair<Iterator, Iterator> equal_range(const std::vector<AllTypeVariant>& values) const;
+
+  // iterate over the positions of all rows in the order of their values
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  std::vector<std::shared_ptr<const BaseColumn>> index_columns() const;
+
+  // Adds a row with the given values of the indexed columns, which Chunk::append calls for every new row. Indices on
+  // columns that cannot be appended to, e.g., dictionary columns, do not support this. Invalidates all iterators.
+  void insert(const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values);
+
+ protected:
+  virtual Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual std::pair<Iterator, Iterator> _equal_range(const std::vector<AllTypeVariant>& values) const;
+  virtual Iterator _cbegin() const = 0;
+  virtual Iterator _cend() const = 0;
+  virtual std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const = 0;
+  virtual void _insert(const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values) = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,125 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr uint8_t MAX_BIT_WIDTH = 32;
+
+// Reads the bit_width bits starting at bit_offset. The second shift is split up, because shifting a 64 bit value by
+// 64 is undefined. Reading words[word + 1] is always safe due to the padding.
+inline uint64_t read_bits(const uint64_t* words, const size_t bit_offset, const uint64_t mask) {
+  const auto word = bit_offset / 64;
+  const auto shift = bit_offset % 64;
+  return ((words[word] >> shift) | ((words[word + 1] << (63 - shift)) << 1)) & mask;
+}
+
+// With the bit width known at compile time, the compiler can turn the shifts and masks into cheap constants
+template <uint8_t bit_width>
+void unpack_fixed_width(const uint64_t* words, const size_t offset, const size_t count, ValueID::base_type* out) {
+  constexpr auto mask = (uint64_t{1} << bit_width) - 1;
+
+  auto bit_offset = offset * bit_width;
+  for (size_t i = 0; i < count; ++i, bit_offset += bit_width) {
+    out[i] = static_cast<ValueID::base_type>(read_bits(words, bit_offset, mask));
+  }
+}
+
+using UnpackFunction = void (*)(const uint64_t*, const size_t, const size_t, ValueID::base_type*);
+
+template <size_t... bit_width_indices>
+constexpr std::array<UnpackFunction, sizeof...(bit_width_indices)> make_unpack_functions(
+    std::index_sequence<bit_width_indices...>) {
+  return {{&unpack_fixed_width<static_cast<uint8_t>(bit_width_indices + 1)>...}};
+}
+
+// unpack_functions[b - 1] unpacks ValueIDs with a bit width of b
+constexpr auto unpack_functions = make_unpack_functions(std::make_index_sequence<MAX_BIT_WIDTH>{});
+
+}  // namespace
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width)
+    : BaseAttributeVector(),
+      _size{size},
+      _bit_width{bit_width},
+      _mask{(uint64_t{1} << bit_width) - 1},
+      _words((size * bit_width + 63) / 64 + PADDING_WORDS) {
+  Assert(bit_width > 0 && bit_width <= MAX_BIT_WIDTH,
+         "Unsupported bit width " + std::to_string(bit_width) + " for bit-packed attribute vector!");
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const std::vector<ValueID::base_type>& value_ids,
+                                                   const uint8_t bit_width)
+    : BitPackedAttributeVector(value_ids.size(), bit_width) {
+  // the words are still zero, so the ValueIDs can simply be or-ed into them
+  auto bit_offset = size_t{0};
+  for (const auto value_id : value_ids) {
+    DebugAssert(value_id <= _mask, "ValueID does not fit into the bit width!");
+    const auto word = bit_offset / 64;
+    const auto shift = bit_offset % 64;
+    const auto value = static_cast<uint64_t>(value_id);
+
+    _words[word] |= value << shift;
+    if (shift + _bit_width > 64) _words[word + 1] |= value >> (64 - shift);
+
+    bit_offset += _bit_width;
+  }
+}
+
+uint8_t BitPackedAttributeVector::required_bit_width(const size_t unique_values_count) {
+  uint8_t bit_width = 1;
+  while (bit_width < MAX_BIT_WIDTH && (uint64_t{1} << bit_width) < unique_values_count) {
+    ++bit_width;
+  }
+  return bit_width;
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "Index out of bounds!");
+  return ValueID{static_cast<ValueID::base_type>(read_bits(_words.data(), i * _bit_width, _mask))};
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  Assert(i < _size, "Index " + std::to_string(i) + " too large for bit-packed attribute vector of size " +
+                        std::to_string(_size) + "!");
+  Assert(static_cast<uint64_t>(value_id) <= _mask, "ValueID " + std::to_string(value_id) + " does not fit into " +
+                                                        std::to_string(_bit_width) + " bits!");
+
+  const auto bit_offset = i * _bit_width;
+  const auto word = bit_offset / 64;
+  const auto shift = bit_offset % 64;
+  const auto value = static_cast<uint64_t>(value_id);
+
+  _words[word] = (_words[word] & ~(_mask << shift)) | (value << shift);
+
+  // the value spans into the next word
+  if (shift + _bit_width > 64) {
+    const auto written_bits = 64 - shift;
+    _words[word + 1] = (_words[word + 1] & ~(_mask >> written_bits)) | (value >> written_bits);
+  }
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const { return (_bit_width + 7) / 8; }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const { return _words.size() * sizeof(uint64_t); }
+
+uint8_t BitPackedAttributeVector::bit_width() const { return _bit_width; }
+
+void BitPackedAttributeVector::unpack(const size_t offset, const size_t count, ValueID::base_type* out) const {
+  DebugAssert(offset + count <= _size, "Range out of bounds!");
+  unpack_functions[_bit_width - 1](_words.data(), offset, count, out);
+}
+
+const std::vector<uint64_t>& BitPackedAttributeVector::words() const { return _words; }
+
+}  // namespace opossum
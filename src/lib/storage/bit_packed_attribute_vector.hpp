@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Implements an attribute vector that stores each ValueID with exactly bit_width bits.
+// The ValueIDs are packed back to back into 64 bit words, so a single ValueID may span two words.
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  // number of padding words after the last ValueID, which allow kernels to read full words (or SIMD registers)
+  // without checking for the end of the data
+  static constexpr size_t PADDING_WORDS = 4;
+
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width);
+
+  // creates an attribute vector that holds the given ValueIDs, packing them in one pass
+  BitPackedAttributeVector(const std::vector<ValueID::base_type>& value_ids, const uint8_t bit_width);
+
+  // returns the minimum number of bits required to store the ValueIDs of a dictionary with the given number of entries
+  static uint8_t required_bit_width(const size_t unique_values_count);
+
+  ValueID get(const size_t i) const override;
+
+  void set(const size_t i, const ValueID value_id) override;
+
+  size_t size() const override;
+
+  // returns the number of bytes needed for an unpacked value
+  AttributeVectorWidth width() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  // returns the number of bits used per value
+  uint8_t bit_width() const;
+
+  // Unpacks the ValueIDs [offset, offset + count) into out. This is considerably faster than calling get() for each
+  // of them.
+  void unpack(const size_t offset, const size_t count, ValueID::base_type* out) const;
+
+  // returns the packed data, including PADDING_WORDS words of padding at the end
+  const std::vector<uint64_t>& words() const;
+
+ protected:
+  const size_t _size;
+  const uint8_t _bit_width;
+  const uint64_t _mask;
+  std::vector<uint64_t> _words;
+};
+
+}  // namespace opossum
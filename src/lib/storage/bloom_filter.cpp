@@ -0,0 +1,124 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "dictionary_column.hpp"
+#include "frame_of_reference_column.hpp"
+#include "resolve_type.hpp"
+#include "run_length_column.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Double hashing: the k bit positions of a value are h1 + i * h2, which is as good as k independent hash functions.
+// Hashes like std::hash<int> are often the identity, so they are first spread over all 64 bits with the finalizer of
+// MurmurHash3.
+std::pair<uint64_t, uint64_t> double_hashes(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return {hash & 0xFFFFFFFFULL, (hash >> 32) | 1};
+}
+
+constexpr uint8_t MAX_HASH_COUNT = 16;
+
+template <typename T>
+std::shared_ptr<BloomFilter> create_typed_bloom_filter(const BaseColumn& column, const double false_positive_rate) {
+  const auto build = [&](const size_t value_count, const auto& for_each_value) {
+    auto bloom_filter = std::make_shared<BloomFilter>(value_count, false_positive_rate);
+    for_each_value([&](const auto& value) { bloom_filter->insert(bloom_filter_hash(value)); });
+    return bloom_filter;
+  };
+
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    // the dictionary holds every distinct value exactly once
+    const auto& dictionary = *dictionary_column->dictionary();
+    return build(dictionary.size(), [&](const auto& func) {
+      for (const auto& value : dictionary) func(value);
+    });
+  } else if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    const auto& values = value_column->values();
+    return build(values.size(), [&](const auto& func) {
+      for (const auto& value : values) func(value);
+    });
+  } else if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+    const auto& values = *run_length_column->values();
+    return build(values.size(), [&](const auto& func) {
+      for (const auto& value : values) func(value);
+    });
+  }
+
+  if constexpr (std::is_integral<T>::value) {
+    if (const auto frame_of_reference_column = dynamic_cast<const FrameOfReferenceColumn<T>*>(&column)) {
+      return build(frame_of_reference_column->size(), [&](const auto& func) {
+        for (size_t chunk_offset = 0; chunk_offset < frame_of_reference_column->size(); ++chunk_offset) {
+          func(frame_of_reference_column->get(chunk_offset));
+        }
+      });
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace
+
+BloomFilter::BloomFilter(const size_t value_count, const double false_positive_rate) {
+  Assert(false_positive_rate > 0.0 && false_positive_rate < 1.0, "False positive rate must be between 0 and 1!");
+
+  // The optimal number of bits is -n * ln(p) / ln(2)^2, with ln(2) * bits / n hash functions
+  const auto ln_2 = std::log(2.0);
+  const auto value_count_or_one = static_cast<double>(std::max(value_count, size_t{1}));
+  const auto optimal_bit_count = -value_count_or_one * std::log(false_positive_rate) / (ln_2 * ln_2);
+  _bit_count = std::max(size_t{64}, static_cast<size_t>(std::ceil(optimal_bit_count)));
+
+  const auto optimal_hash_count = std::round(static_cast<double>(_bit_count) / value_count_or_one * ln_2);
+  _hash_count = static_cast<uint8_t>(std::clamp(optimal_hash_count, 1.0, static_cast<double>(MAX_HASH_COUNT)));
+
+  _words.resize((_bit_count + 63) / 64);
+}
+
+void BloomFilter::insert(const size_t hash) {
+  const auto [hash_1, hash_2] = double_hashes(hash);
+  for (uint64_t i = 0; i < _hash_count; ++i) {
+    const auto bit = (hash_1 + i * hash_2) % _bit_count;
+    _words[bit / 64] |= uint64_t{1} << (bit % 64);
+  }
+}
+
+bool BloomFilter::may_contain(const size_t hash) const {
+  const auto [hash_1, hash_2] = double_hashes(hash);
+  for (uint64_t i = 0; i < _hash_count; ++i) {
+    const auto bit = (hash_1 + i * hash_2) % _bit_count;
+    if (!((_words[bit / 64] >> (bit % 64)) & 1)) return false;
+  }
+  return true;
+}
+
+size_t BloomFilter::bit_count() const { return _bit_count; }
+
+uint8_t BloomFilter::hash_count() const { return _hash_count; }
+
+size_t BloomFilter::estimate_memory_usage() const { return _words.size() * sizeof(uint64_t); }
+
+std::shared_ptr<BloomFilter> create_bloom_filter(const BaseColumn& column, const double false_positive_rate) {
+  std::shared_ptr<BloomFilter> bloom_filter;
+  hana::for_each(types, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    if (!bloom_filter) bloom_filter = create_typed_bloom_filter<Type>(column, false_positive_rate);
+  });
+  return bloom_filter;
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// A Bloom filter stores a set of values in a bit vector, so that membership can be tested in constant time. It may
+// report values that were never inserted (with the configured false positive rate), but never misses an inserted value.
+// Scans use it to skip chunks that cannot contain the searched value, which zone maps cannot do if the values of all
+// chunks cover the same range.
+// The filter works on hashes (see bloom_filter_hash), so that one implementation serves all column types.
+class BloomFilter : private Noncopyable {
+ public:
+  static constexpr double DEFAULT_FALSE_POSITIVE_RATE = 0.01;
+
+  // creates a filter that is sized for the given number of distinct values and false positive rate
+  BloomFilter(const size_t value_count, const double false_positive_rate = DEFAULT_FALSE_POSITIVE_RATE);
+
+  void insert(const size_t hash);
+
+  // returns false if the value with the given hash was definitely not inserted
+  bool may_contain(const size_t hash) const;
+
+  // returns the number of bits of the filter
+  size_t bit_count() const;
+
+  // returns the number of bits that are set for each value
+  uint8_t hash_count() const;
+
+  size_t estimate_memory_usage() const;
+
+ protected:
+  std::vector<uint64_t> _words;
+  size_t _bit_count;
+  uint8_t _hash_count;
+};
+
+// Returns the hash of a value as used by Bloom filters. Strings are hashed as std::string_views, so that std::strings
+// and the values of a StringStorage have the same hash.
+template <typename T>
+size_t bloom_filter_hash(const T& value) {
+  if constexpr (std::is_convertible<const T&, std::string_view>::value) {
+    return std::hash<std::string_view>{}(value);
+  } else {
+    return std::hash<T>{}(value);
+  }
+}
+
+// Creates a Bloom filter of all values of a value, dictionary, run-length, or frame-of-reference column. Returns
+// nullptr for all other columns. For dictionary columns, only the dictionary has to be read.
+std::shared_ptr<BloomFilter> create_bloom_filter(
+    const BaseColumn& column, const double false_positive_rate = BloomFilter::DEFAULT_FALSE_POSITIVE_RATE);
+
+}  // namespace opossum
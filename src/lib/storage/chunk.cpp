@@ -8,37 +8,103 @@
 #include <vector>
 
 #include "base_column.hpp"
+#include "base_index.hpp"
+#include "bloom_filter.hpp"
 #include "chunk.hpp"
+#include "zone_map.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+Chunk::Chunk() : _columns{std::make_shared<const Columns>()}, _indices{std::make_shared<const Indices>()} {}
+
 void Chunk::add_column(std::shared_ptr<BaseColumn> column) {
   // if the chunk is empty, always allow adding a new column
   // otherwise, only allow if column size matches
-  Assert(column->size() == this->size() || _columns.size() == 0, "Column size does not match chunk size!");
-  _columns.push_back(column);
+  Assert(column->size() == this->size() || col_count() == 0, "Column size does not match chunk size!");
+
+  auto columns = std::make_shared<Columns>(*_load_columns());
+  columns->push_back(column);
+  std::atomic_store(&_columns, std::shared_ptr<const Columns>{std::move(columns)});
+  _zone_maps.push_back(create_zone_map(*column));
+  _bloom_filters.emplace_back();
+}
+
+void Chunk::add_column_of(const Chunk& chunk, ColumnID column_id) {
+  const auto column = chunk.get_column(column_id);
+  Assert(column->size() == this->size() || col_count() == 0, "Column size does not match chunk size!");
+
+  auto columns = std::make_shared<Columns>(*_load_columns());
+  columns->push_back(column);
+  std::atomic_store(&_columns, std::shared_ptr<const Columns>{std::move(columns)});
+  _zone_maps.push_back(chunk._zone_maps.at(column_id));
+  _bloom_filters.push_back(chunk.bloom_filter(column_id));
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
-  Assert(values.size() == _columns.size(), "Number of given values does not match number of columns!");
+  const auto columns = _load_columns();
+  Assert(values.size() == columns->size(), "Number of given values does not match number of columns!");
   for (size_t i = 0; i < values.size(); i++) {
-    _columns[i]->append(values[i]);
+    (*columns)[i]->append(values[i]);
+    if (_zone_maps[i]) _zone_maps[i]->append(values[i]);
+  }
+
+  const auto chunk_offset = static_cast<ChunkOffset>(size() - 1);
+  for (const auto& entry : *std::atomic_load(&_indices)) {
+    std::vector<AllTypeVariant> index_values;
+    for (const auto& column_id : entry.column_ids) index_values.push_back(values[column_id]);
+    entry.index->insert(chunk_offset, index_values);
   }
 }
 
-std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const { return _columns.at(column_id); }
+std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const { return _load_columns()->at(column_id); }
 
-uint16_t Chunk::col_count() const { return _columns.size(); }
+uint16_t Chunk::col_count() const { return _load_columns()->size(); }
 
 uint32_t Chunk::size() const {
-  if (col_count() == 0) {
+  const auto columns = _load_columns();
+  if (columns->empty()) {
     return 0;
   }
   // all columns have the same size (as per add_column() and append() implementation)
   // so we can just return the size of the first column
-  return _columns[0]->size();
+  return columns->front()->size();
+}
+
+void Chunk::replace_columns(std::vector<std::shared_ptr<BaseColumn>> columns) {
+  Assert(columns.size() == col_count(), "Number of columns does not match!");
+  for (const auto& column : columns) {
+    Assert(column->size() == size(), "Column size does not match chunk size!");
+  }
+
+  std::atomic_store(&_columns, std::shared_ptr<const Columns>{std::make_shared<Columns>(std::move(columns))});
 }
 
+std::shared_ptr<const BaseZoneMap> Chunk::zone_map(ColumnID column_id) const { return _zone_maps.at(column_id); }
+
+std::shared_ptr<const BloomFilter> Chunk::bloom_filter(ColumnID column_id) const {
+  return std::atomic_load(&_bloom_filters.at(column_id));
+}
+
+void Chunk::set_bloom_filter(ColumnID column_id, std::shared_ptr<const BloomFilter> bloom_filter) {
+  std::atomic_store(&_bloom_filters.at(column_id), std::move(bloom_filter));
+}
+
+std::vector<std::shared_ptr<const BaseIndex>> Chunk::get_indices(const std::vector<ColumnID>& column_ids) const {
+  std::vector<std::shared_ptr<const BaseIndex>> indices;
+  for (const auto& entry : *std::atomic_load(&_indices)) {
+    if (entry.column_ids == column_ids) indices.push_back(entry.index);
+  }
+  return indices;
+}
+
+void Chunk::_add_index(const std::vector<ColumnID>& column_ids, std::shared_ptr<BaseIndex> index) {
+  auto indices = std::make_shared<Indices>(*std::atomic_load(&_indices));
+  indices->push_back({column_ids, std::move(index)});
+  std::atomic_store(&_indices, std::shared_ptr<const Indices>{std::move(indices)});
+}
+
+std::shared_ptr<const Chunk::Columns> Chunk::_load_columns() const { return std::atomic_load(&_columns); }
+
 }  // namespace opossum
@@ -15,14 +15,22 @@ namespace opossum {
 
 class BaseIndex;
 class BaseColumn;
+class BaseZoneMap;
+class BloomFilter;
 
 // A chunk is a horizontal partition of a table.
 // It stores the data column by column.
 //
 // Find more information about this in our wiki: https://github.com/hyrise/zweirise/wiki/chunk-concept
+//
+// For each column, the chunk keeps a zone map (see zone_map.hpp) and optionally a Bloom filter (see bloom_filter.hpp)
+// that scans use to skip the chunk. Indices on one or more columns (see base_index.hpp) are created explicitly.
+//
+// Chunks may be read while they are compressed in the background (see ChunkCompressionService). Therefore, the columns
+// are never modified in place, but replaced as a whole by replace_columns().
 class Chunk : private Noncopyable {
  public:
-  Chunk() = default;
+  Chunk();
 
   // we need to explicitly set the move constructor to default when
   // we overwrite the copy constructor
@@ -32,21 +40,73 @@ class Chunk : private Noncopyable {
   // adds a column to the "right" of the chunk
   void add_column(std::shared_ptr<BaseColumn> column);
 
+  // Adds a column of another chunk without copying it. The zone map and Bloom filter of the column are shared, too,
+  // instead of being computed again.
+  void add_column_of(const Chunk& chunk, ColumnID column_id);
+
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   uint16_t col_count() const;
 
   // returns the number of rows (cannot exceed ChunkOffset (uint32_t))
   uint32_t size() const;
 
-  // adds a new row, given as a list of values, to the chunk
+  // adds a new row, given as a list of values, to the chunk and inserts it into all indices
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
   // Returns the column at a given position
   std::shared_ptr<BaseColumn> get_column(ColumnID column_id) const;
 
+  // Atomically replaces all columns, e.g., by their encoded versions. Readers that still hold the old columns can keep
+  // using them. The new columns must have the same number of rows as the old ones.
+  void replace_columns(std::vector<std::shared_ptr<BaseColumn>> columns);
+
+  // Returns the zone map of a column, or nullptr if the column has none (e.g., ReferenceColumns). The zone maps
+  // describe the values of the columns and stay valid when the columns are replaced by their encoded versions.
+  std::shared_ptr<const BaseZoneMap> zone_map(ColumnID column_id) const;
+
+  // Returns the Bloom filter of a column, or nullptr if it has none. Bloom filters are only built for full chunks (see
+  // Table::enable_bloom_filter) and can be set while the chunk is read.
+  std::shared_ptr<const BloomFilter> bloom_filter(ColumnID column_id) const;
+  void set_bloom_filter(ColumnID column_id, std::shared_ptr<const BloomFilter> bloom_filter);
+
+  // creates an index of the given type (e.g., GroupKeyIndex) on the given columns and adds it to the chunk
+  template <typename Index>
+  std::shared_ptr<Index> create_index(const std::vector<ColumnID>& column_ids) {
+    const auto columns = _load_columns();
+    std::vector<std::shared_ptr<const BaseColumn>> index_columns;
+    for (const auto& column_id : column_ids) index_columns.push_back(columns->at(column_id));
+
+    auto index = std::make_shared<Index>(index_columns);
+    _add_index(column_ids, index);
+    return index;
+  }
+
+  // returns all indices on exactly the given columns, in the given order
+  std::vector<std::shared_ptr<const BaseIndex>> get_indices(const std::vector<ColumnID>& column_ids) const;
+
  protected:
-  std::vector<std::shared_ptr<BaseColumn>> _columns;
+  using Columns = std::vector<std::shared_ptr<BaseColumn>>;
+
+  struct IndexEntry {
+    std::vector<ColumnID> column_ids;
+    std::shared_ptr<BaseIndex> index;
+  };
+  using Indices = std::vector<IndexEntry>;
+
+  // returns the current columns. Only access _columns through this method and std::atomic_store.
+  std::shared_ptr<const Columns> _load_columns() const;
+
+  void _add_index(const std::vector<ColumnID>& column_ids, std::shared_ptr<BaseIndex> index);
+
+  std::shared_ptr<const Columns> _columns;
+  std::vector<std::shared_ptr<BaseZoneMap>> _zone_maps;
+
+  // only access the elements through std::atomic_load and std::atomic_store
+  std::vector<std::shared_ptr<const BloomFilter>> _bloom_filters;
+
+  // like _columns, the indices are replaced as a whole, so that they can be added while the chunk is read
+  std::shared_ptr<const Indices> _indices;
 };
 
 }  // namespace opossum
@@ -0,0 +1,150 @@
+#include "chunk_compression_service.hpp"
+
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage_manager.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns whether all columns of the chunk are still ValueColumns. Chunks that were added in encoded form (e.g., via
+// Table::emplace_chunk) are skipped.
+bool is_unencoded(const Table& table, const ChunkID chunk_id) {
+  const auto& chunk = table.get_chunk(chunk_id);
+  for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+    auto is_value_column = false;
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      is_value_column = std::dynamic_pointer_cast<const ValueColumn<Type>>(chunk.get_column(column_id)) != nullptr;
+    });
+    if (!is_value_column) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+ChunkCompressionService::ChunkCompressionService(const size_t worker_count,
+                                                 const std::chrono::milliseconds poll_interval)
+    : _poll_interval{poll_interval} {
+  Assert(worker_count > 0, "ChunkCompressionService needs at least one worker!");
+
+  for (size_t worker = 0; worker < worker_count; ++worker) {
+    _workers.emplace_back(&ChunkCompressionService::_work, this);
+  }
+  _watcher = std::thread(&ChunkCompressionService::_watch, this);
+}
+
+ChunkCompressionService::~ChunkCompressionService() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shutdown = true;
+    _jobs.clear();
+  }
+  _shutdown_requested.notify_all();
+  _jobs_available.notify_all();
+  _jobs_done.notify_all();
+
+  _watcher.join();
+  for (auto& worker : _workers) worker.join();
+}
+
+void ChunkCompressionService::flush() {
+  _scan_tables();
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  _jobs_done.wait(lock, [&] { return _shutdown || (_jobs.empty() && _active_job_count == 0); });
+}
+
+size_t ChunkCompressionService::compressed_chunk_count() const { return _compressed_chunk_count; }
+
+void ChunkCompressionService::_watch() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (!_shutdown) {
+    lock.unlock();
+    _scan_tables();
+    lock.lock();
+
+    _shutdown_requested.wait_for(lock, _poll_interval, [&] { return _shutdown; });
+  }
+}
+
+void ChunkCompressionService::_work() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _jobs_available.wait(lock, [&] { return _shutdown || !_jobs.empty(); });
+    if (_shutdown) return;
+
+    const auto job = std::move(_jobs.front());
+    _jobs.pop_front();
+    ++_active_job_count;
+    lock.unlock();
+
+    // Encoding may take a while, so it happens without holding any lock. Only the final publish of the new columns
+    // is atomic. A chunk that cannot be encoded stays as it is, without taking down the service.
+    try {
+      if (is_unencoded(*job.table, job.chunk_id)) {
+        job.table->compress_chunk_adaptively(job.chunk_id);
+        ++_compressed_chunk_count;
+      }
+    } catch (const std::exception& exception) {
+      std::cerr << "ChunkCompressionService: failed to compress chunk " << job.chunk_id << ": " << exception.what()
+                << std::endl;
+    }
+
+    lock.lock();
+    --_active_job_count;
+    if (_jobs.empty() && _active_job_count == 0) _jobs_done.notify_all();
+  }
+}
+
+void ChunkCompressionService::_scan_tables() {
+  std::lock_guard<std::mutex> scan_lock(_scan_mutex);
+
+  std::vector<CompressionJob> new_jobs;
+  std::map<std::string, WatchedTable> watched_tables;
+
+  auto& storage_manager = StorageManager::get();
+  for (const auto& name : storage_manager.table_names()) {
+    const auto table = storage_manager.try_get_table(name);
+    if (!table) continue;
+
+    // Tables that were dropped are forgotten. If a table was replaced by another one with the same name, the new
+    // table is watched from its first chunk.
+    auto watched_table = WatchedTable{table, ChunkID{0}};
+    const auto watched_table_it = _watched_tables.find(name);
+    if (watched_table_it != _watched_tables.cend() && watched_table_it->second.table.lock() == table) {
+      watched_table = watched_table_it->second;
+    }
+
+    const auto chunk_count = table->chunk_count();
+    while (watched_table.next_chunk_id < chunk_count && table->is_chunk_full(watched_table.next_chunk_id)) {
+      new_jobs.push_back({table, watched_table.next_chunk_id});
+      ++watched_table.next_chunk_id;
+    }
+
+    watched_tables.emplace(name, std::move(watched_table));
+  }
+  _watched_tables = std::move(watched_tables);
+
+  if (new_jobs.empty()) return;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_shutdown) return;
+    _jobs.insert(_jobs.end(), new_jobs.begin(), new_jobs.end());
+  }
+  _jobs_available.notify_all();
+}
+
+}  // namespace opossum
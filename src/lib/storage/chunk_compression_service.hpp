@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// The ChunkCompressionService compresses the chunks of all tables in the StorageManager in the background. A watcher
+// thread looks for chunks that have reached the table's chunk size and hands them to worker threads, which encode them
+// with Table::compress_chunk_adaptively. The encoded columns are published atomically (see Chunk::replace_columns), so
+// readers of full chunks and the ingest of new rows are never blocked by the compression.
+//
+// Chunks are expected to fill up in order, as they do with Table::append. Chunks must not be compressed by hand while
+// the service is running.
+class ChunkCompressionService : private Noncopyable {
+ public:
+  static constexpr std::chrono::milliseconds DEFAULT_POLL_INTERVAL{10};
+
+  // starts the watcher and worker_count worker threads
+  explicit ChunkCompressionService(const size_t worker_count = 1,
+                                   const std::chrono::milliseconds poll_interval = DEFAULT_POLL_INTERVAL);
+
+  // stops all threads. Chunks that are being compressed are finished, queued ones are dropped.
+  ~ChunkCompressionService();
+
+  // blocks until all chunks that were full when this method was called are compressed
+  void flush();
+
+  // returns the number of chunks that were compressed since the service was started
+  size_t compressed_chunk_count() const;
+
+ protected:
+  struct CompressionJob {
+    std::shared_ptr<Table> table;
+    ChunkID chunk_id;
+  };
+
+  // what the watcher knows about a table
+  struct WatchedTable {
+    std::weak_ptr<Table> table;
+
+    // all chunks before this one have already been handed to the workers
+    ChunkID next_chunk_id;
+  };
+
+  void _watch();
+  void _work();
+
+  // looks for new full chunks in all tables and enqueues them
+  void _scan_tables();
+
+  const std::chrono::milliseconds _poll_interval;
+
+  // protects _watched_tables, so that flush() can scan concurrently with the watcher
+  std::mutex _scan_mutex;
+  std::map<std::string, WatchedTable> _watched_tables;
+
+  // protects _jobs, _active_job_count and _shutdown
+  std::mutex _mutex;
+  std::condition_variable _jobs_available;
+  std::condition_variable _jobs_done;
+  std::condition_variable _shutdown_requested;
+  std::deque<CompressionJob> _jobs;
+  size_t _active_job_count = 0;
+  bool _shutdown = false;
+
+  std::atomic<size_t> _compressed_chunk_count{0};
+
+  std::thread _watcher;
+  std::vector<std::thread> _workers;
+};
+
+}  // namespace opossum
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "dictionary_column.hpp"
+#include "frame_of_reference_column.hpp"
+#include "reference_column.hpp"
+#include "run_length_column.hpp"
+#include "string_storage.hpp"
+#include "table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+// The type in which for_each_value passes the values of a column of type T: std::string_view for strings, T otherwise.
+template <typename T>
+using ValueView = typename ValueVector<T>::value_type;
+
+namespace detail {
+
+// Calls func(index, value) for every row of a non-reference column. Without a selection, these are all rows and index
+// is the ChunkOffset. With a selection, only the listed offsets are visited and index is the position in the selection.
+template <typename T, typename Functor>
+void for_each_value_in_selection(const BaseColumn& column, const std::vector<ChunkOffset>* selection,
+                                 const Functor& func) {
+  const auto visit = [&](const size_t size, const auto& value_at) {
+    if (selection == nullptr) {
+      for (ChunkOffset chunk_offset = 0; chunk_offset < size; ++chunk_offset) {
+        func(chunk_offset, value_at(chunk_offset));
+      }
+      return;
+    }
+    for (ChunkOffset index = 0; index < selection->size(); ++index) func(index, value_at((*selection)[index]));
+  };
+
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    const auto& values = value_column->values();
+    visit(values.size(), [&](const ChunkOffset chunk_offset) -> ValueView<T> { return values[chunk_offset]; });
+  } else if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    const auto& dictionary = *dictionary_column->dictionary();
+    const auto& attribute_vector = *dictionary_column->attribute_vector();
+    visit(attribute_vector.size(), [&](const ChunkOffset chunk_offset) -> ValueView<T> {
+      return dictionary[attribute_vector.get(chunk_offset)];
+    });
+  } else if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+    const auto& values = *run_length_column->values();
+    if (selection == nullptr) {
+      // walk the runs instead of looking up the run of every row
+      const auto& end_positions = *run_length_column->end_positions();
+      ChunkOffset chunk_offset = 0;
+      for (size_t run = 0; run < values.size(); ++run) {
+        const ValueView<T> value = values[run];
+        for (; chunk_offset <= end_positions[run]; ++chunk_offset) func(chunk_offset, value);
+      }
+      return;
+    }
+    visit(run_length_column->size(), [&](const ChunkOffset chunk_offset) -> ValueView<T> {
+      return values[run_length_column->run_index(chunk_offset)];
+    });
+  } else {
+    // FrameOfReferenceColumns only exist for integral types
+    if constexpr (std::is_integral<T>::value) {
+      if (const auto frame_of_reference_column = dynamic_cast<const FrameOfReferenceColumn<T>*>(&column)) {
+        visit(frame_of_reference_column->size(),
+              [&](const ChunkOffset chunk_offset) { return frame_of_reference_column->get(chunk_offset); });
+        return;
+      }
+    }
+    Fail("Unsupported column type");
+  }
+}
+
+}  // namespace detail
+
+// Calls func(run_begin, chunk_id, referenced_offsets) for every run of consecutive positions of a ReferenceColumn that
+// point into the same chunk of the referenced table, so that the referenced column only has to be resolved once per
+// run. run_begin is the index of the run's first position and referenced_offsets are the offsets of the run within
+// the referenced chunk. Runs of NULL rows are skipped. With a selection, only the selected positions are visited and
+// run_begin is an index into the selection.
+template <typename Functor>
+void for_each_reference_run(const ReferenceColumn& column, const std::vector<ChunkOffset>* selection,
+                            const Functor& func) {
+  const auto& pos_list = *column.pos_list();
+  const auto row_count = selection ? selection->size() : pos_list.size();
+  const auto row_id = [&](const size_t index) -> const RowID& {
+    return pos_list[selection ? (*selection)[index] : index];
+  };
+
+  std::vector<ChunkOffset> referenced_offsets;
+  for (size_t run_begin = 0; run_begin < row_count;) {
+    const auto chunk_id = row_id(run_begin).chunk_id;
+
+    referenced_offsets.clear();
+    auto run_end = run_begin;
+    while (run_end < row_count && row_id(run_end).chunk_id == chunk_id) {
+      referenced_offsets.push_back(row_id(run_end).chunk_offset);
+      ++run_end;
+    }
+
+    if (chunk_id != NULL_ROW_ID.chunk_id) func(run_begin, chunk_id, referenced_offsets);
+    run_begin = run_end;
+  }
+}
+
+// same as above, for all positions of the column
+template <typename Functor>
+void for_each_reference_run(const ReferenceColumn& column, const Functor& func) {
+  for_each_reference_run(column, nullptr, func);
+}
+
+// Calls func(chunk_offset, value) for every row of a column of type T, in the order of the rows. The values are passed
+// as ValueView<T>, so strings are not copied, but point into the column. ReferenceColumns are resolved once per run of
+// positions that point into the same chunk. Their NULL rows are skipped.
+template <typename T, typename Functor>
+void for_each_value(const BaseColumn& column, const Functor& func) {
+  const auto reference_column = dynamic_cast<const ReferenceColumn*>(&column);
+  if (!reference_column) {
+    detail::for_each_value_in_selection<T>(column, nullptr, func);
+    return;
+  }
+
+  const auto& referenced_table = *reference_column->referenced_table();
+  for_each_reference_run(*reference_column, [&](const size_t run_begin, const ChunkID chunk_id,
+                                                const std::vector<ChunkOffset>& referenced_offsets) {
+    const auto referenced_column =
+        referenced_table.get_chunk(chunk_id).get_column(reference_column->referenced_column_id());
+    Assert(!std::dynamic_pointer_cast<const ReferenceColumn>(referenced_column),
+           "ReferenceColumns must not reference other ReferenceColumns");
+    detail::for_each_value_in_selection<T>(*referenced_column, &referenced_offsets,
+                                           [&](const ChunkOffset index, const auto& value) {
+                                             func(static_cast<ChunkOffset>(run_begin + index), value);
+                                           });
+  });
+}
+
+}  // namespace opossum
@@ -5,48 +5,189 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "bit_packed_attribute_vector.hpp"
 #include "fitted_attribute_vector.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/parallel.hpp"
 #include "value_column.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Below this number of rows per thread, starting a thread costs more than it saves
+constexpr size_t MIN_ROWS_PER_THREAD = size_t{1} << 16;
+
+// The hash-based encoding is only used while the hash table is small enough to be cheap to probe. Beyond this number
+// of distinct values, sorting is faster.
+constexpr size_t MAX_HASHED_DISTINCT_VALUES = size_t{1} << 16;
+
+template <typename ValueIDType, typename Functor>
+std::shared_ptr<BaseAttributeVector> create_fitted_attribute_vector(const size_t size, const Functor& write_value_ids) {
+  std::vector<ValueIDType> value_ids(size);
+  write_value_ids(value_ids.data());
+  return std::make_shared<FittedAttributeVector<ValueIDType>>(std::move(value_ids));
+}
+
+// Creates the attribute vector for a column of the given size and number of distinct values. write_value_ids(out) is
+// called with a plain array of the attribute vector's width (or 32 bit for bit-packing) and has to fill it with the
+// ValueID of each row. This way, the attribute vector is filled in bulk instead of going through the virtual set().
+template <typename Functor>
+std::shared_ptr<BaseAttributeVector> create_attribute_vector(const size_t size, const size_t unique_values_count,
+                                                             const AttributeVectorType attribute_vector_type,
+                                                             const Functor& write_value_ids) {
+  // The width of the ValueIDs only depends on the number of distinct values. The largest value of each width is not
+  // used as a ValueID, because it is what INVALID_VALUE_ID looks like after a down-cast.
+  Assert(unique_values_count < std::numeric_limits<uint32_t>::max(), "Unsupported attribute vector width!");
+
+  if (attribute_vector_type == AttributeVectorType::BitPacked) {
+    std::vector<ValueID::base_type> value_ids(size);
+    write_value_ids(value_ids.data());
+    const auto bit_width = BitPackedAttributeVector::required_bit_width(unique_values_count);
+    return std::make_shared<BitPackedAttributeVector>(value_ids, bit_width);
+  } else if (unique_values_count < std::numeric_limits<uint8_t>::max()) {
+    return create_fitted_attribute_vector<uint8_t>(size, write_value_ids);
+  } else if (unique_values_count < std::numeric_limits<uint16_t>::max()) {
+    return create_fitted_attribute_vector<uint16_t>(size, write_value_ids);
+  }
+  return create_fitted_attribute_vector<uint32_t>(size, write_value_ids);
+}
+
+// Collects the distinct values and creates the attribute vector from the values in sorted order: value_at(index)
+// returns the index-th smallest value and row_at(index) the row it belongs to.
+template <typename T, typename ValueAt, typename RowAt>
+std::shared_ptr<BaseAttributeVector> encode_sorted_values(std::vector<T>& dictionary, const size_t size,
+                                                          const ValueAt& value_at, const RowAt& row_at,
+                                                          const AttributeVectorType attribute_vector_type,
+                                                          const size_t thread_count) {
+  const auto starts_new_value = [&](const size_t index) { return index == 0 || value_at(index - 1) < value_at(index); };
+
+  // Parallel unique: each thread counts the distinct values that start in its range of the sorted values, so that the
+  // ValueID of the first of them is known before the dictionary is written.
+  std::vector<size_t> first_value_ids(thread_count + 1);
+  parallel_for_each_range(size, thread_count, [&](const size_t range_index, const size_t begin, const size_t end) {
+    for (auto index = begin; index < end; ++index) {
+      if (starts_new_value(index)) ++first_value_ids[range_index + 1];
+    }
+  });
+  std::partial_sum(first_value_ids.cbegin(), first_value_ids.cend(), first_value_ids.begin());
+
+  dictionary.resize(first_value_ids.back());
+  return create_attribute_vector(size, dictionary.size(), attribute_vector_type, [&](auto* value_ids) {
+    using ValueIDType = std::remove_pointer_t<decltype(value_ids)>;
+    parallel_for_each_range(size, thread_count, [&](const size_t range_index, const size_t begin, const size_t end) {
+      // a range that does not start with a new value continues the last value of the previous range
+      auto next_value_id = first_value_ids[range_index];
+      for (auto index = begin; index < end; ++index) {
+        if (starts_new_value(index)) dictionary[next_value_id++] = value_at(index);
+        value_ids[row_at(index)] = static_cast<ValueIDType>(next_value_id - 1);
+      }
+    });
+  });
+}
+
+}  // namespace
+
 template <typename T>
-DictionaryColumn<T>::DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column) {
+DictionaryColumn<T>::DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column,
+                                      const AttributeVectorType attribute_vector_type)
+    : _dictionary{std::make_shared<ValueVector<T>>()} {
   auto val_column = std::dynamic_pointer_cast<ValueColumn<T>>(base_column);
   Assert(val_column != nullptr, "Compression is only supported for value columns!");
 
   const auto& values = val_column->values();
   Assert(!values.empty(), "Cannot compress empty value column!");
 
-  _dictionary = std::make_shared<std::vector<T>>(values.cbegin(), values.cend());
-  std::sort(_dictionary->begin(), _dictionary->end());
-  auto last = std::unique(_dictionary->begin(), _dictionary->end());
-  _dictionary->erase(last, _dictionary->end());
+  if (!_encode_by_hashing(values, attribute_vector_type)) {
+    _encode_by_sorting(values, attribute_vector_type);
+  }
+}
 
-  const size_t attr_size = values.size();
-  Assert(attr_size < std::numeric_limits<uint32_t>::max(), "Unsupported attribute vector width!");
+template <typename T>
+bool DictionaryColumn<T>::_encode_by_hashing(const ValueVector<T>& values,
+                                             const AttributeVectorType attribute_vector_type) {
+  // Each distinct value gets a preliminary ValueID in the order of its first occurrence. Strings are referenced as
+  // std::string_views into the value column, so they are only copied once, into the final dictionary.
+  using Value = typename ValueVector<T>::value_type;
+  std::unordered_map<Value, ValueID::base_type> preliminary_value_ids;
+  std::vector<Value> unsorted_dictionary;
+  std::vector<ValueID::base_type> row_value_ids(values.size());
 
-  if (attr_size < std::numeric_limits<uint8_t>::max()) {
-    _attribute_vector = std::make_shared<FittedAttributeVector<uint8_t>>(attr_size);
-  } else if (attr_size < std::numeric_limits<uint16_t>::max()) {
-    _attribute_vector = std::make_shared<FittedAttributeVector<uint16_t>>(attr_size);
-  } else {
-    _attribute_vector = std::make_shared<FittedAttributeVector<uint32_t>>(attr_size);
+  for (size_t row = 0; row < values.size(); ++row) {
+    const auto next_value_id = static_cast<ValueID::base_type>(unsorted_dictionary.size());
+    const auto insert_result = preliminary_value_ids.try_emplace(values[row], next_value_id);
+    if (insert_result.second) {
+      if (unsorted_dictionary.size() == MAX_HASHED_DISTINCT_VALUES) return false;
+      unsorted_dictionary.push_back(values[row]);
+    }
+    row_value_ids[row] = insert_result.first->second;
   }
 
-  for (size_t attr_value_id = 0; attr_value_id < values.size(); ++attr_value_id) {
-    const auto value = values[attr_value_id];
-    const auto value_it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
-    // we can assume that lower_bound will find a match,
-    // as we inserted the values into the dictionary before
-    const auto dict_value_id = value_it - _dictionary->cbegin();
+  // Only the (few) distinct values are sorted. final_value_ids maps the preliminary ValueIDs to the final ones.
+  std::vector<ValueID::base_type> sorted_value_ids(unsorted_dictionary.size());
+  std::iota(sorted_value_ids.begin(), sorted_value_ids.end(), ValueID::base_type{0});
+  std::sort(sorted_value_ids.begin(), sorted_value_ids.end(),
+            [&](const auto left, const auto right) { return unsorted_dictionary[left] < unsorted_dictionary[right]; });
 
-    _attribute_vector->set(attr_value_id, ValueID(dict_value_id));
+  std::vector<ValueID::base_type> final_value_ids(unsorted_dictionary.size());
+  _dictionary->reserve(unsorted_dictionary.size());
+  for (size_t value_id = 0; value_id < sorted_value_ids.size(); ++value_id) {
+    final_value_ids[sorted_value_ids[value_id]] = static_cast<ValueID::base_type>(value_id);
+    _dictionary->push_back(unsorted_dictionary[sorted_value_ids[value_id]]);
   }
+
+  _attribute_vector =
+      create_attribute_vector(values.size(), _dictionary->size(), attribute_vector_type, [&](auto* value_ids) {
+        using ValueIDType = std::remove_pointer_t<decltype(value_ids)>;
+        const auto thread_count = parallel_thread_count(values.size(), MIN_ROWS_PER_THREAD);
+        parallel_for_each_range(values.size(), thread_count, [&](const size_t, const size_t begin, const size_t end) {
+          for (auto row = begin; row < end; ++row) {
+            value_ids[row] = static_cast<ValueIDType>(final_value_ids[row_value_ids[row]]);
+          }
+        });
+      });
+  return true;
+}
+
+template <typename T>
+void DictionaryColumn<T>::_encode_by_sorting(const ValueVector<T>& values,
+                                             const AttributeVectorType attribute_vector_type) {
+  const auto thread_count = parallel_thread_count(values.size(), MIN_ROWS_PER_THREAD);
+  std::vector<typename ValueVector<T>::value_type> dictionary;
+
+  if constexpr (std::is_arithmetic<T>::value) {
+    // Numbers are sorted together with their positions, which tell us where to write the ValueID of each value
+    std::vector<std::pair<T, ChunkOffset>> sorted_values(values.size());
+    for (ChunkOffset row = 0; row < values.size(); ++row) sorted_values[row] = {values[row], row};
+    parallel_sort(sorted_values.begin(), sorted_values.end(),
+                  [](const auto& left, const auto& right) { return left.first < right.first; }, thread_count);
+
+    _attribute_vector = encode_sorted_values(
+        dictionary, values.size(), [&](const size_t index) { return sorted_values[index].first; },
+        [&](const size_t index) { return sorted_values[index].second; }, attribute_vector_type, thread_count);
+  } else {
+    // Strings are sorted by their positions, comparing their inline prefixes first
+    std::vector<ChunkOffset> sorted_rows(values.size());
+    std::iota(sorted_rows.begin(), sorted_rows.end(), ChunkOffset{0});
+    parallel_sort(sorted_rows.begin(), sorted_rows.end(),
+                  [&](const ChunkOffset left, const ChunkOffset right) { return values.compare(left, right) < 0; },
+                  thread_count);
+
+    _attribute_vector = encode_sorted_values(
+        dictionary, values.size(), [&](const size_t index) { return values[sorted_rows[index]]; },
+        [&](const size_t index) { return sorted_rows[index]; }, attribute_vector_type, thread_count);
+  }
+
+  _dictionary = std::make_shared<ValueVector<T>>(std::move(dictionary));
 }
 
 template <typename T>
@@ -58,7 +199,7 @@ template <typename T>
 const T DictionaryColumn<T>::get(const size_t i) const {
   auto dict_id = _attribute_vector->get(i);
   DebugAssert(dict_id < _dictionary->size(), "Index out of bounds!");
-  return (*_dictionary)[dict_id];
+  return T((*_dictionary)[dict_id]);
 }
 
 template <typename T>
@@ -67,7 +208,7 @@ void DictionaryColumn<T>::append(const AllTypeVariant&) {
 }
 
 template <typename T>
-std::shared_ptr<const std::vector<T>> DictionaryColumn<T>::dictionary() const {
+std::shared_ptr<const ValueVector<T>> DictionaryColumn<T>::dictionary() const {
   return _dictionary;
 }
 
@@ -77,17 +218,21 @@ std::shared_ptr<const BaseAttributeVector> DictionaryColumn<T>::attribute_vector
 }
 
 template <typename T>
-const T& DictionaryColumn<T>::value_by_value_id(ValueID value_id) const {
+typename ValueVector<T>::const_reference DictionaryColumn<T>::value_by_value_id(ValueID value_id) const {
   return _dictionary->at(value_id);
 }
 
 template <typename T>
 ValueID DictionaryColumn<T>::lower_bound(T value) const {
-  const auto lower_bound_it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
-  if (lower_bound_it == _dictionary->cend()) {
+  size_t lower_bound_pos;
+  if constexpr (std::is_same<T, std::string>::value) {
+    lower_bound_pos = _dictionary->lower_bound(value);
+  } else {
+    lower_bound_pos = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value) - _dictionary->cbegin();
+  }
+  if (lower_bound_pos == _dictionary->size()) {
     return INVALID_VALUE_ID;
   }
-  const auto lower_bound_pos = lower_bound_it - _dictionary->cbegin();
   return static_cast<ValueID>(lower_bound_pos);
 }
 
@@ -99,11 +244,15 @@ ValueID DictionaryColumn<T>::lower_bound(const AllTypeVariant& value) const {
 
 template <typename T>
 ValueID DictionaryColumn<T>::upper_bound(T value) const {
-  const auto upper_bound_id = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value);
-  if (upper_bound_id == _dictionary->cend()) {
+  size_t upper_bound_pos;
+  if constexpr (std::is_same<T, std::string>::value) {
+    upper_bound_pos = _dictionary->upper_bound(value);
+  } else {
+    upper_bound_pos = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value) - _dictionary->cbegin();
+  }
+  if (upper_bound_pos == _dictionary->size()) {
     return INVALID_VALUE_ID;
   }
-  const auto upper_bound_pos = upper_bound_id - _dictionary->cbegin();
   return static_cast<ValueID>(upper_bound_pos);
 }
 
@@ -123,6 +272,11 @@ size_t DictionaryColumn<T>::size() const {
   return _attribute_vector->size();
 }
 
+template <typename T>
+size_t DictionaryColumn<T>::estimate_memory_usage() const {
+  return values_memory_usage(*_dictionary) + _attribute_vector->estimate_memory_usage();
+}
+
 EXPLICITLY_INSTANTIATE_COLUMN_TYPES(DictionaryColumn);
 
 }  // namespace opossum
@@ -7,7 +7,8 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
-#include "base_column.hpp"
+#include "base_dictionary_column.hpp"
+#include "string_storage.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -18,14 +19,21 @@ class BaseAttributeVector;
 // types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max()
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
-// Dictionary is a specific column type that stores all its values in a vector
+// The attribute vector implementations a DictionaryColumn can use. Fitted stores the ValueIDs in the smallest of 8, 16,
+// or 32 bits that fits the dictionary and is the fastest to access. BitPacked uses exactly as many bits as the
+// dictionary requires, which saves memory for low-cardinality columns.
+enum class AttributeVectorType { Fitted, BitPacked };
+
+// Dictionary is a specific column type that stores each distinct value once in a sorted dictionary (a vector or, for
+// strings, a StringStorage) and the ValueID of each row in an attribute vector
 template <typename T>
-class DictionaryColumn : public BaseColumn {
+class DictionaryColumn : public BaseDictionaryColumn {
  public:
   /**
    * Creates a Dictionary column from a given value column.
    */
-  explicit DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column);
+  explicit DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column,
+                            const AttributeVectorType attribute_vector_type = AttributeVectorType::Fitted);
 
   // SEMINAR INFORMATION: Since most of these methods depend on the template parameter, you will have to implement
   // the DictionaryColumn in this file. Replace the method signatures with actual implementations.
@@ -40,36 +48,45 @@ class DictionaryColumn : public BaseColumn {
   void append(const AllTypeVariant&) override;
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const;
+  std::shared_ptr<const ValueVector<T>> dictionary() const;
 
   // returns an underlying data structure
-  std::shared_ptr<const BaseAttributeVector> attribute_vector() const;
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const override;
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const;
+  typename ValueVector<T>::const_reference value_by_value_id(ValueID value_id) const;
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
   ValueID lower_bound(T value) const;
 
   // same as lower_bound(T), but accepts an AllTypeVariant
-  ValueID lower_bound(const AllTypeVariant& value) const;
+  ValueID lower_bound(const AllTypeVariant& value) const override;
 
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
   ValueID upper_bound(T value) const;
 
   // same as upper_bound(T), but accepts an AllTypeVariant
-  ValueID upper_bound(const AllTypeVariant& value) const;
+  ValueID upper_bound(const AllTypeVariant& value) const override;
 
   // return the number of unique_values (dictionary entries)
-  size_t unique_values_count() const;
+  size_t unique_values_count() const override;
 
   // return the number of entries
   size_t size() const override;
 
+  size_t estimate_memory_usage() const override;
+
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  // Assigns the ValueIDs via a hash table and sorts only the distinct values afterwards. Returns false without
+  // creating the column if there are too many distinct values for this to be fast.
+  bool _encode_by_hashing(const ValueVector<T>& values, const AttributeVectorType attribute_vector_type);
+
+  // assigns the ValueIDs by sorting all values, using multiple threads for large columns
+  void _encode_by_sorting(const ValueVector<T>& values, const AttributeVectorType attribute_vector_type);
+
+  std::shared_ptr<ValueVector<T>> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 };
 
@@ -0,0 +1,197 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "frame_of_reference_column.hpp"
+#include "resolve_type.hpp"
+#include "string_storage.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+namespace {
+
+// number of ranges of consecutive rows that are sampled from columns larger than the sample size
+constexpr size_t SAMPLE_RANGE_COUNT = 8;
+
+// the encodings considered by the advisor, from the fastest to the slowest to scan
+constexpr EncodingType CANDIDATE_ENCODINGS[] = {EncodingType::Dictionary, EncodingType::FrameOfReference,
+                                                EncodingType::BitPackedDictionary, EncodingType::RunLength,
+                                                EncodingType::Unencoded};
+
+template <typename T>
+ColumnSampleStatistics sample_values(const ValueVector<T>& values, const size_t sample_size) {
+  ColumnSampleStatistics statistics;
+  statistics.row_count = values.size();
+  if (values.empty()) return statistics;
+
+  // Ranges of consecutive rows are sampled instead of single rows, so that runs and the value ranges of
+  // frame-of-reference blocks are preserved. The ranges are spread evenly, the first one starting at the first row and
+  // the last one ending at the last row.
+  const auto range_count = values.size() <= sample_size ? size_t{1} : SAMPLE_RANGE_COUNT;
+  const auto range_length = std::max(size_t{1}, std::min(values.size(), sample_size / range_count));
+  const auto range_distance = range_count == 1 ? size_t{0} : (values.size() - range_length) / (range_count - 1);
+
+  ValueVector<T> sampled_values;
+  sampled_values.reserve(range_count * range_length);
+  std::unordered_map<typename ValueVector<T>::value_type, size_t> frequencies;
+  size_t compared_pairs = 0;
+  size_t value_changes = 0;
+  auto is_sorted = true;
+
+  for (size_t range = 0; range < range_count; ++range) {
+    const auto range_begin = range * range_distance;
+    if (range > 0 && values[range_begin] < sampled_values.back()) is_sorted = false;
+    for (auto row = range_begin; row < range_begin + range_length; ++row) {
+      const auto value = values[row];
+      sampled_values.push_back(value);
+      ++frequencies[value];
+
+      if (row > range_begin) {
+        ++compared_pairs;
+        if (value != values[row - 1]) ++value_changes;
+        if (value < values[row - 1]) is_sorted = false;
+      }
+    }
+  }
+
+  const auto row_count = values.size();
+  const auto sampled_rows = sampled_values.size();
+
+  // The distinct count is extrapolated with the GEE estimator: values that occur more than once in the sample are
+  // likely to have been seen already, values that occur only once stand for sqrt(row_count / sampled_rows) values.
+  // GEE underestimates unique columns, which are common (e.g., keys), so a sample without duplicates counts as unique.
+  const auto sampled_distinct_count = frequencies.size();
+  const auto singletons = static_cast<size_t>(
+      std::count_if(frequencies.cbegin(), frequencies.cend(), [](const auto& entry) { return entry.second == 1; }));
+  if (singletons == sampled_rows) {
+    statistics.distinct_count = row_count;
+  } else {
+    const auto scale = std::sqrt(static_cast<double>(row_count) / static_cast<double>(sampled_rows));
+    const auto estimated_distinct_count =
+        scale * static_cast<double>(singletons) + static_cast<double>(sampled_distinct_count - singletons);
+    statistics.distinct_count =
+        std::clamp(static_cast<size_t>(std::llround(estimated_distinct_count)), sampled_distinct_count, row_count);
+  }
+
+  if (compared_pairs == 0) {
+    statistics.run_count = 1;
+  } else {
+    const auto change_rate = static_cast<double>(value_changes) / static_cast<double>(compared_pairs);
+    statistics.run_count = 1 + static_cast<size_t>(std::llround(change_rate * static_cast<double>(row_count - 1)));
+  }
+
+  statistics.is_sorted = is_sorted;
+  statistics.value_bytes = (values_memory_usage(sampled_values) + sampled_rows - 1) / sampled_rows;
+
+  // The value ranges of the frame-of-reference blocks are determined on all rows instead of the sample. A single
+  // outlier can make a block too wide to be encoded, and finding it only takes one cheap pass over the values.
+  if constexpr (std::is_integral<T>::value) {
+    constexpr auto block_size = FrameOfReferenceColumn<T>::BLOCK_SIZE;
+    uint64_t max_block_range = 0;
+    for (size_t block_begin = 0; block_begin < row_count; block_begin += block_size) {
+      const auto block_end = std::min(row_count, block_begin + block_size);
+      const auto minmax = std::minmax_element(values.cbegin() + block_begin, values.cbegin() + block_end);
+      max_block_range =
+          std::max(max_block_range, static_cast<uint64_t>(*minmax.second) - static_cast<uint64_t>(*minmax.first));
+    }
+
+    if (max_block_range < std::numeric_limits<ValueID::base_type>::max()) {
+      statistics.frame_of_reference_bit_width = BitPackedAttributeVector::required_bit_width(max_block_range + 1);
+    }
+  }
+
+  return statistics;
+}
+
+// number of bytes of a BitPackedAttributeVector
+size_t bit_packed_memory_usage(const size_t row_count, const uint8_t bit_width) {
+  return ((row_count * bit_width + 63) / 64 + BitPackedAttributeVector::PADDING_WORDS) * sizeof(uint64_t);
+}
+
+}  // namespace
+
+EncodingAdvisor::EncodingAdvisor(const size_t sample_size) : _sample_size{sample_size} {
+  Assert(sample_size >= SAMPLE_RANGE_COUNT, "Sample size is too small!");
+}
+
+ColumnSampleStatistics EncodingAdvisor::sample(const std::shared_ptr<const BaseColumn>& column,
+                                               const std::string& column_type) const {
+  ColumnSampleStatistics statistics;
+  resolve_data_type(column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    const auto value_column = std::dynamic_pointer_cast<const ValueColumn<Type>>(column);
+    Assert(value_column != nullptr, "Only value columns can be sampled!");
+    statistics = sample_values<Type>(value_column->values(), _sample_size);
+  });
+  return statistics;
+}
+
+std::optional<size_t> EncodingAdvisor::estimate_memory_usage(const ColumnSampleStatistics& statistics,
+                                                             const EncodingType encoding_type) {
+  const auto row_count = statistics.row_count;
+  const auto distinct_count = statistics.distinct_count;
+  const auto dictionary_bytes = distinct_count * statistics.value_bytes;
+
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      return row_count * statistics.value_bytes;
+
+    case EncodingType::Dictionary: {
+      // see DictionaryColumn for how the width of the ValueIDs is chosen
+      if (distinct_count >= std::numeric_limits<uint32_t>::max()) return std::nullopt;
+      const auto value_id_bytes = distinct_count < std::numeric_limits<uint8_t>::max()
+                                      ? sizeof(uint8_t)
+                                      : distinct_count < std::numeric_limits<uint16_t>::max() ? sizeof(uint16_t)
+                                                                                              : sizeof(uint32_t);
+      return dictionary_bytes + row_count * value_id_bytes;
+    }
+
+    case EncodingType::BitPackedDictionary:
+      if (distinct_count >= std::numeric_limits<uint32_t>::max()) return std::nullopt;
+      return dictionary_bytes +
+             bit_packed_memory_usage(row_count, BitPackedAttributeVector::required_bit_width(distinct_count));
+
+    case EncodingType::RunLength:
+      return statistics.run_count * (statistics.value_bytes + sizeof(ChunkOffset));
+
+    case EncodingType::FrameOfReference: {
+      if (!statistics.frame_of_reference_bit_width) return std::nullopt;
+      // both int and long columns use the same block size
+      constexpr auto block_size = FrameOfReferenceColumn<int32_t>::BLOCK_SIZE;
+      const auto block_count = (row_count + block_size - 1) / block_size;
+      return block_count * statistics.value_bytes +
+             bit_packed_memory_usage(row_count, *statistics.frame_of_reference_bit_width);
+    }
+  }
+  Fail("Unknown encoding type");
+  return std::nullopt;
+}
+
+EncodingType EncodingAdvisor::choose_encoding(const std::shared_ptr<const BaseColumn>& column,
+                                              const std::string& column_type) const {
+  const auto statistics = sample(column, column_type);
+
+  auto best_encoding_type = EncodingType::Unencoded;
+  auto best_memory_usage = std::numeric_limits<size_t>::max();
+  for (const auto encoding_type : CANDIDATE_ENCODINGS) {
+    const auto memory_usage = estimate_memory_usage(statistics, encoding_type);
+    if (memory_usage && *memory_usage < best_memory_usage) {
+      best_encoding_type = encoding_type;
+      best_memory_usage = *memory_usage;
+    }
+  }
+  return best_encoding_type;
+}
+
+}  // namespace opossum
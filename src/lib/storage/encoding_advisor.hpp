@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// Properties of a ValueColumn that determine how well the encodings compress it. They are measured on a sample of the
+// column and extrapolated to all of its rows.
+struct ColumnSampleStatistics {
+  size_t row_count = 0;
+  size_t distinct_count = 0;
+  size_t run_count = 0;
+  bool is_sorted = false;
+
+  // average number of bytes per value, including the heap allocations of strings
+  size_t value_bytes = 0;
+
+  // number of bits needed for the offsets of a FrameOfReferenceColumn. Not set for columns that cannot be
+  // frame-of-reference encoded, i.e., non-integral columns and columns whose blocks span too many values.
+  std::optional<uint8_t> frame_of_reference_bit_width;
+};
+
+// The encoding that Table::compress_chunk_adaptively applied to a column
+struct ColumnEncodingDecision {
+  EncodingType encoding_type;
+
+  // true if the encoding was given by the caller instead of being chosen by the EncodingAdvisor
+  bool is_override;
+
+  // memory usage of the column after encoding, see BaseColumn::estimate_memory_usage
+  size_t memory_usage;
+};
+
+// The EncodingAdvisor picks the encoding of a ValueColumn that is expected to need the least memory. Instead of
+// encoding the column with every encoding, it samples a few ranges of consecutive rows and estimates the sizes from
+// them.
+class EncodingAdvisor {
+ public:
+  static constexpr size_t DEFAULT_SAMPLE_SIZE = 4096;
+
+  explicit EncodingAdvisor(const size_t sample_size = DEFAULT_SAMPLE_SIZE);
+
+  // samples the given ValueColumn of type column_type
+  ColumnSampleStatistics sample(const std::shared_ptr<const BaseColumn>& column, const std::string& column_type) const;
+
+  // Returns the estimated number of bytes a column with the given statistics needs in the given encoding, or
+  // std::nullopt if the encoding cannot be applied to it
+  static std::optional<size_t> estimate_memory_usage(const ColumnSampleStatistics& statistics,
+                                                     const EncodingType encoding_type);
+
+  // Returns the encoding with the smallest estimated memory usage. If estimates are equal, the encoding that is
+  // faster to scan wins.
+  EncodingType choose_encoding(const std::shared_ptr<const BaseColumn>& column, const std::string& column_type) const;
+
+ protected:
+  const size_t _sample_size;
+};
+
+}  // namespace opossum
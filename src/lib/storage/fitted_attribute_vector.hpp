@@ -1,6 +1,7 @@
 #pragma once
 
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "base_attribute_vector.hpp"
@@ -14,24 +15,25 @@ template <typename T>
 class FittedAttributeVector : public BaseAttributeVector {
  public:
   explicit FittedAttributeVector(const size_t size) : BaseAttributeVector() {
-    size_t max = std::numeric_limits<T>::max();
-    Assert(size <= max,
-           "Size " + std::to_string(size) + "too large for vector of width " + std::to_string(width()) + "!");
-
     // we resize the data vector here, so that we can freely insert values in the set() method
     // this assumes that filling the attribute vector with values from the value column is done
     // immediately after instantiation, so that the data vector is filled with correct values before use
     _data.resize(size);
   }
 
+  // creates an attribute vector that holds the given ValueIDs
+  explicit FittedAttributeVector(std::vector<T>&& data) : BaseAttributeVector(), _data(std::move(data)) {}
+
   ValueID get(const size_t i) const override {
     DebugAssert(i < _data.size(), "Index out of bounds!");
     return ValueID{_data[i]};
   }
 
   void set(const size_t i, const ValueID value_id) override {
-    Assert(i <= size(), "Index " + std::to_string(i) + " too large for fitted attribute vector of size " +
+    Assert(i < size(), "Index " + std::to_string(i) + " too large for fitted attribute vector of size " +
                             std::to_string(size()) + "!");
+    Assert(static_cast<uint64_t>(value_id) <= std::numeric_limits<T>::max(),
+           "ValueID " + std::to_string(value_id) + " too large for vector of width " + std::to_string(width()) + "!");
 
     _data[i] = static_cast<T>(value_id);
   }
@@ -40,6 +42,11 @@ class FittedAttributeVector : public BaseAttributeVector {
 
   AttributeVectorWidth width() const override { return sizeof(T); }
 
+  size_t estimate_memory_usage() const override { return _data.size() * sizeof(T); }
+
+  // returns all ValueIDs in their fitted width. Use this instead of get() when accessing many values, e.g., in scans.
+  const std::vector<T>& values() const { return _data; }
+
  protected:
   std::vector<T> _data;
 };
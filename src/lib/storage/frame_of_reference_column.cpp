@@ -0,0 +1,111 @@
+#include "frame_of_reference_column.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrameOfReferenceColumn<T>::FrameOfReferenceColumn(const std::shared_ptr<BaseColumn>& base_column)
+    : _block_minimums{std::make_shared<std::vector<T>>()} {
+  auto val_column = std::dynamic_pointer_cast<ValueColumn<T>>(base_column);
+  Assert(val_column != nullptr, "Compression is only supported for value columns!");
+
+  const auto& values = val_column->values();
+  Assert(!values.empty(), "Cannot compress empty value column!");
+
+  // All blocks share one bit width, which is determined by the block with the widest value range. The offsets are
+  // stored as ValueIDs and have to stay below the largest ValueID, which is reserved as INVALID_VALUE_ID.
+  uint64_t max_offset = 0;
+  for (size_t block_begin = 0; block_begin < values.size(); block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(values.size(), block_begin + BLOCK_SIZE);
+    const auto minmax = std::minmax_element(values.cbegin() + block_begin, values.cbegin() + block_end);
+    _block_minimums->push_back(*minmax.first);
+
+    const auto block_range = static_cast<uint64_t>(*minmax.second) - static_cast<uint64_t>(*minmax.first);
+    Assert(block_range < std::numeric_limits<ValueID::base_type>::max(),
+           "Value range of block is too wide for frame-of-reference encoding!");
+    max_offset = std::max(max_offset, block_range);
+  }
+
+  std::vector<ValueID::base_type> offsets(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    const auto minimum = (*_block_minimums)[i / BLOCK_SIZE];
+    offsets[i] = static_cast<ValueID::base_type>(static_cast<uint64_t>(values[i]) - static_cast<uint64_t>(minimum));
+  }
+
+  const auto bit_width = BitPackedAttributeVector::required_bit_width(max_offset + 1);
+  _offsets = std::make_shared<BitPackedAttributeVector>(offsets, bit_width);
+}
+
+template <typename T>
+const AllTypeVariant FrameOfReferenceColumn<T>::operator[](const size_t i) const {
+  return get(i);
+}
+
+template <typename T>
+const T FrameOfReferenceColumn<T>::get(const size_t i) const {
+  DebugAssert(i < size(), "Index out of bounds!");
+  // The addition is done unsigned, because the offset may exceed the maximum of a signed T for wide blocks
+  return static_cast<T>(static_cast<uint64_t>((*_block_minimums)[i / BLOCK_SIZE]) +
+                        static_cast<uint64_t>(_offsets->get(i)));
+}
+
+template <typename T>
+void FrameOfReferenceColumn<T>::append(const AllTypeVariant&) {
+  throw std::runtime_error("Appending to a compressed column is not supported!");
+}
+
+template <typename T>
+void FrameOfReferenceColumn<T>::unpack(const size_t offset, const size_t count, T* out) const {
+  DebugAssert(offset + count <= size(), "Index out of bounds!");
+
+  using UnsignedT = std::make_unsigned_t<T>;
+  std::array<ValueID::base_type, BLOCK_SIZE> unpacked;
+
+  for (auto position = offset; position < offset + count;) {
+    const auto block_end = std::min(offset + count, (position / BLOCK_SIZE + 1) * BLOCK_SIZE);
+    const auto length = block_end - position;
+    const auto minimum = static_cast<UnsignedT>((*_block_minimums)[position / BLOCK_SIZE]);
+
+    _offsets->unpack(position, length, unpacked.data());
+    for (size_t i = 0; i < length; ++i) {
+      out[position - offset + i] = static_cast<T>(minimum + static_cast<UnsignedT>(unpacked[i]));
+    }
+    position = block_end;
+  }
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> FrameOfReferenceColumn<T>::block_minimums() const {
+  return _block_minimums;
+}
+
+template <typename T>
+std::shared_ptr<const BitPackedAttributeVector> FrameOfReferenceColumn<T>::offsets() const {
+  return _offsets;
+}
+
+template <typename T>
+size_t FrameOfReferenceColumn<T>::size() const {
+  return _offsets->size();
+}
+
+template <typename T>
+size_t FrameOfReferenceColumn<T>::estimate_memory_usage() const {
+  return values_memory_usage(*_block_minimums) + _offsets->estimate_memory_usage();
+}
+
+// Frame-of-reference encoding only makes sense for integral types, so it is not instantiated for all COLUMN_TYPES
+template class FrameOfReferenceColumn<int32_t>;
+template class FrameOfReferenceColumn<int64_t>;
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_column.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceColumn is a specific column type for integral columns with a narrow value range (e.g., timestamps or
+// surrogate keys). The column is split into blocks of BLOCK_SIZE rows. For each block, only its minimum is stored at
+// full width; each row is stored as its offset to that minimum in a BitPackedAttributeVector.
+template <typename T>
+class FrameOfReferenceColumn : public BaseColumn {
+  static_assert(std::is_integral<T>::value, "Frame-of-reference encoding is only supported for integral types");
+
+ public:
+  static constexpr ChunkOffset BLOCK_SIZE = 2048;
+
+  /**
+   * Creates a frame-of-reference encoded column from a given value column.
+   */
+  explicit FrameOfReferenceColumn(const std::shared_ptr<BaseColumn>& base_column);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position.
+  const T get(const size_t i) const;
+
+  // frame-of-reference encoded columns are immutable
+  void append(const AllTypeVariant&) override;
+
+  // Decompresses the values [offset, offset + count) into out. The offsets are unpacked block-wise and the minimums
+  // are added in a loop that the compiler vectorizes.
+  void unpack(const size_t offset, const size_t count, T* out) const;
+
+  // returns the minimum of each block
+  std::shared_ptr<const std::vector<T>> block_minimums() const;
+
+  // returns the offset of each row to the minimum of its block
+  std::shared_ptr<const BitPackedAttributeVector> offsets() const;
+
+  // return the number of entries
+  size_t size() const override;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _block_minimums;
+  std::shared_ptr<BitPackedAttributeVector> _offsets;
+};
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#include "group_key_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "base_dictionary_column.hpp"
+#include "dictionary_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
+    : _index_column{index_columns.size() == 1
+                        ? std::dynamic_pointer_cast<const BaseDictionaryColumn>(index_columns.front())
+                        : nullptr} {
+  Assert(_index_column != nullptr, "GroupKeyIndex only supports a single dictionary column!");
+
+  const auto& attribute_vector = *_index_column->attribute_vector();
+  const auto row_count = attribute_vector.size();
+
+  // Counting sort: count the rows per ValueID, turn the counts into start offsets, and place each position at the next
+  // free slot of its group. As the rows are visited in order, the positions within each group are sorted.
+  _value_start_offsets.assign(_index_column->unique_values_count() + 1, 0);
+  for (size_t chunk_offset = 0; chunk_offset < row_count; ++chunk_offset) {
+    ++_value_start_offsets[attribute_vector.get(chunk_offset) + 1];
+  }
+  for (size_t value_id = 1; value_id < _value_start_offsets.size(); ++value_id) {
+    _value_start_offsets[value_id] += _value_start_offsets[value_id - 1];
+  }
+
+  auto next_offsets = _value_start_offsets;
+  _positions.resize(row_count);
+  for (size_t chunk_offset = 0; chunk_offset < row_count; ++chunk_offset) {
+    _positions[next_offsets[attribute_vector.get(chunk_offset)]++] = static_cast<ChunkOffset>(chunk_offset);
+  }
+}
+
+size_t GroupKeyIndex::estimate_memory_usage() const {
+  return values_memory_usage(_value_start_offsets) + values_memory_usage(_positions);
+}
+
+BaseIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _group_begin(_index_column->lower_bound(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _group_begin(_index_column->upper_bound(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_cbegin() const { return _positions.cbegin(); }
+
+BaseIndex::Iterator GroupKeyIndex::_cend() const { return _positions.cend(); }
+
+std::vector<std::shared_ptr<const BaseColumn>> GroupKeyIndex::_get_index_columns() const { return {_index_column}; }
+
+void GroupKeyIndex::_insert(const ChunkOffset, const std::vector<AllTypeVariant>&) {
+  Fail("GroupKeyIndex does not support inserting rows, as dictionary columns are immutable");
+}
+
+BaseIndex::Iterator GroupKeyIndex::_group_begin(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) return _positions.cend();
+  return _positions.cbegin() + _value_start_offsets[value_id];
+}
+
+}  // namespace opossum
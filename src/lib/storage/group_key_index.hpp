@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionaryColumn;
+
+// The group-key index of a dictionary column groups the positions of all rows by their ValueID. As the dictionary is
+// sorted, this orders the positions by value. _value_start_offsets holds, for each ValueID, where its group starts in
+// _positions, followed by one entry for the end of the last group. Within a group, the positions are sorted.
+// A lookup therefore is a binary search in the dictionary and one access to the offsets.
+class GroupKeyIndex : public BaseIndex {
+ public:
+  // creates the index of a single dictionary column
+  explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+
+  size_t estimate_memory_usage() const;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+  std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const override;
+  void _insert(const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values) override;
+
+  // returns an iterator to the start of the group of the given ValueID. INVALID_VALUE_ID is the end of all groups.
+  Iterator _group_begin(const ValueID value_id) const;
+
+  const std::shared_ptr<const BaseDictionaryColumn> _index_column;
+  std::vector<size_t> _value_start_offsets;
+  std::vector<ChunkOffset> _positions;
+};
+
+}  // namespace opossum
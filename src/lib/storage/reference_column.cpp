@@ -0,0 +1,122 @@
+#include "reference_column.hpp"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+ReferenceColumn::ReferenceColumn(const std::shared_ptr<const Table> referenced_table,
+                                 const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
+    : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {
+  Assert(_referenced_table != nullptr, "ReferenceColumn needs a referenced table!");
+  Assert(_pos_list != nullptr, "ReferenceColumn needs a position list!");
+}
+
+const AllTypeVariant ReferenceColumn::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+
+  const auto& row_id = _pos_list->at(i);
+  if (row_id == NULL_ROW_ID) {
+    AllTypeVariant value;
+    resolve_data_type(_referenced_table->column_type(_referenced_column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      value = Type{};
+    });
+    return value;
+  }
+
+  const auto& chunk = _referenced_table->get_chunk(row_id.chunk_id);
+  return (*chunk.get_column(_referenced_column_id))[row_id.chunk_offset];
+}
+
+size_t ReferenceColumn::size() const { return _pos_list->size(); }
+
+size_t ReferenceColumn::estimate_memory_usage() const { return _pos_list->size() * sizeof(RowID); }
+
+const std::shared_ptr<const PosList> ReferenceColumn::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table> ReferenceColumn::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceColumn::referenced_column_id() const { return _referenced_column_id; }
+
+namespace {
+
+// Adds the ReferenceColumns for positions that only point into the chunks [begin_chunk_id, end_chunk_id) of the table.
+// Only these chunks are inspected.
+void add_reference_columns_for_chunks(Chunk& chunk, const std::shared_ptr<const Table>& table,
+                                      const ChunkID begin_chunk_id, const ChunkID end_chunk_id,
+                                      const std::shared_ptr<const PosList>& positions) {
+  // chunks without columns are the empty first chunk of a table that only has column definitions
+  std::vector<ChunkID> chunks_with_columns;
+  for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+    if (table->get_chunk(chunk_id).col_count() > 0) chunks_with_columns.push_back(chunk_id);
+  }
+
+  auto references = false;
+  if (!chunks_with_columns.empty()) {
+    const auto& first_chunk = table->get_chunk(chunks_with_columns.front());
+    references = std::dynamic_pointer_cast<const ReferenceColumn>(first_chunk.get_column(ColumnID{0})) != nullptr;
+  }
+
+  if (!references) {
+    for (ColumnID column_id{0}; column_id < table->col_count(); ++column_id) {
+      chunk.add_column(std::make_shared<ReferenceColumn>(table, column_id, positions));
+    }
+    return;
+  }
+
+  // a column's PosList in each chunk, mapped to the resolved positions
+  std::map<std::vector<std::shared_ptr<const PosList>>, std::shared_ptr<const PosList>> resolved_pos_lists;
+
+  for (ColumnID column_id{0}; column_id < table->col_count(); ++column_id) {
+    std::vector<std::shared_ptr<const PosList>> pos_lists(end_chunk_id - begin_chunk_id);
+    std::shared_ptr<const Table> referenced_table;
+    auto referenced_column_id = ColumnID{0};
+    for (const auto& chunk_id : chunks_with_columns) {
+      const auto reference_column =
+          std::dynamic_pointer_cast<const ReferenceColumn>(table->get_chunk(chunk_id).get_column(column_id));
+      Assert(reference_column != nullptr, "Tables must not mix ReferenceColumns and other columns!");
+      Assert(!referenced_table || reference_column->referenced_table() == referenced_table,
+             "All chunks of a column must reference the same table!");
+      pos_lists[chunk_id - begin_chunk_id] = reference_column->pos_list();
+      referenced_table = reference_column->referenced_table();
+      referenced_column_id = reference_column->referenced_column_id();
+    }
+
+    auto& resolved_positions = resolved_pos_lists[pos_lists];
+    if (!resolved_positions) {
+      auto resolved = std::make_shared<PosList>();
+      resolved->reserve(positions->size());
+      for (const auto& row_id : *positions) {
+        if (row_id == NULL_ROW_ID) {
+          resolved->push_back(NULL_ROW_ID);
+        } else {
+          resolved->push_back((*pos_lists[row_id.chunk_id - begin_chunk_id])[row_id.chunk_offset]);
+        }
+      }
+      resolved_positions = resolved;
+    }
+
+    chunk.add_column(std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, resolved_positions));
+  }
+}
+
+}  // namespace
+
+void add_reference_columns(Chunk& chunk, const std::shared_ptr<const Table>& table,
+                           const std::shared_ptr<const PosList>& positions) {
+  add_reference_columns_for_chunks(chunk, table, ChunkID{0}, table->chunk_count(), positions);
+}
+
+void add_reference_columns(Chunk& chunk, const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+                           const std::shared_ptr<const PosList>& positions) {
+  Assert(chunk_id < table->chunk_count(), "Chunk ID out of range!");
+  add_reference_columns_for_chunks(chunk, table, chunk_id, ChunkID{chunk_id + 1}, positions);
+}
+
+}  // namespace opossum
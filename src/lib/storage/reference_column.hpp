@@ -24,16 +24,37 @@ class ReferenceColumn : public BaseColumn {
   ReferenceColumn(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
                   const std::shared_ptr<const PosList> pos);
 
+  // returns the default value of the column type for NULL_ROW_ID
   const AllTypeVariant operator[](const size_t i) const override;
 
   void append(const AllTypeVariant&) override { throw std::logic_error("ReferenceColumn is immutable"); };
 
   size_t size() const override;
 
+  // only counts the position list, not the referenced data
+  size_t estimate_memory_usage() const override;
+
   const std::shared_ptr<const PosList> pos_list() const;
   const std::shared_ptr<const Table> referenced_table() const;
 
   ColumnID referenced_column_id() const;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
 };
 
+// Adds a ReferenceColumn for each column of the table to the chunk, so that row i of the chunk is the row positions[i]
+// of the table. If the table consists of ReferenceColumns, the positions are resolved, so that the new columns always
+// reference a table that holds the data. Columns that share their PosLists in the table share the resolved PosList.
+// NULL_ROW_ID stays NULL_ROW_ID.
+void add_reference_columns(Chunk& chunk, const std::shared_ptr<const Table>& table,
+                           const std::shared_ptr<const PosList>& positions);
+
+// Same as above for positions that all point into the chunk chunk_id of the table. Only that chunk is inspected, so
+// that operators that create an output chunk per input chunk, like scans, stay linear in the number of chunks.
+void add_reference_columns(Chunk& chunk, const std::shared_ptr<const Table>& table, ChunkID chunk_id,
+                           const std::shared_ptr<const PosList>& positions);
+
 }  // namespace opossum
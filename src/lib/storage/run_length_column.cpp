@@ -0,0 +1,86 @@
+#include "run_length_column.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthColumn<T>::RunLengthColumn(const std::shared_ptr<BaseColumn>& base_column)
+    : _values{std::make_shared<std::vector<T>>()}, _end_positions{std::make_shared<std::vector<ChunkOffset>>()} {
+  auto val_column = std::dynamic_pointer_cast<ValueColumn<T>>(base_column);
+  Assert(val_column != nullptr, "Compression is only supported for value columns!");
+
+  const auto& values = val_column->values();
+  Assert(!values.empty(), "Cannot compress empty value column!");
+
+  for (ChunkOffset chunk_offset = 0; chunk_offset < values.size(); ++chunk_offset) {
+    if (_values->empty() || values[chunk_offset] != _values->back()) {
+      // the previous run, if any, ends right before this row
+      if (!_values->empty()) _end_positions->push_back(chunk_offset - 1);
+      _values->push_back(T(values[chunk_offset]));
+    }
+  }
+  _end_positions->push_back(static_cast<ChunkOffset>(values.size() - 1));
+
+  _values->shrink_to_fit();
+  _end_positions->shrink_to_fit();
+}
+
+template <typename T>
+const AllTypeVariant RunLengthColumn<T>::operator[](const size_t i) const {
+  return get(i);
+}
+
+template <typename T>
+const T RunLengthColumn<T>::get(const size_t i) const {
+  DebugAssert(i < size(), "Index out of bounds!");
+  return (*_values)[run_index(static_cast<ChunkOffset>(i))];
+}
+
+template <typename T>
+void RunLengthColumn<T>::append(const AllTypeVariant&) {
+  throw std::runtime_error("Appending to a compressed column is not supported!");
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> RunLengthColumn<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<ChunkOffset>> RunLengthColumn<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthColumn<T>::run_index(const ChunkOffset chunk_offset) const {
+  // the first run whose last row is not before the given position
+  const auto end_position_it = std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), chunk_offset);
+  return static_cast<size_t>(end_position_it - _end_positions->cbegin());
+}
+
+template <typename T>
+size_t RunLengthColumn<T>::run_count() const {
+  return _values->size();
+}
+
+template <typename T>
+size_t RunLengthColumn<T>::size() const {
+  return _end_positions->back() + 1;
+}
+
+template <typename T>
+size_t RunLengthColumn<T>::estimate_memory_usage() const {
+  return values_memory_usage(*_values) + values_memory_usage(*_end_positions);
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(RunLengthColumn);
+
+}  // namespace opossum
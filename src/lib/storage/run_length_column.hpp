@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// RunLengthColumn is a specific column type that stores each run of equal consecutive values only once,
+// together with the position of its last row. This works well for sorted or clustered columns.
+template <typename T>
+class RunLengthColumn : public BaseColumn {
+ public:
+  /**
+   * Creates a run-length encoded column from a given value column.
+   */
+  explicit RunLengthColumn(const std::shared_ptr<BaseColumn>& base_column);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position.
+  const T get(const size_t i) const;
+
+  // run-length encoded columns are immutable
+  void append(const AllTypeVariant&) override;
+
+  // returns the value of each run
+  std::shared_ptr<const std::vector<T>> values() const;
+
+  // returns the chunk offset of the last row of each run (in ascending order)
+  std::shared_ptr<const std::vector<ChunkOffset>> end_positions() const;
+
+  // returns the index of the run that contains the given position
+  size_t run_index(const ChunkOffset chunk_offset) const;
+
+  // return the number of runs
+  size_t run_count() const;
+
+  // return the number of entries
+  size_t size() const override;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _values;
+  std::shared_ptr<std::vector<ChunkOffset>> _end_positions;
+};
+
+}  // namespace opossum
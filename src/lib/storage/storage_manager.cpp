@@ -1,6 +1,7 @@
 ﻿#include "storage_manager.hpp"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -15,21 +16,36 @@ StorageManager& StorageManager::get() {
 }
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  Assert(!has_table(name), "Table '" + name + "' already exists!");
+  std::lock_guard<std::mutex> lock(_mutex);
+  Assert(!_tables.count(name), "Table '" + name + "' already exists!");
   _tables[name] = table;
 }
 
 void StorageManager::drop_table(const std::string& name) {
+  std::lock_guard<std::mutex> lock(_mutex);
   if (!_tables.erase(name)) {
     throw std::runtime_error("Table does not exist!");
   }
 }
 
-std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return _tables.at(name); }
+std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _tables.at(name);
+}
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name); }
+std::shared_ptr<Table> StorageManager::try_get_table(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto table_it = _tables.find(name);
+  return table_it != _tables.cend() ? table_it->second : nullptr;
+}
+
+bool StorageManager::has_table(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _tables.count(name);
+}
 
 std::vector<std::string> StorageManager::table_names() const {
+  std::lock_guard<std::mutex> lock(_mutex);
   std::vector<std::string> names;
   names.reserve(_tables.size());
   for (const auto& entry : _tables) {
@@ -40,7 +56,8 @@ std::vector<std::string> StorageManager::table_names() const {
 
 void StorageManager::print(std::ostream& out) const {
   for (const auto& name : table_names()) {
-    const auto table = get_table(name);
+    const auto table = try_get_table(name);
+    if (!table) continue;
     out << "name: " << name;
     out << "\t#columns: " << table->col_count();
     out << "\t#rows: " << table->row_count();
@@ -50,6 +67,10 @@ void StorageManager::print(std::ostream& out) const {
   out << std::endl;
 }
 
-void StorageManager::reset() { get() = StorageManager{}; }
+void StorageManager::reset() {
+  auto& storage_manager = get();
+  std::lock_guard<std::mutex> lock(storage_manager._mutex);
+  storage_manager._tables.clear();
+}
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -13,6 +14,7 @@ namespace opossum {
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+// It is thread-safe, because background services (e.g., the ChunkCompressionService) access it concurrently.
 class StorageManager : private Noncopyable {
  public:
   static StorageManager& get();
@@ -26,6 +28,10 @@ class StorageManager : private Noncopyable {
   // returns the table instance with the given name
   std::shared_ptr<Table> get_table(const std::string& name) const;
 
+  // same as get_table, but returns nullptr instead of throwing if there is no table with the given name, so that a
+  // concurrent drop_table cannot happen between checking for and getting the table
+  std::shared_ptr<Table> try_get_table(const std::string& name) const;
+
   // returns whether the storage manager holds a table with the given name
   bool has_table(const std::string& name) const;
 
@@ -43,8 +49,7 @@ class StorageManager : private Noncopyable {
  protected:
   StorageManager() {}
 
-  StorageManager& operator=(StorageManager&&) = default;
-
   std::map<std::string, std::shared_ptr<Table>> _tables;
+  mutable std::mutex _mutex;
 };
 }  // namespace opossum
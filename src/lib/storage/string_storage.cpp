@@ -0,0 +1,80 @@
+#include "string_storage.hpp"
+
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+StringStorage::StringStorage(const std::vector<std::string_view>& strings) {
+  size_t heap_size = 0;
+  for (const auto& string : strings) {
+    if (string.size() > INLINE_LENGTH) heap_size += string.size();
+  }
+
+  _headers.reserve(strings.size());
+  _heap.reserve(heap_size);
+  for (const auto& string : strings) push_back(string);
+}
+
+void StringStorage::push_back(const std::string_view string) {
+  Assert(string.size() <= std::numeric_limits<uint32_t>::max(), "String is too long for StringStorage!");
+
+  Header header{static_cast<uint32_t>(string.size()), {}};
+  if (string.size() <= INLINE_LENGTH) {
+    std::memcpy(header.characters, string.data(), string.size());
+  } else {
+    const uint64_t heap_offset = _heap.size();
+    std::memcpy(header.characters, string.data(), PREFIX_LENGTH);
+    std::memcpy(header.characters + PREFIX_LENGTH, &heap_offset, sizeof(heap_offset));
+    _heap.insert(_heap.end(), string.cbegin(), string.cend());
+  }
+  _headers.push_back(header);
+}
+
+void StringStorage::reserve(const size_t count) { _headers.reserve(count); }
+
+void StringStorage::shrink_to_fit() {
+  _headers.shrink_to_fit();
+  _heap.shrink_to_fit();
+}
+
+std::string_view StringStorage::at(const size_t index) const {
+  Assert(index < size(), "Index " + std::to_string(index) + " out of bounds!");
+  return (*this)[index];
+}
+
+size_t StringStorage::lower_bound(const std::string_view string) const {
+  size_t begin = 0;
+  auto end = size();
+  while (begin < end) {
+    const auto middle = begin + (end - begin) / 2;
+    if (compare(middle, string) < 0) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return begin;
+}
+
+size_t StringStorage::upper_bound(const std::string_view string) const {
+  size_t begin = 0;
+  auto end = size();
+  while (begin < end) {
+    const auto middle = begin + (end - begin) / 2;
+    if (compare(middle, string) <= 0) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return begin;
+}
+
+size_t StringStorage::estimate_memory_usage() const { return _headers.size() * sizeof(Header) + _heap.size(); }
+
+}  // namespace opossum
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+// StringStorage stores a sequence of strings in two allocations instead of one per string: a vector of fixed-size
+// headers and a contiguous character heap. Like the 16 byte "German strings" of Umbra, each header holds the length and
+// the first characters of its string. Strings of up to INLINE_LENGTH characters are stored in their header only, longer
+// strings are stored in the heap and their header holds the heap offset behind the prefix. Comparisons look at the
+// prefix first and only read the heap if the prefixes are equal.
+// Strings are returned as std::string_views, which stay valid until the next string is added.
+class StringStorage {
+ public:
+  static constexpr size_t PREFIX_LENGTH = 4;
+  static constexpr size_t INLINE_LENGTH = 12;
+
+  struct Header {
+    uint32_t length;
+    // All characters of inlined strings or the prefix and the heap offset of longer strings, padded with zeros
+    char characters[INLINE_LENGTH];
+  };
+  static_assert(sizeof(Header) == 16, "StringStorage headers are expected to take 16 bytes");
+  static_assert(PREFIX_LENGTH == sizeof(uint32_t), "Prefixes are compared as 32 bit integers");
+
+  // random access iterator over all strings
+  class Iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::string_view;
+
+    Iterator() = default;
+    Iterator(const StringStorage& storage, const size_t index) : _storage{&storage}, _index{index} {}
+
+    reference operator*() const { return (*_storage)[_index]; }
+    reference operator[](const difference_type distance) const { return *(*this + distance); }
+
+    Iterator& operator++() { return *this += 1; }
+    Iterator& operator--() { return *this -= 1; }
+    Iterator operator++(int) { return std::exchange(*this, *this + 1); }
+    Iterator operator--(int) { return std::exchange(*this, *this - 1); }
+    Iterator& operator+=(const difference_type distance) {
+      _index += distance;
+      return *this;
+    }
+    Iterator& operator-=(const difference_type distance) { return *this += -distance; }
+    Iterator operator+(const difference_type distance) const { return Iterator{*this} += distance; }
+    Iterator operator-(const difference_type distance) const { return Iterator{*this} -= distance; }
+    difference_type operator-(const Iterator& other) const {
+      return static_cast<difference_type>(_index) - static_cast<difference_type>(other._index);
+    }
+
+    bool operator==(const Iterator& other) const { return _index == other._index; }
+    bool operator!=(const Iterator& other) const { return _index != other._index; }
+    bool operator<(const Iterator& other) const { return _index < other._index; }
+    bool operator>(const Iterator& other) const { return _index > other._index; }
+    bool operator<=(const Iterator& other) const { return _index <= other._index; }
+    bool operator>=(const Iterator& other) const { return _index >= other._index; }
+
+   protected:
+    const StringStorage* _storage = nullptr;
+    size_t _index = 0;
+  };
+
+  // the names of std::vector, so that StringStorage can be used in its place
+  using value_type = std::string_view;
+  using const_reference = std::string_view;
+  using const_iterator = Iterator;
+
+  StringStorage() = default;
+
+  // creates a storage that holds the given strings
+  explicit StringStorage(const std::vector<std::string_view>& strings);
+
+  // add a string to the end
+  void push_back(const std::string_view string);
+
+  // reserves memory for the headers of the given number of strings
+  void reserve(const size_t count);
+
+  void shrink_to_fit();
+
+  size_t size() const { return _headers.size(); }
+
+  bool empty() const { return _headers.empty(); }
+
+  std::string_view operator[](const size_t index) const {
+    const auto& header = _headers[index];
+    return {_characters(header), header.length};
+  }
+
+  // same as operator[], but throws if the index is out of bounds
+  std::string_view at(const size_t index) const;
+
+  std::string_view back() const { return (*this)[size() - 1]; }
+
+  Iterator begin() const { return {*this, 0}; }
+  Iterator end() const { return {*this, size()}; }
+  Iterator cbegin() const { return begin(); }
+  Iterator cend() const { return end(); }
+
+  // Compares the string at index with the given string. The result is negative, zero, or positive, like the one of
+  // std::string::compare.
+  int compare(const size_t index, const std::string_view string) const {
+    const auto& header = _headers[index];
+    char string_prefix[PREFIX_LENGTH] = {};
+    std::memcpy(string_prefix, string.data(), std::min(string.size(), PREFIX_LENGTH));
+
+    const auto left_prefix = _prefix_key(header.characters);
+    const auto right_prefix = _prefix_key(string_prefix);
+    if (left_prefix != right_prefix) return left_prefix < right_prefix ? -1 : 1;
+    return std::string_view{_characters(header), header.length}.compare(string);
+  }
+
+  // compares the strings at two indices, see above
+  int compare(const size_t left_index, const size_t right_index) const {
+    const auto& left = _headers[left_index];
+    const auto& right = _headers[right_index];
+
+    const auto left_prefix = _prefix_key(left.characters);
+    const auto right_prefix = _prefix_key(right.characters);
+    if (left_prefix != right_prefix) return left_prefix < right_prefix ? -1 : 1;
+    return std::string_view{_characters(left), left.length}.compare({_characters(right), right.length});
+  }
+
+  // Checks the string at index and the given string for equality. Strings of different length or prefix are told apart
+  // without reading the heap.
+  bool equals(const size_t index, const std::string_view string) const {
+    const auto& header = _headers[index];
+    if (header.length != string.size()) return false;
+    if (header.length <= INLINE_LENGTH) return std::memcmp(header.characters, string.data(), header.length) == 0;
+    return std::memcmp(header.characters, string.data(), PREFIX_LENGTH) == 0 &&
+           std::memcmp(_characters(header) + PREFIX_LENGTH, string.data() + PREFIX_LENGTH,
+                       header.length - PREFIX_LENGTH) == 0;
+  }
+
+  // For sorted storages: returns the index of the first string that is not less than (lower_bound) or greater than
+  // (upper_bound) the given string, or size() if there is none
+  size_t lower_bound(const std::string_view string) const;
+  size_t upper_bound(const std::string_view string) const;
+
+  // returns the bytes occupied by the headers and the heap
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // Returns the zero-padded prefix as an integer that compares like the characters. Padding does not change the order
+  // of two strings with different prefixes: a string that ends within the prefix is also a prefix of the other one.
+  static uint32_t _prefix_key(const char* prefix) {
+    uint32_t key;
+    std::memcpy(&key, prefix, sizeof(key));
+    return __builtin_bswap32(key);
+  }
+
+  const char* _characters(const Header& header) const {
+    if (header.length <= INLINE_LENGTH) return header.characters;
+
+    uint64_t heap_offset;
+    std::memcpy(&heap_offset, header.characters + PREFIX_LENGTH, sizeof(heap_offset));
+    return _heap.data() + heap_offset;
+  }
+
+  std::vector<Header> _headers;
+  std::vector<char> _heap;
+};
+
+// the number of bytes occupied by a StringStorage, see utils/memory_usage.hpp for other containers
+inline size_t values_memory_usage(const StringStorage& values) { return values.estimate_memory_usage(); }
+
+// The container ValueColumns and dictionaries store their values in: a StringStorage for strings, a std::vector for
+// all other types. ValueVector<T>::value_type is the type its elements are returned as (std::string_view for strings).
+template <typename T>
+using ValueVector = std::conditional_t<std::is_same<T, std::string>::value, StringStorage, std::vector<T>>;
+
+}  // namespace opossum
@@ -3,13 +3,18 @@
 #include <algorithm>
 #include <iomanip>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "dictionary_column.hpp"
+#include "frame_of_reference_column.hpp"
+#include "run_length_column.hpp"
 #include "value_column.hpp"
 
 #include "resolve_type.hpp"
@@ -18,7 +23,12 @@
 
 namespace opossum {
 
-Table::Table(const uint32_t chunk_size) : _chunk_size{chunk_size} { create_new_chunk(); }
+Table::Table(const uint32_t chunk_size)
+    : _chunk_size{chunk_size},
+      _chunks_mutex{std::make_unique<std::shared_mutex>()},
+      _bloom_filter_mutex{std::make_unique<std::mutex>()} {
+  create_new_chunk();
+}
 
 void Table::add_column_definition(const std::string& name, const std::string& type) {
   Assert(!_has_definition(name), "Column definition already exists!");
@@ -33,6 +43,7 @@ void Table::add_column(const std::string& name, const std::string& type) {
   } else {
     _validate_existing_definition(name, type);
   }
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
   for (Chunk& chunk : _chunks) {
     chunk.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(type));
   }
@@ -40,44 +51,132 @@ void Table::add_column(const std::string& name, const std::string& type) {
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
   if (_is_last_chunk_full()) {
-    create_new_chunk();
+    _create_new_chunk();
   }
   _chunks.back().append(values);
 }
 
 void Table::create_new_chunk() {
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  _create_new_chunk();
+}
+
+void Table::_create_new_chunk() {
   auto new_chunk = Chunk();
 
   for (const auto& column_type : _column_types) {
     new_chunk.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(column_type));
   }
+  for (const auto& create_index : _index_factories) create_index(new_chunk);
 
   _chunks.push_back(std::move(new_chunk));
 }
 
-void Table::compress_chunk(ChunkID chunk_id) {
-  auto new_chunk = Chunk{};
+void Table::compress_chunk(ChunkID chunk_id, EncodingType encoding_type) {
+  auto& chunk = _get_chunk_to_compress(chunk_id);
+
+  std::vector<std::shared_ptr<BaseColumn>> new_columns;
+  for (ColumnID id{0}; id < chunk.col_count(); ++id) {
+    new_columns.push_back(_encode_column(chunk.get_column(id), column_type(id), encoding_type));
+  }
+
+  _build_bloom_filters(chunk, new_columns);
+  chunk.replace_columns(std::move(new_columns));
+}
+
+std::vector<ColumnEncodingDecision> Table::compress_chunk_adaptively(
+    ChunkID chunk_id, const std::map<ColumnID, EncodingType>& column_encodings, const EncodingAdvisor& advisor) {
+  std::vector<std::shared_ptr<BaseColumn>> new_columns;
+  std::vector<ColumnEncodingDecision> decisions;
 
-  auto& old_chunk = get_chunk(chunk_id);
+  auto& chunk = _get_chunk_to_compress(chunk_id);
+
+  for (const auto& column_encoding : column_encodings) {
+    Assert(column_encoding.first < chunk.col_count(), "Encoding given for non-existing column!");
+  }
+
+  for (ColumnID id{0}; id < chunk.col_count(); ++id) {
+    const auto cur_column = chunk.get_column(id);
+
+    const auto column_encoding = column_encodings.find(id);
+    const auto is_override = column_encoding != column_encodings.cend();
+    const auto encoding_type =
+        is_override ? column_encoding->second : advisor.choose_encoding(cur_column, column_type(id));
+
+    const auto new_column = _encode_column(cur_column, column_type(id), encoding_type);
+    decisions.push_back({encoding_type, is_override, new_column->estimate_memory_usage()});
+    new_columns.push_back(new_column);
+  }
+
+  _build_bloom_filters(chunk, new_columns);
+  chunk.replace_columns(std::move(new_columns));
+  return decisions;
+}
 
+Chunk& Table::_get_chunk_to_compress(ChunkID chunk_id) {
   // These assertions are based on Slide 11 of Week 3: "Dictionary encoding is applied to full chunk"
   Assert(!_has_infinite_chunk_size(), "Cannot compress chunk of unlimited size!");
-  Assert(old_chunk.size() == chunk_size(), "Non-full chunk cannot be compressed!");
+  Assert(is_chunk_full(chunk_id), "Non-full chunk cannot be compressed!");
 
-  for (ColumnID id{0}; id < old_chunk.col_count(); ++id) {
-    auto cur_column = old_chunk.get_column(id);
+  return get_chunk(chunk_id);
+}
+
+void Table::enable_bloom_filter(ColumnID column_id, double false_positive_rate) {
+  Assert(column_id < col_count(), "Column ID out of range!");
+  Assert(false_positive_rate > 0.0 && false_positive_rate < 1.0, "False positive rate must be between 0 and 1!");
+  std::lock_guard<std::mutex> lock(*_bloom_filter_mutex);
+  _bloom_filter_false_positive_rates[column_id] = false_positive_rate;
+}
+
+void Table::_build_bloom_filters(Chunk& chunk, const std::vector<std::shared_ptr<BaseColumn>>& new_columns) const {
+  // The settings are copied so that the filters are built without holding the lock
+  auto false_positive_rates = std::map<ColumnID, double>{};
+  {
+    std::lock_guard<std::mutex> lock(*_bloom_filter_mutex);
+    false_positive_rates = _bloom_filter_false_positive_rates;
+  }
 
-    auto new_column = make_shared_by_column_type<BaseColumn, DictionaryColumn>(column_type(id), cur_column);
-    new_chunk.add_column(new_column);
+  // The encoded columns are used because the dictionary of a DictionaryColumn already holds each value only once
+  for (const auto& [column_id, false_positive_rate] : false_positive_rates) {
+    chunk.set_bloom_filter(column_id, create_bloom_filter(*new_columns[column_id], false_positive_rate));
   }
+}
 
-  std::swap(old_chunk, new_chunk);
+std::shared_ptr<BaseColumn> Table::_encode_column(const std::shared_ptr<BaseColumn>& column,
+                                                  const std::string& column_type, EncodingType encoding_type) {
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      return column;
+    case EncodingType::Dictionary:
+      return make_shared_by_column_type<BaseColumn, DictionaryColumn>(column_type, column);
+    case EncodingType::BitPackedDictionary:
+      return make_shared_by_column_type<BaseColumn, DictionaryColumn>(column_type, column,
+                                                                      AttributeVectorType::BitPacked);
+    case EncodingType::RunLength:
+      return make_shared_by_column_type<BaseColumn, RunLengthColumn>(column_type, column);
+    case EncodingType::FrameOfReference: {
+      std::shared_ptr<BaseColumn> new_column;
+      resolve_data_type(column_type, [&](auto type) {
+        using Type = typename decltype(type)::type;
+        if constexpr (std::is_integral<Type>::value) {
+          new_column = std::make_shared<FrameOfReferenceColumn<Type>>(column);
+        } else {
+          Fail("Frame-of-reference encoding is only supported for int and long columns");
+        }
+      });
+      return new_column;
+    }
+  }
+  Fail("Unknown encoding type");
+  return nullptr;
 }
 
 uint16_t Table::col_count() const { return _column_names.size(); }
 
 uint64_t Table::row_count() const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
   uint64_t result = 0;
   for (const auto& chunk : _chunks) {
     result += chunk.size();
@@ -85,7 +184,10 @@ uint64_t Table::row_count() const {
   return result;
 }
 
-ChunkID Table::chunk_count() const { return ChunkID{static_cast<uint32_t>(_chunks.size())}; }
+ChunkID Table::chunk_count() const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return ChunkID{static_cast<uint32_t>(_chunks.size())};
+}
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   auto count = col_count();
@@ -105,9 +207,20 @@ const std::string& Table::column_name(ColumnID column_id) const { return _column
 
 const std::string& Table::column_type(ColumnID column_id) const { return _column_types.at(column_id); }
 
-Chunk& Table::get_chunk(ChunkID chunk_id) { return _chunks.at(chunk_id); }
+Chunk& Table::get_chunk(ChunkID chunk_id) {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return _chunks.at(chunk_id);
+}
+
+const Chunk& Table::get_chunk(ChunkID chunk_id) const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return _chunks.at(chunk_id);
+}
 
-const Chunk& Table::get_chunk(ChunkID chunk_id) const { return _chunks.at(chunk_id); }
+bool Table::is_chunk_full(ChunkID chunk_id) const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return !_has_infinite_chunk_size() && _chunks.at(chunk_id).size() == _chunk_size;
+}
 
 bool Table::_is_last_chunk_full() const { return !_has_infinite_chunk_size() && _chunks.back().size() == _chunk_size; }
 
@@ -126,8 +239,15 @@ void Table::_validate_existing_definition(const std::string& name, const std::st
   Assert(!_is_instantiated.at(pos), "A column with the given name was already added!");
 }
 
-void emplace_chunk(Chunk chunk) {
-  // Implementation goes here
+void Table::emplace_chunk(Chunk chunk) {
+  Assert(chunk.col_count() == col_count(), "Number of columns in chunk does not match table definition!");
+
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  if (_chunks.size() == 1 && _chunks.back().size() == 0) {
+    _chunks.back() = std::move(chunk);
+  } else {
+    _chunks.push_back(std::move(chunk));
+  }
 }
 
 }  // namespace opossum
@@ -1,5 +1,10 @@
 ﻿#pragma once
 
+// the linter wants this to be above everything else
+#include <shared_mutex>
+
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -8,7 +13,9 @@
 #include <vector>
 
 #include "base_column.hpp"
+#include "bloom_filter.hpp"
 #include "chunk.hpp"
+#include "encoding_advisor.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -18,7 +25,10 @@ namespace opossum {
 
 class TableStatistics;
 
-// A table is partitioned horizontally into a number of chunks
+// A table is partitioned horizontally into a number of chunks.
+// Adding chunks and accessing them is synchronized, and references to chunks stay valid when new chunks are added.
+// Rows may be appended while other threads compress or read full chunks (see ChunkCompressionService), but the chunk
+// that is being filled must not be read concurrently.
 class Table : private Noncopyable {
  public:
   // creates a table
@@ -49,6 +59,9 @@ class Table : private Noncopyable {
   // Adds a chunk to the table. If the first chunk is empty, it is replaced.
   void emplace_chunk(Chunk chunk);
 
+  // returns whether the chunk has reached the maximum chunk size, i.e., no more rows will be appended to it
+  bool is_chunk_full(ChunkID chunk_id) const;
+
   // Returns a list of all column names.
   const std::vector<std::string>& column_names() const;
 
@@ -76,22 +89,68 @@ class Table : private Noncopyable {
   void add_column(const std::string& name, const std::string& type);
 
   // inserts a row at the end of the table
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  // note this is slow and not thread-safe and should be used for testing purposes only. It may only run concurrently
+  // with the compression of full chunks, not with reads of the last chunk.
   void append(std::vector<AllTypeVariant> values);
 
   // creates a new chunk and appends it
   void create_new_chunk();
 
-  // compresses a ValueColumn into a DictionaryColumn
-  void compress_chunk(ChunkID chunk_id);
+  // Compresses the ValueColumns of a full chunk using the given encoding. The encoded columns replace the old ones
+  // atomically, see Chunk::replace_columns.
+  void compress_chunk(ChunkID chunk_id, EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Compresses the ValueColumns of a full chunk, each with its own encoding. Columns listed in column_encodings use the
+  // given encoding, the encodings of all other columns are chosen by the EncodingAdvisor. Returns the encoding and
+  // resulting size of each column.
+  std::vector<ColumnEncodingDecision> compress_chunk_adaptively(
+      ChunkID chunk_id, const std::map<ColumnID, EncodingType>& column_encodings = {},
+      const EncodingAdvisor& advisor = EncodingAdvisor{});
+
+  // Chunks that are compressed after this call get a Bloom filter of the given column's values, which TableScan
+  // consults for equality predicates. A lower false positive rate lets more chunks be skipped, but takes more memory.
+  void enable_bloom_filter(ColumnID column_id, double false_positive_rate = BloomFilter::DEFAULT_FALSE_POSITIVE_RATE);
+
+  // Creates an index of the given type on the given columns of all chunks, including the ones that are added later.
+  // The index type has to support ValueColumns and inserting rows, e.g., AdaptiveRadixTreeIndex.
+  template <typename Index>
+  void create_index(const std::vector<ColumnID>& column_ids) {
+    std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+    const auto create = [column_ids](Chunk& chunk) { chunk.create_index<Index>(column_ids); };
+    for (auto& chunk : _chunks) create(chunk);
+    _index_factories.push_back(create);
+  }
 
  protected:
   // mark if a column was only defined (add_column_definition) or already instantiated (add_column)
   std::vector<bool> _is_instantiated;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
-  std::vector<Chunk> _chunks;
+  std::deque<Chunk> _chunks;
   const uint32_t _chunk_size;
+  std::map<ColumnID, double> _bloom_filter_false_positive_rates;
+
+  // create the indices of Table::create_index on new chunks
+  std::vector<std::function<void(Chunk&)>> _index_factories;
+
+  // protects _chunks from being modified while it is accessed. It is held by pointer to keep the table movable.
+  std::unique_ptr<std::shared_mutex> _chunks_mutex;
+
+  // protects _bloom_filter_false_positive_rates, which the compression worker reads while the table is in use
+  std::unique_ptr<std::mutex> _bloom_filter_mutex;
+
+  // adds an empty chunk, expects _chunks_mutex to be locked exclusively
+  void _create_new_chunk();
+
+  // checks that the chunk can be compressed and returns it
+  Chunk& _get_chunk_to_compress(ChunkID chunk_id);
+
+  // builds the Bloom filters of a chunk that is being compressed for all columns that have them enabled
+  void _build_bloom_filters(Chunk& chunk, const std::vector<std::shared_ptr<BaseColumn>>& new_columns) const;
+
+  // returns the given column of the given type in the given encoding
+  static std::shared_ptr<BaseColumn> _encode_column(const std::shared_ptr<BaseColumn>& column,
+                                                    const std::string& column_type, EncodingType encoding_type);
 
   bool _is_last_chunk_full() const;
   bool _has_infinite_chunk_size() const;
@@ -9,16 +9,20 @@
 
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
 
+template <typename T>
+ValueColumn<T>::ValueColumn(ValueVector<T>&& values) : _values{std::move(values)} {}
+
 template <typename T>
 const AllTypeVariant ValueColumn<T>::operator[](const size_t i) const {
   PerformanceWarning("operator[] used");
 
   // throws an exception if i is not there, slower than []
-  return _values.at(i);
+  return T(_values.at(i));
 }
 
 template <typename T>
@@ -32,7 +36,12 @@ size_t ValueColumn<T>::size() const {
 }
 
 template <typename T>
-const std::vector<T>& ValueColumn<T>::values() const {
+size_t ValueColumn<T>::estimate_memory_usage() const {
+  return values_memory_usage(_values);
+}
+
+template <typename T>
+const ValueVector<T>& ValueColumn<T>::values() const {
   return _values;
 }
 
@@ -6,14 +6,18 @@
 #include <vector>
 
 #include "base_column.hpp"
+#include "string_storage.hpp"
 
 namespace opossum {
 
-// ValueColumn is a specific column type that stores all its values in a vector
+// ValueColumn is a specific column type that stores all its values in a vector (or a StringStorage for strings)
 template <typename T>
 class ValueColumn : public BaseColumn {
  public:
-  // default constructor is auto generated
+  ValueColumn() = default;
+
+  // creates a column that holds the given values
+  explicit ValueColumn(ValueVector<T>&& values);
 
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t i) const override;
@@ -24,13 +28,15 @@ class ValueColumn : public BaseColumn {
   // return the number of entries
   size_t size() const override;
 
+  size_t estimate_memory_usage() const override;
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. auto& values = col.values(); and then: values.at(i); in your loop.
-  const std::vector<T>& values() const;
+  const ValueVector<T>& values() const;
 
  protected:
-  std::vector<T> _values;
+  ValueVector<T> _values;
 };
 
 }  // namespace opossum
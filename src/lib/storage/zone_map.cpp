@@ -0,0 +1,131 @@
+#include "zone_map.hpp"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "dictionary_column.hpp"
+#include "frame_of_reference_column.hpp"
+#include "resolve_type.hpp"
+#include "run_length_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+std::shared_ptr<ZoneMap<T>> ZoneMap<T>::create(const BaseColumn& column) {
+  auto zone_map = std::make_shared<ZoneMap<T>>();
+
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    for (const auto& value : value_column->values()) zone_map->_add(value);
+  } else if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    // the dictionary is sorted, so its first and last entries are the minimum and maximum
+    const auto& dictionary = *dictionary_column->dictionary();
+    if (!dictionary.empty()) {
+      zone_map->_add(dictionary[0]);
+      zone_map->_add(dictionary[dictionary.size() - 1]);
+    }
+  } else if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+    for (const auto& value : *run_length_column->values()) zone_map->_add(value);
+  } else {
+    if constexpr (std::is_integral<T>::value) {
+      if (const auto frame_of_reference_column = dynamic_cast<const FrameOfReferenceColumn<T>*>(&column)) {
+        for (size_t chunk_offset = 0; chunk_offset < frame_of_reference_column->size(); ++chunk_offset) {
+          zone_map->_add(frame_of_reference_column->get(chunk_offset));
+        }
+        return zone_map;
+      }
+    }
+    return nullptr;
+  }
+
+  return zone_map;
+}
+
+template <typename T>
+void ZoneMap<T>::append(const AllTypeVariant& value) {
+  _add(type_cast<T>(value));
+}
+
+template <typename T>
+bool ZoneMap<T>::is_empty() const {
+  return _is_empty;
+}
+
+template <typename T>
+const AllTypeVariant ZoneMap<T>::min() const {
+  return typed_min();
+}
+
+template <typename T>
+const AllTypeVariant ZoneMap<T>::max() const {
+  return typed_max();
+}
+
+template <typename T>
+const T& ZoneMap<T>::typed_min() const {
+  DebugAssert(!_is_empty, "Empty zone maps have no minimum!");
+  return _min;
+}
+
+template <typename T>
+const T& ZoneMap<T>::typed_max() const {
+  DebugAssert(!_is_empty, "Empty zone maps have no maximum!");
+  return _max;
+}
+
+template <typename T>
+bool ZoneMap<T>::can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  return can_prune(scan_type, type_cast<T>(search_value));
+}
+
+template <typename T>
+bool ZoneMap<T>::can_prune(const ScanType scan_type, const T& search_value) const {
+  if (_is_empty) return true;
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return search_value < _min || _max < search_value;
+    case ScanType::OpNotEquals:
+      return _min == search_value && _max == search_value;
+    case ScanType::OpLessThan:
+      return !(_min < search_value);
+    case ScanType::OpLessThanEquals:
+      return search_value < _min;
+    case ScanType::OpGreaterThan:
+      return !(search_value < _max);
+    case ScanType::OpGreaterThanEquals:
+      return _max < search_value;
+    default:
+      return false;
+  }
+}
+
+template <typename T>
+template <typename Value>
+void ZoneMap<T>::_add(const Value& value) {
+  if (_is_empty) {
+    _min = value;
+    _max = value;
+    _is_empty = false;
+  } else if (value < _min) {
+    _min = value;
+  } else if (_max < value) {
+    _max = value;
+  }
+}
+
+std::shared_ptr<BaseZoneMap> create_zone_map(const BaseColumn& column) {
+  std::shared_ptr<BaseZoneMap> zone_map;
+  hana::for_each(types, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    if (!zone_map) zone_map = ZoneMap<Type>::create(column);
+  });
+  return zone_map;
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(ZoneMap);
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// A zone map stores the minimum and maximum value of a column within a chunk. Scans use it to skip whole chunks that
+// cannot contain a match. Chunks create the zone maps of their columns and keep them up to date on append.
+// As there are no NULL values yet, the only special case is an empty column, which matches nothing.
+class BaseZoneMap : private Noncopyable {
+ public:
+  BaseZoneMap() = default;
+  virtual ~BaseZoneMap() = default;
+
+  // extends the zone map by a value that was appended to the column
+  virtual void append(const AllTypeVariant& value) = 0;
+
+  // returns true if the column has no values
+  virtual bool is_empty() const = 0;
+
+  // return the smallest and largest value of the column. Must not be called on empty zone maps.
+  virtual const AllTypeVariant min() const = 0;
+  virtual const AllTypeVariant max() const = 0;
+
+  // returns true if no value of the column can satisfy the predicate "value <scan_type> search_value"
+  virtual bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+};
+
+template <typename T>
+class ZoneMap : public BaseZoneMap {
+ public:
+  // creates an empty zone map
+  ZoneMap() = default;
+
+  // Creates the zone map of a value, dictionary, run-length, or frame-of-reference column. Returns nullptr for all
+  // other columns. For dictionary columns, this only looks at the first and last entry of the sorted dictionary.
+  static std::shared_ptr<ZoneMap<T>> create(const BaseColumn& column);
+
+  void append(const AllTypeVariant& value) override;
+
+  bool is_empty() const override;
+
+  const AllTypeVariant min() const override;
+  const AllTypeVariant max() const override;
+
+  // same as min() and max(), but without creating an AllTypeVariant
+  const T& typed_min() const;
+  const T& typed_max() const;
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const override;
+
+  // same as above, for a search value that already has the column type
+  bool can_prune(const ScanType scan_type, const T& search_value) const;
+
+ protected:
+  template <typename Value>
+  void _add(const Value& value);
+
+  bool _is_empty = true;
+  T _min{};
+  T _max{};
+};
+
+// Creates the zone map of a column of any type, see ZoneMap<T>::create. Returns nullptr for columns without zone maps,
+// e.g., ReferenceColumns.
+std::shared_ptr<BaseZoneMap> create_zone_map(const BaseColumn& column);
+
+}  // namespace opossum
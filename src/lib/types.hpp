@@ -51,8 +51,21 @@ struct RowID {
   }
 };
 
+constexpr ChunkOffset INVALID_CHUNK_OFFSET{std::numeric_limits<ChunkOffset>::max()};
+
+// References no row, e.g., in the right columns of a left join for left rows without a match. As there are no NULL
+// values yet, ReferenceColumns return the default value of their type for it, but no predicate matches it.
+constexpr RowID NULL_ROW_ID{ChunkID{std::numeric_limits<ChunkID::base_type>::max()}, INVALID_CHUNK_OFFSET};
+
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
+// Inner joins output all pairs of matching rows. Left joins additionally output the left rows without a match, with
+// NULL_ROW_ID on the right. Semi and anti joins only output the left rows with and without a match, respectively.
+enum class JoinMode { Inner, Left, Semi, Anti };
+
+// the encodings that Table::compress_chunk can apply to the columns of a chunk. Unencoded keeps the ValueColumn.
+enum class EncodingType { Unencoded, Dictionary, BitPackedDictionary, RunLength, FrameOfReference };
+
 using PosList = std::vector<RowID>;
 
 class Noncopyable {
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace opossum {
+
+// Returns the number of bytes occupied by the given values. For strings, this includes the heap allocations of all
+// strings that are too long for the small string optimization.
+template <typename T>
+size_t values_memory_usage(const std::vector<T>& values) {
+  auto bytes = values.size() * sizeof(T);
+  if constexpr (std::is_same<T, std::string>::value) {
+    const auto sso_capacity = std::string{}.capacity();
+    for (const auto& value : values) {
+      if (value.capacity() > sso_capacity) bytes += value.capacity() + 1;
+    }
+  }
+  return bytes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+// Returns the number of threads to use for processing size elements, so that each thread gets at least
+// min_elements_per_thread of them. Never exceeds the number of hardware threads.
+inline size_t parallel_thread_count(const size_t size, const size_t min_elements_per_thread) {
+  const auto hardware_threads = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  return std::max(size_t{1}, std::min(hardware_threads, size / std::max(size_t{1}, min_elements_per_thread)));
+}
+
+// Splits [0, size) into thread_count ranges of (almost) equal size and calls func(range_index, begin, end) for each of
+// them on its own thread. The first range is processed on the calling thread.
+template <typename Functor>
+void parallel_for_each_range(const size_t size, const size_t thread_count, const Functor& func) {
+  const auto range_begin = [&](const size_t range_index) { return range_index * size / thread_count; };
+
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count - 1);
+  for (size_t range_index = 1; range_index < thread_count; ++range_index) {
+    threads.emplace_back(
+        [&, range_index] { func(range_index, range_begin(range_index), range_begin(range_index + 1)); });
+  }
+  func(size_t{0}, range_begin(0), range_begin(1));
+
+  for (auto& thread : threads) thread.join();
+}
+
+// Sorts [first, last) with thread_count threads: each thread sorts one range, then the sorted ranges are merged
+// pairwise, again in parallel.
+template <typename RandomIt, typename Compare>
+void parallel_sort(const RandomIt first, const RandomIt last, const Compare& compare, const size_t thread_count) {
+  const auto size = static_cast<size_t>(std::distance(first, last));
+  if (thread_count <= 1) {
+    std::sort(first, last, compare);
+    return;
+  }
+
+  parallel_for_each_range(size, thread_count, [&](const size_t, const size_t begin, const size_t end) {
+    std::sort(first + begin, first + end, compare);
+  });
+
+  // the sorted ranges are [range_begin(i), range_begin(i + 1)), as in parallel_for_each_range
+  const auto range_begin = [&](const size_t range_index) {
+    return first + std::min(range_index, thread_count) * size / thread_count;
+  };
+
+  for (size_t merged_ranges = 1; merged_ranges < thread_count; merged_ranges *= 2) {
+    const auto merge_count = (thread_count + 2 * merged_ranges - 1) / (2 * merged_ranges);
+    parallel_for_each_range(merge_count, merge_count, [&](const size_t merge_index, const size_t, const size_t) {
+      const auto left = merge_index * 2 * merged_ranges;
+      if (left + merged_ranges >= thread_count) return;
+      std::inplace_merge(range_begin(left), range_begin(left + merged_ranges), range_begin(left + 2 * merged_ranges),
+                         compare);
+    });
+  }
+}
+
+// Merges the sorted runs [first + run_offsets[i], first + run_offsets[i + 1]) into a single sorted range, where
+// run_offsets starts with 0 and ends with the size of the range. Neighbouring runs are merged pairwise, up to
+// thread_count merges at a time. Neighbours that already are in order are not merged, so presorted runs cost nothing.
+template <typename RandomIt, typename Compare>
+void parallel_merge_runs(const RandomIt first, std::vector<size_t> run_offsets, const Compare& compare,
+                         const size_t thread_count) {
+  while (run_offsets.size() > 2) {
+    const auto merge_count = (run_offsets.size() - 1) / 2;
+    parallel_for_each_range(merge_count, std::min(merge_count, thread_count),
+                            [&](const size_t, const size_t begin, const size_t end) {
+                              for (auto merge_index = begin; merge_index < end; ++merge_index) {
+                                const auto middle = first + run_offsets[2 * merge_index + 1];
+                                if (!compare(*middle, *(middle - 1))) continue;
+                                std::inplace_merge(first + run_offsets[2 * merge_index], middle,
+                                                   first + run_offsets[2 * merge_index + 2], compare);
+                              }
+                            });
+
+    std::vector<size_t> merged_run_offsets;
+    for (size_t run_index = 0; run_index < run_offsets.size(); run_index += 2) {
+      merged_run_offsets.push_back(run_offsets[run_index]);
+    }
+    if (merged_run_offsets.back() != run_offsets.back()) merged_run_offsets.push_back(run_offsets.back());
+    run_offsets = std::move(merged_run_offsets);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,211 @@
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "float");
+    table->append({1, "x", 1.5f});
+    table->append({2, "y", 2.5f});
+    table->append({1, "x", 3.5f});
+    table->append({1, "y", 4.5f});
+    table->append({2, "y", 5.5f});
+    table->append({3, "x", 6.5f});
+    table->append({1, "x", 7.5f});
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> make_table(const std::vector<std::pair<std::string, std::string>>& columns,
+                                    const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto table = std::make_shared<Table>();
+    for (const auto& [name, type] : columns) table->add_column(name, type);
+    for (const auto& row : rows) table->append(row);
+    return table;
+  }
+
+  std::shared_ptr<const Table> aggregate(const std::shared_ptr<const AbstractOperator>& in,
+                                         const std::vector<AggregateDefinition>& aggregates,
+                                         const std::vector<ColumnID>& groupby_column_ids) {
+    auto aggregate = std::make_shared<Aggregate>(in, aggregates, groupby_column_ids);
+    aggregate->execute();
+    return aggregate->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAggregateTest, SingleGroupbyColumn) {
+  const auto output = aggregate(_table_wrapper,
+                                {{ColumnID{2}, AggregateFunction::Count},
+                                 {ColumnID{2}, AggregateFunction::Sum},
+                                 {ColumnID{2}, AggregateFunction::Min},
+                                 {ColumnID{2}, AggregateFunction::Max},
+                                 {ColumnID{2}, AggregateFunction::Avg},
+                                 {ColumnID{0}, AggregateFunction::Sum}},
+                                {ColumnID{1}});
+
+  const auto expected = make_table({{"b", "string"},
+                                    {"COUNT(c)", "long"},
+                                    {"SUM(c)", "double"},
+                                    {"MIN(c)", "float"},
+                                    {"MAX(c)", "float"},
+                                    {"AVG(c)", "double"},
+                                    {"SUM(a)", "long"}},
+                                   {{"x", int64_t{4}, 19.0, 1.5f, 7.5f, 4.75, int64_t{6}},
+                                    {"y", int64_t{3}, 12.5, 2.5f, 5.5f, 12.5 / 3, int64_t{5}}});
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsAggregateTest, MultipleGroupbyColumns) {
+  const auto output = aggregate(_table_wrapper, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}, ColumnID{1}});
+  const auto expected = make_table({{"a", "int"}, {"b", "string"}, {"MAX(b)", "string"}},
+                                   {{1, "x", "x"}, {2, "y", "y"}, {1, "y", "y"}, {3, "x", "x"}});
+  EXPECT_TABLE_EQ(output, expected);
+
+  // without aggregates, this is a DISTINCT
+  EXPECT_TABLE_EQ(aggregate(_table_wrapper, {}, {ColumnID{1}}), make_table({{"b", "string"}}, {{"x"}, {"y"}}));
+}
+
+TEST_F(OperatorsAggregateTest, NoGroupbyColumns) {
+  const auto output =
+      aggregate(_table_wrapper, {{ColumnID{0}, AggregateFunction::Count}, {ColumnID{0}, AggregateFunction::Min}}, {});
+  EXPECT_TABLE_EQ(output, make_table({{"COUNT(a)", "long"}, {"MIN(a)", "int"}}, {{int64_t{7}, 1}}));
+
+  // a single row is returned even for empty inputs
+  auto empty_table = std::make_shared<Table>();
+  empty_table->add_column("a", "int");
+  auto empty_wrapper = std::make_shared<TableWrapper>(empty_table);
+  empty_wrapper->execute();
+  EXPECT_TABLE_EQ(aggregate(empty_wrapper, {{ColumnID{0}, AggregateFunction::Count}}, {}),
+                  make_table({{"COUNT(a)", "long"}}, {{int64_t{0}}}));
+  EXPECT_EQ(aggregate(empty_wrapper, {{ColumnID{0}, AggregateFunction::Count}}, {ColumnID{0}})->row_count(), 0u);
+}
+
+TEST_F(OperatorsAggregateTest, NullRowsAreNotAggregated) {
+  auto right = std::make_shared<TableWrapper>(make_table({{"d", "int"}, {"e", "long"}}, {{1, 10}, {1, 20}, {2, 30}}));
+  right->execute();
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  // the row with a = 3 has NULL values in d and e
+  EXPECT_TABLE_EQ(aggregate(join, {{ColumnID{4}, AggregateFunction::Count}, {ColumnID{4}, AggregateFunction::Sum}},
+                            {ColumnID{0}}),
+                  make_table({{"a", "int"}, {"COUNT(e)", "long"}, {"SUM(e)", "long"}},
+                             {{1, int64_t{8}, int64_t{120}}, {2, int64_t{2}, int64_t{60}},
+                              {3, int64_t{0}, int64_t{0}}}));
+  EXPECT_TABLE_EQ(aggregate(join, {{ColumnID{0}, AggregateFunction::Count}}, {ColumnID{3}}),
+                  make_table({{"d", "int"}, {"COUNT(a)", "long"}}, {{1, int64_t{8}}, {2, int64_t{2}}}));
+}
+
+TEST_F(OperatorsAggregateTest, LargeInput) {
+  // enough rows and groups for several threads in both phases, with groups spread over all chunks
+  std::mt19937 generator{3};
+  std::uniform_int_distribution<int> distribution{0, 3000};
+  std::map<std::pair<int, int64_t>, std::pair<int64_t, int64_t>> expected_groups;
+
+  auto table = std::make_shared<Table>(20000);
+  table->add_column("a", "int");
+  table->add_column("b", "long");
+  table->add_column("c", "long");
+  for (auto row = 0; row < 100000; ++row) {
+    const auto a = distribution(generator);
+    const auto b = int64_t{row % 3};
+    table->append({a, b, int64_t{row}});
+    auto& [count, sum] = expected_groups[{a, b}];
+    ++count;
+    sum += row;
+  }
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{2});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "long");
+  expected->add_column("COUNT(c)", "long");
+  expected->add_column("SUM(c)", "long");
+  for (const auto& [group, aggregates] : expected_groups) {
+    expected->append({group.first, group.second, aggregates.first, aggregates.second});
+  }
+
+  const auto output = aggregate(
+      table_wrapper, {{ColumnID{2}, AggregateFunction::Count}, {ColumnID{2}, AggregateFunction::Sum}},
+      {ColumnID{0}, ColumnID{1}});
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsAggregateTest, CountDistinct) {
+  EXPECT_TABLE_EQ(aggregate(_table_wrapper, {{ColumnID{1}, AggregateFunction::CountDistinct}}, {ColumnID{0}}),
+                  make_table({{"a", "int"}, {"COUNT(DISTINCT b)", "long"}},
+                             {{1, int64_t{2}}, {2, int64_t{1}}, {3, int64_t{1}}}));
+  EXPECT_TABLE_EQ(aggregate(_table_wrapper, {{ColumnID{0}, AggregateFunction::CountDistinct}}, {}),
+                  make_table({{"COUNT(DISTINCT a)", "long"}}, {{int64_t{3}}}));
+}
+
+TEST_F(OperatorsAggregateTest, EncodedColumns) {
+  // the aggregates are computed on the encoded values, which must not change the results
+  std::mt19937 generator{5};
+  std::uniform_int_distribution<int64_t> distribution{-50, 50};
+  const auto create_table = [&](const EncodingType encoding) {
+    auto table = std::make_shared<Table>(5000);
+    table->add_column("a", "long");
+    table->add_column("b", "long");
+    generator.seed(5);
+    for (auto row = 0; row < 12000; ++row) {
+      // long runs of values, and groups that often span a whole FOR block
+      table->append({int64_t{row / 700 % 4}, distribution(generator) + row / 100});
+    }
+    // the last chunk is not full and stays unencoded
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (encoding != EncodingType::Unencoded && table->is_chunk_full(chunk_id)) {
+        table->compress_chunk(chunk_id, encoding);
+      }
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto aggregates = std::vector<AggregateDefinition>{
+      {ColumnID{1}, AggregateFunction::Count}, {ColumnID{1}, AggregateFunction::CountDistinct},
+      {ColumnID{1}, AggregateFunction::Sum},   {ColumnID{1}, AggregateFunction::Min},
+      {ColumnID{1}, AggregateFunction::Max},   {ColumnID{1}, AggregateFunction::Avg}};
+  const auto unencoded = create_table(EncodingType::Unencoded);
+  for (const auto encoding : {EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FrameOfReference}) {
+    const auto encoded = create_table(encoding);
+    EXPECT_TABLE_EQ(aggregate(encoded, aggregates, {ColumnID{0}}), aggregate(unencoded, aggregates, {ColumnID{0}}));
+    EXPECT_TABLE_EQ(aggregate(encoded, aggregates, {}), aggregate(unencoded, aggregates, {}));
+  }
+}
+
+TEST_F(OperatorsAggregateTest, InvalidAggregates) {
+  EXPECT_THROW(aggregate(_table_wrapper, {{ColumnID{1}, AggregateFunction::Sum}}, {}), std::exception);
+  EXPECT_THROW(aggregate(_table_wrapper, {{ColumnID{1}, AggregateFunction::Avg}}, {}), std::exception);
+  EXPECT_THROW(aggregate(_table_wrapper, {{ColumnID{5}, AggregateFunction::Count}}, {}), std::exception);
+  EXPECT_THROW(aggregate(_table_wrapper, {}, {ColumnID{5}}), std::exception);
+}
+
+}  // namespace opossum
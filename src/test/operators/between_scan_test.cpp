@@ -0,0 +1,124 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/between_scan.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsBetweenScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    table->add_column("b", "long");
+    for (auto i = 0; i < 500; ++i) table->append({i % 37, int64_t{i}});
+    table->compress_chunk(ChunkID{1});
+    table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+    table->compress_chunk(ChunkID{3}, EncodingType::FrameOfReference);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+
+    auto string_table = std::make_shared<Table>(4);
+    string_table->add_column("c", "string");
+    for (const auto& string : {"apple", "banana", "cherry", "date", "elderberry", "fig", "grape", "banana"}) {
+      string_table->append({string});
+    }
+    string_table->compress_chunk(ChunkID{1});
+    _string_table_wrapper = std::make_shared<TableWrapper>(string_table);
+    _string_table_wrapper->execute();
+  }
+
+  // the result of two TableScans, which BetweenScan has to match
+  std::shared_ptr<const Table> scan_twice(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                                          const AllTypeVariant& lower_bound, const AllTypeVariant& upper_bound,
+                                          const bool lower_bound_inclusive, const bool upper_bound_inclusive) {
+    auto lower_scan = std::make_shared<TableScan>(
+        in, column_id, lower_bound_inclusive ? ScanType::OpGreaterThanEquals : ScanType::OpGreaterThan, lower_bound);
+    lower_scan->execute();
+    auto upper_scan = std::make_shared<TableScan>(
+        lower_scan, column_id, upper_bound_inclusive ? ScanType::OpLessThanEquals : ScanType::OpLessThan, upper_bound);
+    upper_scan->execute();
+    return upper_scan->get_output();
+  }
+
+  void expect_same_as_two_scans(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                                const AllTypeVariant& lower_bound, const AllTypeVariant& upper_bound) {
+    for (const auto lower_bound_inclusive : {true, false}) {
+      for (const auto upper_bound_inclusive : {true, false}) {
+        auto scan = std::make_shared<BetweenScan>(in, column_id, lower_bound, upper_bound, lower_bound_inclusive,
+                                                  upper_bound_inclusive);
+        scan->execute();
+        EXPECT_TABLE_EQ(scan->get_output(),
+                        scan_twice(in, column_id, lower_bound, upper_bound, lower_bound_inclusive,
+                                   upper_bound_inclusive));
+      }
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<TableWrapper> _string_table_wrapper;
+};
+
+TEST_F(OperatorsBetweenScanTest, AllColumnTypes) {
+  expect_same_as_two_scans(_table_wrapper, ColumnID{0}, 5, 12);
+  expect_same_as_two_scans(_table_wrapper, ColumnID{0}, 12, 12);
+  expect_same_as_two_scans(_table_wrapper, ColumnID{0}, -10, 100);
+  expect_same_as_two_scans(_table_wrapper, ColumnID{1}, int64_t{150}, int64_t{420});
+  expect_same_as_two_scans(_string_table_wrapper, ColumnID{0}, "banana", "fig");
+  expect_same_as_two_scans(_string_table_wrapper, ColumnID{0}, "b", "d");
+}
+
+TEST_F(OperatorsBetweenScanTest, ReferenceColumns) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpNotEquals, int64_t{7});
+  scan->execute();
+  expect_same_as_two_scans(scan, ColumnID{0}, 3, 30);
+
+  auto string_scan = std::make_shared<TableScan>(_string_table_wrapper, ColumnID{0}, ScanType::OpNotEquals, "date");
+  string_scan->execute();
+  expect_same_as_two_scans(string_scan, ColumnID{0}, "banana", "fig");
+
+  // the NULL rows of the left join are not part of any range
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("d", "int");
+  for (auto value = 0; value < 10; ++value) right_table->append({value});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+  auto between_scan = std::make_shared<BetweenScan>(join, ColumnID{2}, 0, 100);
+  between_scan->execute();
+  EXPECT_EQ(between_scan->get_output()->row_count(), 140u);
+}
+
+TEST_F(OperatorsBetweenScanTest, PrunesChunksByZoneMap) {
+  auto scan = std::make_shared<BetweenScan>(_table_wrapper, ColumnID{1}, int64_t{150}, int64_t{250}, false, true);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 100u);
+  EXPECT_EQ(scan->pruned_chunk_count(), 3u);
+}
+
+TEST_F(OperatorsBetweenScanTest, EmptyRange) {
+  auto scan = std::make_shared<BetweenScan>(_table_wrapper, ColumnID{0}, 20, 10);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(scan->get_output()->col_count(), 2u);
+
+  auto exclusive_scan = std::make_shared<BetweenScan>(_table_wrapper, ColumnID{0}, 10, 10, true, false);
+  exclusive_scan->execute();
+  EXPECT_EQ(exclusive_scan->get_output()->row_count(), 0u);
+
+  auto invalid_scan = std::make_shared<BetweenScan>(_table_wrapper, ColumnID{2}, 0, 1);
+  EXPECT_THROW(invalid_scan->execute(), std::exception);
+}
+
+}  // namespace opossum
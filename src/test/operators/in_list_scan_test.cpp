@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/in_list_scan.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/column_iteration.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsInListScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    table->add_column("b", "long");
+    table->add_column("c", "string");
+    for (auto i = 0; i < 500; ++i) {
+      // in even chunks, a is even, in odd chunks, it is odd
+      const auto a = 2 * (i % 50) + (i / 100) % 2;
+      table->append({a, int64_t{i}, "value_" + std::to_string(i % 40)});
+    }
+    table->enable_bloom_filter(ColumnID{0});
+    table->compress_chunk(ChunkID{1});
+    table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+    table->compress_chunk(ChunkID{3}, EncodingType::BitPackedDictionary);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const Table> scan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                                    const std::vector<AllTypeVariant>& values) {
+    auto scan = std::make_shared<InListScan>(in, column_id, values);
+    scan->execute();
+    return scan->get_output();
+  }
+
+  // the values of a column of the output, sorted
+  template <typename T>
+  std::vector<T> sorted_values(const Table& table, const ColumnID column_id) {
+    std::vector<T> values;
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      for_each_value<T>(*table.get_chunk(chunk_id).get_column(column_id),
+                        [&](const ChunkOffset, const auto& value) { values.push_back(T{value}); });
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsInListScanTest, AllColumnTypes) {
+  // b is unique, so each listed value that exists matches once
+  auto values = std::vector<AllTypeVariant>{};
+  auto expected = std::vector<int64_t>{};
+  for (int64_t value = -50; value < 700; value += 7) {
+    values.push_back(value);
+    values.push_back(value);
+    if (value >= 0 && value < 500) expected.push_back(value);
+  }
+  EXPECT_EQ(sorted_values<int64_t>(*scan(_table_wrapper, ColumnID{1}, values), ColumnID{1}), expected);
+
+  const auto output = scan(_table_wrapper, ColumnID{0}, {3, 8, 1000});
+  EXPECT_EQ(sorted_values<int>(*output, ColumnID{0}), (std::vector<int>{3, 3, 3, 3, 8, 8, 8, 8, 8, 8}));
+  EXPECT_EQ(sorted_values<int64_t>(*output, ColumnID{1}),
+            (std::vector<int64_t>{4, 54, 101, 151, 204, 254, 301, 351, 404, 454}));
+}
+
+TEST_F(OperatorsInListScanTest, ConsecutiveValues) {
+  // the matching ValueIDs of the dictionary chunk 1 form a range, those of the bit-packed chunk 3 do not
+  auto values = std::vector<AllTypeVariant>{int64_t{320}, int64_t{322}};
+  auto expected = std::vector<int64_t>{};
+  for (int64_t value = 120; value < 130; ++value) expected.push_back(value);
+  expected.insert(expected.end(), {320, 322});
+  for (int64_t value = 340; value < 346; ++value) expected.push_back(value);
+  for (const auto value : expected) values.push_back(value);
+
+  EXPECT_EQ(sorted_values<int64_t>(*scan(_table_wrapper, ColumnID{1}, values), ColumnID{1}), expected);
+}
+
+TEST_F(OperatorsInListScanTest, StringDictionaries) {
+  // a short list is looked up in the dictionaries, a list that is longer than them probes the hash set
+  const auto short_output = scan(_table_wrapper, ColumnID{2}, {"value_3", "value_39", "value_x"});
+  EXPECT_EQ(short_output->row_count(), 25u);
+
+  auto values = std::vector<AllTypeVariant>{};
+  for (auto i = 0; i < 1000; i += 2) values.push_back("value_" + std::to_string(i));
+  const auto long_output = scan(_table_wrapper, ColumnID{2}, values);
+  EXPECT_EQ(long_output->row_count(), 250u);
+  for (const auto& value : sorted_values<std::string>(*long_output, ColumnID{2})) {
+    EXPECT_EQ(std::stoi(value.substr(6)) % 2, 0);
+  }
+}
+
+TEST_F(OperatorsInListScanTest, PrunesChunks) {
+  auto in_list_scan = std::make_shared<InListScan>(_table_wrapper, ColumnID{1}, std::vector<AllTypeVariant>{
+                                                                                    int64_t{5}, int64_t{450}});
+  in_list_scan->execute();
+  EXPECT_EQ(in_list_scan->get_output()->row_count(), 2u);
+  EXPECT_EQ(in_list_scan->pruned_chunk_count(), 3u);
+
+  // the zone maps of odd chunks cover the even values, too, but their Bloom filters do not contain them
+  in_list_scan = std::make_shared<InListScan>(_table_wrapper, ColumnID{0}, std::vector<AllTypeVariant>{4, 10});
+  in_list_scan->execute();
+  EXPECT_EQ(in_list_scan->get_output()->row_count(), 12u);
+  EXPECT_EQ(in_list_scan->pruned_chunk_count(), 0u);
+  EXPECT_EQ(in_list_scan->bloom_filter_pruned_chunk_count(), 2u);
+}
+
+TEST_F(OperatorsInListScanTest, ReferenceColumns) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpGreaterThanEquals, 150);
+  table_scan->execute();
+  EXPECT_EQ(sorted_values<int>(*scan(table_scan, ColumnID{0}, {3, 8, 1000}), ColumnID{0}),
+            (std::vector<int>{3, 3, 3, 8, 8, 8, 8}));
+
+  // NULL rows of a left join are not in any list
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("d", "int");
+  right_table->append({4});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+  EXPECT_EQ(scan(join, ColumnID{3}, {0, 4})->row_count(), 6u);
+}
+
+TEST_F(OperatorsInListScanTest, EmptyList) {
+  const auto output = scan(_table_wrapper, ColumnID{0}, {});
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->col_count(), 3u);
+  EXPECT_THROW(scan(_table_wrapper, ColumnID{3}, {1}), std::exception);
+}
+
+}  // namespace opossum
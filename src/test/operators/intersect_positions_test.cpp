@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/intersect_positions.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsIntersectPositionsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::mt19937 generator{13};
+    std::uniform_int_distribution<int> distribution{0, 99};
+    _table = std::make_shared<Table>(1000);
+    _table->add_column("a", "int");
+    _table->add_column("b", "int");
+    for (auto row = 0; row < 5000; ++row) {
+      _values.emplace_back(distribution(generator), distribution(generator));
+      _table->append({_values.back().first, _values.back().second});
+    }
+    _table->compress_chunk(ChunkID{1});
+    _table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const AbstractOperator> scan(const std::shared_ptr<const AbstractOperator>& in,
+                                               const ColumnID column_id, const ScanType scan_type, const int value) {
+    auto scan = std::make_shared<TableScan>(in, column_id, scan_type, value);
+    scan->execute();
+    return scan;
+  }
+
+  template <typename Operator>
+  std::shared_ptr<const AbstractOperator> combine(const std::shared_ptr<const AbstractOperator>& left,
+                                                  const std::shared_ptr<const AbstractOperator>& right) {
+    auto combination = std::make_shared<Operator>(left, right);
+    combination->execute();
+    return combination;
+  }
+
+  template <typename Predicate>
+  std::shared_ptr<Table> expected_table(const Predicate& predicate) {
+    auto table = std::make_shared<Table>();
+    table->add_column("a", "int");
+    table->add_column("b", "int");
+    for (const auto& [a, b] : _values) {
+      if (predicate(a, b)) table->append({a, b});
+    }
+    return table;
+  }
+
+  std::vector<std::pair<int, int>> _values;
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsIntersectPositionsTest, ConjunctionOfScans) {
+  const auto output = combine<IntersectPositions>(scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 30),
+                                                  scan(_table_wrapper, ColumnID{1}, ScanType::OpGreaterThan, 60));
+  EXPECT_TABLE_EQ(output->get_output(), expected_table([](const int a, const int b) { return a < 30 && b > 60; }));
+
+  // the same as chaining the scans
+  const auto chained_scans = scan(scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 30), ColumnID{1},
+                                  ScanType::OpGreaterThan, 60);
+  EXPECT_TABLE_EQ(output->get_output(), chained_scans->get_output());
+
+  const auto empty = scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  EXPECT_EQ(combine<IntersectPositions>(output, empty)->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsIntersectPositionsTest, ComplexPredicates) {
+  // (a < 20 OR a > 80) AND NOT (b = 50), where the second input is unsorted
+  const auto disjunction = combine<UnionPositions>(scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 20),
+                                                   scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 80));
+  auto sort = std::make_shared<Sort>(scan(_table_wrapper, ColumnID{1}, ScanType::OpNotEquals, 50),
+                                     std::vector<SortColumnDefinition>{{ColumnID{1}}});
+  sort->execute();
+
+  const auto output = combine<IntersectPositions>(disjunction, sort);
+  EXPECT_TABLE_EQ(output->get_output(),
+                  expected_table([](const int a, const int b) { return (a < 20 || a > 80) && b != 50; }));
+  EXPECT_TABLE_EQ(combine<IntersectPositions>(sort, disjunction)->get_output(), output->get_output());
+}
+
+}  // namespace opossum
@@ -0,0 +1,223 @@
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto left = std::make_shared<Table>(2);
+    left->add_column("a", "int");
+    left->add_column("b", "string");
+    const auto rows = std::vector<std::pair<int, std::string>>{{1, "a"}, {2, "b"}, {2, "c"}, {3, "d"}, {5, "e"}};
+    for (const auto& [a, b] : rows) left->append({a, b});
+    left->compress_chunk(ChunkID{0});
+    left->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _left = std::make_shared<TableWrapper>(left);
+    _left->execute();
+
+    auto right = std::make_shared<Table>(3);
+    right->add_column("c", "int");
+    right->add_column("d", "float");
+    for (const auto& [c, d] : std::vector<std::pair<int, float>>{{2, 1.5f}, {3, 2.5f}, {3, 3.5f}, {4, 4.5f}}) {
+      right->append({c, d});
+    }
+    right->compress_chunk_adaptively(ChunkID{0}, {{ColumnID{0}, EncodingType::FrameOfReference},
+                                                  {ColumnID{1}, EncodingType::Dictionary}});
+    _right = std::make_shared<TableWrapper>(right);
+    _right->execute();
+  }
+
+  std::shared_ptr<Table> make_table(const std::vector<std::pair<std::string, std::string>>& columns,
+                                    const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto table = std::make_shared<Table>();
+    for (const auto& [name, type] : columns) table->add_column(name, type);
+    for (const auto& row : rows) table->append(row);
+    return table;
+  }
+
+  std::shared_ptr<const Table> join(const std::shared_ptr<const AbstractOperator>& left,
+                                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                                    const std::pair<ColumnID, ColumnID>& column_ids = {ColumnID{0}, ColumnID{0}}) {
+    auto join = std::make_shared<JoinHash>(left, right, mode, column_ids);
+    join->execute();
+    return join->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _left, _right;
+};
+
+TEST_F(OperatorsJoinHashTest, InnerJoin) {
+  const auto expected = make_table({{"a", "int"}, {"b", "string"}, {"c", "int"}, {"d", "float"}},
+                                   {{2, "b", 2, 1.5f}, {2, "c", 2, 1.5f}, {3, "d", 3, 2.5f}, {3, "d", 3, 3.5f}});
+  EXPECT_TABLE_EQ(join(_left, _right, JoinMode::Inner), expected);
+
+  // the other input is the build side now
+  const auto expected_swapped =
+      make_table({{"c", "int"}, {"d", "float"}, {"a", "int"}, {"b", "string"}},
+                 {{2, 1.5f, 2, "b"}, {2, 1.5f, 2, "c"}, {3, 2.5f, 3, "d"}, {3, 3.5f, 3, "d"}});
+  EXPECT_TABLE_EQ(join(_right, _left, JoinMode::Inner), expected_swapped);
+}
+
+TEST_F(OperatorsJoinHashTest, LeftJoin) {
+  const auto output = join(_left, _right, JoinMode::Left);
+
+  // as there are no NULL values yet, unmatched rows show the default values on the right
+  const auto expected =
+      make_table({{"a", "int"}, {"b", "string"}, {"c", "int"}, {"d", "float"}},
+                 {{1, "a", 0, 0.0f}, {2, "b", 2, 1.5f}, {2, "c", 2, 1.5f}, {3, "d", 3, 2.5f}, {3, "d", 3, 3.5f},
+                  {5, "e", 0, 0.0f}});
+  EXPECT_TABLE_EQ(output, expected);
+
+  auto null_rows = 0;
+  const auto right_column = std::dynamic_pointer_cast<const ReferenceColumn>(
+      output->get_chunk(ChunkID{0}).get_column(ColumnID{2}));
+  for (const auto& row_id : *right_column->pos_list()) null_rows += row_id == NULL_ROW_ID;
+  EXPECT_EQ(null_rows, 2);
+
+  // NULL rows never match a predicate
+  auto table_wrapper = std::make_shared<TableWrapper>(output);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{2}, ScanType::OpLessThan, 3);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 2u);
+
+  const auto expected_swapped =
+      make_table({{"c", "int"}, {"d", "float"}, {"a", "int"}, {"b", "string"}},
+                 {{2, 1.5f, 2, "b"}, {2, 1.5f, 2, "c"}, {3, 2.5f, 3, "d"}, {3, 3.5f, 3, "d"}, {4, 4.5f, 0, ""}});
+  EXPECT_TABLE_EQ(join(_right, _left, JoinMode::Left), expected_swapped);
+}
+
+TEST_F(OperatorsJoinHashTest, SemiAndAntiJoin) {
+  EXPECT_TABLE_EQ(join(_left, _right, JoinMode::Semi),
+                  make_table({{"a", "int"}, {"b", "string"}}, {{2, "b"}, {2, "c"}, {3, "d"}}));
+  EXPECT_TABLE_EQ(join(_left, _right, JoinMode::Anti),
+                  make_table({{"a", "int"}, {"b", "string"}}, {{1, "a"}, {5, "e"}}));
+
+  EXPECT_TABLE_EQ(join(_right, _left, JoinMode::Semi),
+                  make_table({{"c", "int"}, {"d", "float"}}, {{2, 1.5f}, {3, 2.5f}, {3, 3.5f}}));
+  EXPECT_TABLE_EQ(join(_right, _left, JoinMode::Anti), make_table({{"c", "int"}, {"d", "float"}}, {{4, 4.5f}}));
+}
+
+TEST_F(OperatorsJoinHashTest, JoinReferencedColumns) {
+  auto scan_left = std::make_shared<TableScan>(_left, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  scan_left->execute();
+  auto scan_right = std::make_shared<TableScan>(_right, ColumnID{1}, ScanType::OpGreaterThan, 2.0f);
+  scan_right->execute();
+
+  const auto output = join(scan_left, scan_right, JoinMode::Inner);
+  EXPECT_TABLE_EQ(output, make_table({{"a", "int"}, {"b", "string"}, {"c", "int"}, {"d", "float"}},
+                                     {{3, "d", 3, 2.5f}, {3, "d", 3, 3.5f}}));
+
+  // the output references the tables that hold the data
+  const auto& chunk = output->get_chunk(ChunkID{0});
+  EXPECT_EQ(std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{1}))->referenced_table(),
+            _left->get_output());
+  EXPECT_EQ(std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{3}))->referenced_table(),
+            _right->get_output());
+}
+
+TEST_F(OperatorsJoinHashTest, JoinStringColumns) {
+  auto right = std::make_shared<TableWrapper>(
+      make_table({{"name", "string"}}, {{"c"}, {"a"}, {"a long string that is not inlined"}, {"z"}}));
+  right->execute();
+
+  EXPECT_TABLE_EQ(join(_left, right, JoinMode::Inner, {ColumnID{1}, ColumnID{0}}),
+                  make_table({{"a", "int"}, {"b", "string"}, {"name", "string"}}, {{1, "a", "a"}, {2, "c", "c"}}));
+}
+
+TEST_F(OperatorsJoinHashTest, LargeJoin) {
+  // enough rows for several partitions and threads
+  std::mt19937 generator{17};
+  std::uniform_int_distribution<int64_t> distribution{0, 20000};
+  std::map<int64_t, size_t> left_counts, right_counts;
+
+  auto left = std::make_shared<Table>(10000);
+  left->add_column("a", "long");
+  for (auto i = 0; i < 50000; ++i) {
+    const auto value = distribution(generator);
+    left->append({value});
+    ++left_counts[value];
+  }
+  auto right = std::make_shared<Table>(7000);
+  right->add_column("b", "long");
+  for (auto i = 0; i < 30000; ++i) {
+    const auto value = distribution(generator);
+    right->append({value});
+    ++right_counts[value];
+  }
+  left->compress_chunk(ChunkID{1});
+
+  size_t expected_inner = 0, expected_semi = 0;
+  for (const auto& [value, count] : left_counts) {
+    const auto it = right_counts.find(value);
+    if (it == right_counts.end()) continue;
+    expected_inner += count * it->second;
+    expected_semi += count;
+  }
+
+  auto left_wrapper = std::make_shared<TableWrapper>(left);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right);
+  right_wrapper->execute();
+
+  EXPECT_EQ(join(left_wrapper, right_wrapper, JoinMode::Inner)->row_count(), expected_inner);
+  EXPECT_EQ(join(left_wrapper, right_wrapper, JoinMode::Semi)->row_count(), expected_semi);
+  EXPECT_EQ(join(left_wrapper, right_wrapper, JoinMode::Anti)->row_count(), 50000 - expected_semi);
+  EXPECT_EQ(join(left_wrapper, right_wrapper, JoinMode::Left)->row_count(), expected_inner + 50000 - expected_semi);
+  EXPECT_EQ(join(right_wrapper, left_wrapper, JoinMode::Inner)->row_count(), expected_inner);
+}
+
+TEST_F(OperatorsJoinHashTest, SelfJoin) {
+  const auto output = join(_left, _left, JoinMode::Inner);
+  EXPECT_EQ(output->column_names(), (std::vector<std::string>{"a", "b", "right.a", "right.b"}));
+  const auto expected = make_table({{"a", "int"}, {"b", "string"}, {"right.a", "int"}, {"right.b", "string"}},
+                                   {{1, "a", 1, "a"},
+                                    {2, "b", 2, "b"},
+                                    {2, "b", 2, "c"},
+                                    {2, "c", 2, "b"},
+                                    {2, "c", 2, "c"},
+                                    {3, "d", 3, "d"},
+                                    {5, "e", 5, "e"}});
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsJoinHashTest, SharedColumnNames) {
+  auto left = std::make_shared<TableWrapper>(make_table({{"id", "int"}, {"x", "string"}}, {{1, "a"}, {2, "b"}}));
+  left->execute();
+  auto right = std::make_shared<TableWrapper>(
+      make_table({{"id", "int"}, {"l_id", "int"}}, {{10, 1}, {11, 1}, {12, 3}}));
+  right->execute();
+
+  const auto output = join(left, right, JoinMode::Left, {ColumnID{0}, ColumnID{1}});
+  EXPECT_EQ(output->column_names(), (std::vector<std::string>{"id", "x", "right.id", "l_id"}));
+  EXPECT_EQ(output->row_count(), 3u);
+
+  // qualified names that are taken as well get a number
+  auto qualified_left =
+      std::make_shared<TableWrapper>(make_table({{"id", "int"}, {"right.id", "int"}}, {{1, 2}, {3, 4}}));
+  qualified_left->execute();
+  EXPECT_EQ(join(qualified_left, right, JoinMode::Inner, {ColumnID{0}, ColumnID{1}})->column_names(),
+            (std::vector<std::string>{"id", "right.id", "right.id_2", "l_id"}));
+}
+
+TEST_F(OperatorsJoinHashTest, InvalidColumns) {
+  EXPECT_THROW(join(_left, _right, JoinMode::Inner, {ColumnID{1}, ColumnID{0}}), std::exception);
+  EXPECT_THROW(join(_left, _right, JoinMode::Inner, {ColumnID{0}, ColumnID{5}}), std::exception);
+}
+
+}  // namespace opossum
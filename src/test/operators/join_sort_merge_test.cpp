@@ -0,0 +1,258 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinSortMergeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _left_table = std::make_shared<Table>(3);
+    _left_table->add_column("a", "int");
+    _left_table->add_column("b", "string");
+    const auto rows = std::vector<std::pair<int, std::string>>{{5, "e"}, {2, "b"}, {1, "a"}, {3, "d"}, {2, "c"}};
+    for (const auto& [a, b] : rows) _left_table->append({a, b});
+    _left_table->compress_chunk(ChunkID{0});
+    _left = std::make_shared<TableWrapper>(_left_table);
+    _left->execute();
+
+    _right_table = std::make_shared<Table>(2);
+    _right_table->add_column("c", "int");
+    _right_table->add_column("d", "float");
+    for (const auto& [c, d] : std::vector<std::pair<int, float>>{{3, 2.5f}, {2, 1.5f}, {4, 4.5f}, {3, 3.5f}}) {
+      _right_table->append({c, d});
+    }
+    _right_table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _right = std::make_shared<TableWrapper>(_right_table);
+    _right->execute();
+  }
+
+  std::shared_ptr<const Table> join(const std::shared_ptr<const AbstractOperator>& left,
+                                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                                    const ScanType scan_type,
+                                    const std::pair<ColumnID, ColumnID>& column_ids = {ColumnID{0}, ColumnID{0}}) {
+    auto join = std::make_shared<JoinSortMerge>(left, right, mode, column_ids, scan_type);
+    join->execute();
+    return join->get_output();
+  }
+
+  // Joins the first columns of two int tables with nested loops
+  std::shared_ptr<Table> nested_loop_join(const Table& left, const Table& right, const JoinMode mode,
+                                          const ScanType scan_type) {
+    const auto matches = [&](const int left_value, const int right_value) {
+      switch (scan_type) {
+        case ScanType::OpEquals:
+          return left_value == right_value;
+        case ScanType::OpNotEquals:
+          return left_value != right_value;
+        case ScanType::OpLessThan:
+          return left_value < right_value;
+        case ScanType::OpLessThanEquals:
+          return left_value <= right_value;
+        case ScanType::OpGreaterThan:
+          return left_value > right_value;
+        default:
+          return left_value >= right_value;
+      }
+    };
+
+    auto output = std::make_shared<Table>();
+    output->add_column("a", "int");
+    if (mode == JoinMode::Inner || mode == JoinMode::Left) output->add_column("b", "int");
+
+    for (size_t left_row = 0; left_row < left.row_count(); ++left_row) {
+      const auto left_value = type_cast<int>(_get_value(left, left_row));
+      auto has_match = false;
+      for (size_t right_row = 0; right_row < right.row_count(); ++right_row) {
+        const auto right_value = type_cast<int>(_get_value(right, right_row));
+        if (!matches(left_value, right_value)) continue;
+        has_match = true;
+        if (mode == JoinMode::Inner || mode == JoinMode::Left) output->append({left_value, right_value});
+      }
+      if (mode == JoinMode::Left && !has_match) output->append({left_value, 0});
+      if ((mode == JoinMode::Semi && has_match) || (mode == JoinMode::Anti && !has_match)) output->append({left_value});
+    }
+    return output;
+  }
+
+  AllTypeVariant _get_value(const Table& table, const size_t row) {
+    const auto chunk_size = table.chunk_size();
+    return (*table.get_chunk(ChunkID{static_cast<ChunkID::base_type>(row / chunk_size)}).get_column(
+        ColumnID{0}))[row % chunk_size];
+  }
+
+  std::shared_ptr<Table> _left_table, _right_table;
+  std::shared_ptr<TableWrapper> _left, _right;
+};
+
+TEST_F(OperatorsJoinSortMergeTest, EquiJoin) {
+  const auto expected = std::make_shared<Table>();
+  for (const auto& [name, type] : std::vector<std::pair<std::string, std::string>>{
+           {"a", "int"}, {"b", "string"}, {"c", "int"}, {"d", "float"}}) {
+    expected->add_column(name, type);
+  }
+  expected->append({2, "b", 2, 1.5f});
+  expected->append({2, "c", 2, 1.5f});
+  expected->append({3, "d", 3, 2.5f});
+  expected->append({3, "d", 3, 3.5f});
+  EXPECT_TABLE_EQ(join(_left, _right, JoinMode::Inner, ScanType::OpEquals), expected);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, AllScanTypesAndModes) {
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::Anti}) {
+      const auto output = join(_left, _right, mode, scan_type);
+
+      // only keep the join columns
+      auto actual = std::make_shared<Table>();
+      actual->add_column("a", "int");
+      const auto outputs_right = mode == JoinMode::Inner || mode == JoinMode::Left;
+      if (outputs_right) actual->add_column("b", "int");
+      const auto& chunk = output->get_chunk(ChunkID{0});
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+        if (outputs_right) {
+          actual->append(
+              {(*chunk.get_column(ColumnID{0}))[chunk_offset], (*chunk.get_column(ColumnID{2}))[chunk_offset]});
+        } else {
+          actual->append({(*chunk.get_column(ColumnID{0}))[chunk_offset]});
+        }
+      }
+
+      EXPECT_TABLE_EQ(actual, nested_loop_join(*_left_table, *_right_table, mode, scan_type));
+    }
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, OutputIsSortedByJoinValues) {
+  const auto output = join(_left, _right, JoinMode::Inner, ScanType::OpLessThan);
+  const auto& column = *output->get_chunk(ChunkID{0}).get_column(ColumnID{0});
+  ASSERT_GT(column.size(), 0u);
+  for (ChunkOffset chunk_offset = 1; chunk_offset < column.size(); ++chunk_offset) {
+    EXPECT_LE(type_cast<int>(column[chunk_offset - 1]), type_cast<int>(column[chunk_offset]));
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, JoinStringColumns) {
+  auto right_table = std::make_shared<Table>(2);
+  right_table->add_column("name", "string");
+  for (const auto& name : {"c", "a", "a long string that is not inlined", "b"}) right_table->append({name});
+  right_table->compress_chunk(ChunkID{0});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  // "a long string ..." is greater than "a" only
+  const auto output = join(_left, right, JoinMode::Semi, ScanType::OpLessThan, {ColumnID{1}, ColumnID{0}});
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->append({2, "b"});
+  expected->append({1, "a"});
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, JoinReferencedColumnsWithNullRows) {
+  // the row c = 4 has no match and is paired with a NULL row on the right
+  auto left_join = std::make_shared<JoinSortMerge>(_right, _left, JoinMode::Left,
+                                                   std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+  left_join->execute();
+  auto scan = std::make_shared<TableScan>(left_join, ColumnID{0}, ScanType::OpNotEquals, 2);
+  scan->execute();
+  ASSERT_EQ(scan->get_output()->row_count(), 3u);
+
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("e", "int");
+  right_table->append({3});
+  right_table->append({4});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  // the NULL row never matches, but is kept by left and anti joins
+  EXPECT_EQ(join(scan, right, JoinMode::Inner, ScanType::OpEquals, {ColumnID{2}, ColumnID{0}})->row_count(), 2u);
+  EXPECT_EQ(join(scan, right, JoinMode::Left, ScanType::OpEquals, {ColumnID{2}, ColumnID{0}})->row_count(), 3u);
+  EXPECT_EQ(join(scan, right, JoinMode::Anti, ScanType::OpLessThan, {ColumnID{2}, ColumnID{0}})->row_count(), 1u);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, LargePresortedAndUnsortedInputs) {
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<int> distribution{0, 5000};
+
+  auto sorted_table = std::make_shared<Table>(3000);
+  sorted_table->add_column("a", "int");
+  for (auto value = 0; value < 20000; ++value) sorted_table->append({value / 4});
+  sorted_table->compress_chunk(ChunkID{2});
+
+  auto unsorted_table = std::make_shared<Table>(2000);
+  unsorted_table->add_column("b", "int");
+  std::vector<size_t> counts(5001);
+  for (auto row = 0; row < 10000; ++row) {
+    const auto value = distribution(generator);
+    unsorted_table->append({value});
+    ++counts[value];
+  }
+  unsorted_table->compress_chunk(ChunkID{1});
+
+  size_t expected_equal = 0;
+  for (auto value = 0; value < 5000; ++value) expected_equal += 4 * counts[value];
+  auto max_value = 5000;
+  while (counts[max_value] == 0) --max_value;
+
+  auto sorted = std::make_shared<TableWrapper>(sorted_table);
+  sorted->execute();
+  auto unsorted = std::make_shared<TableWrapper>(unsorted_table);
+  unsorted->execute();
+
+  EXPECT_EQ(join(sorted, unsorted, JoinMode::Inner, ScanType::OpEquals)->row_count(), expected_equal);
+  EXPECT_EQ(join(unsorted, sorted, JoinMode::Inner, ScanType::OpEquals)->row_count(), expected_equal);
+
+  // the sorted values less than the largest unsorted one, and the unsorted values greater than 0
+  EXPECT_EQ(join(sorted, unsorted, JoinMode::Semi, ScanType::OpLessThan)->row_count(),
+            static_cast<size_t>(std::min(max_value, 5000) * 4));
+  EXPECT_EQ(join(unsorted, sorted, JoinMode::Semi, ScanType::OpGreaterThan)->row_count(), 10000 - counts[0]);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, SelfJoinAndSharedColumnNames) {
+  const auto self_join = join(_left, _left, JoinMode::Inner, ScanType::OpLessThan);
+  EXPECT_EQ(self_join->column_names(), (std::vector<std::string>{"a", "b", "right.a", "right.b"}));
+  // pairs of the values 1, 2, 2, 3, 5 where the left one is smaller
+  EXPECT_EQ(self_join->row_count(), 9u);
+
+  auto left_table = std::make_shared<Table>();
+  left_table->add_column("id", "int");
+  left_table->add_column("x", "string");
+  left_table->append({1, "a"});
+  left_table->append({2, "b"});
+  auto left = std::make_shared<TableWrapper>(left_table);
+  left->execute();
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("id", "int");
+  right_table->add_column("l_id", "int");
+  for (const auto& [id, l_id] : std::vector<std::pair<int, int>>{{10, 1}, {11, 1}, {12, 3}}) {
+    right_table->append({id, l_id});
+  }
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  const auto output = join(left, right, JoinMode::Left, ScanType::OpEquals, {ColumnID{0}, ColumnID{1}});
+  EXPECT_EQ(output->column_names(), (std::vector<std::string>{"id", "x", "right.id", "l_id"}));
+  EXPECT_EQ(output->row_count(), 3u);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, InvalidColumns) {
+  EXPECT_THROW(join(_left, _right, JoinMode::Inner, ScanType::OpEquals, {ColumnID{1}, ColumnID{0}}), std::exception);
+}
+
+}  // namespace opossum
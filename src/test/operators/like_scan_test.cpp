@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/like_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/column_iteration.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsLikeScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    const auto strings = std::vector<std::string>{"apple",  "apricot", "banana", "blueberry", "cherry", "apple",
+                                                  "cranberry", "date", "ap", "grape",  "grapefruit", "a_b%c",
+                                                  "papaya", "",      "apple",     "banana"};
+    for (auto index = 0; index < static_cast<int>(strings.size()); ++index) table->append({index, strings[index]});
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    table->compress_chunk(ChunkID{3}, EncodingType::BitPackedDictionary);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // the values of column a of the rows that match the pattern, sorted
+  std::vector<int> like(const std::shared_ptr<const AbstractOperator>& in, const std::string& pattern,
+                        const ColumnID column_id = ColumnID{1}) {
+    auto scan = std::make_shared<LikeScan>(in, column_id, pattern);
+    scan->execute();
+    const auto& output = *scan->get_output();
+    std::vector<int> values;
+    for (ChunkID chunk_id{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+      for_each_value<int>(*output.get_chunk(chunk_id).get_column(ColumnID{0}),
+                          [&](const ChunkOffset, const int value) { values.push_back(value); });
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsLikeScanTest, Prefix) {
+  EXPECT_EQ(like(_table_wrapper, "ap%"), (std::vector<int>{0, 1, 5, 8, 14}));
+  EXPECT_EQ(like(_table_wrapper, "grape%%"), (std::vector<int>{9, 10}));
+  EXPECT_EQ(like(_table_wrapper, "%"), (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}));
+  EXPECT_EQ(like(_table_wrapper, "z%"), (std::vector<int>{}));
+}
+
+TEST_F(OperatorsLikeScanTest, Equality) {
+  EXPECT_EQ(like(_table_wrapper, "apple"), (std::vector<int>{0, 5, 14}));
+  EXPECT_EQ(like(_table_wrapper, ""), (std::vector<int>{13}));
+  EXPECT_EQ(like(_table_wrapper, "appl"), (std::vector<int>{}));
+}
+
+TEST_F(OperatorsLikeScanTest, GeneralPatterns) {
+  EXPECT_EQ(like(_table_wrapper, "%berry"), (std::vector<int>{3, 6}));
+  EXPECT_EQ(like(_table_wrapper, "%an%"), (std::vector<int>{2, 6, 15}));
+  EXPECT_EQ(like(_table_wrapper, "_a%a"), (std::vector<int>{2, 12, 15}));
+  EXPECT_EQ(like(_table_wrapper, "a%p%e"), (std::vector<int>{0, 5, 14}));
+  EXPECT_EQ(like(_table_wrapper, "____"), (std::vector<int>{7}));
+  EXPECT_EQ(like(_table_wrapper, "%a%a%a%"), (std::vector<int>{2, 12, 15}));
+  EXPECT_EQ(like(_table_wrapper, "ap_%"), (std::vector<int>{0, 1, 5, 14}));
+
+  // wildcards in the values are plain characters
+  EXPECT_EQ(like(_table_wrapper, "a_b_c"), (std::vector<int>{11}));
+}
+
+TEST_F(OperatorsLikeScanTest, PrunesChunksByPrefix) {
+  // only the third and the last chunk hold values between "gr" and "gs"
+  auto scan = std::make_shared<LikeScan>(_table_wrapper, ColumnID{1}, "gr%t");
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 1u);
+  EXPECT_EQ(scan->pruned_chunk_count(), 2u);
+}
+
+TEST_F(OperatorsLikeScanTest, ReferenceColumns) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 5);
+  table_scan->execute();
+  EXPECT_EQ(like(table_scan, "ap%"), (std::vector<int>{0, 1, 8, 14}));
+  EXPECT_EQ(like(table_scan, "%an%"), (std::vector<int>{2, 6, 15}));
+
+  // NULL rows of a left join match no pattern, not even "%"
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("c", "int");
+  right_table->add_column("d", "string");
+  right_table->append({2, "banana"});
+  right_table->append({3, "blue"});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+  EXPECT_EQ(like(join, "%", ColumnID{3}), (std::vector<int>{2, 3}));
+  EXPECT_EQ(like(join, "b%a", ColumnID{3}), (std::vector<int>{2}));
+}
+
+TEST_F(OperatorsLikeScanTest, InvalidColumns) {
+  EXPECT_THROW(like(_table_wrapper, "%", ColumnID{0}), std::exception);
+  EXPECT_THROW(like(_table_wrapper, "%", ColumnID{2}), std::exception);
+}
+
+}  // namespace opossum
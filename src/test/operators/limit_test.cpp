@@ -0,0 +1,65 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsLimitTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto value = 0; value < 5; ++value) _table->append({value, std::to_string(value)});
+    _table->compress_chunk(ChunkID{1});
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const Table> limit(const std::shared_ptr<const AbstractOperator>& in, const size_t row_count) {
+    auto limit = std::make_shared<Limit>(in, row_count);
+    limit->execute();
+    return limit->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsLimitTest, FirstRows) {
+  const auto output = limit(_table_wrapper, 3);
+  ASSERT_EQ(output->chunk_count(), 1u);
+  ASSERT_EQ(output->row_count(), 3u);
+  const auto& chunk = output->get_chunk(ChunkID{0});
+  for (ChunkOffset chunk_offset = 0; chunk_offset < 3; ++chunk_offset) {
+    EXPECT_EQ(type_cast<int>((*chunk.get_column(ColumnID{0}))[chunk_offset]), static_cast<int>(chunk_offset));
+    EXPECT_EQ(type_cast<std::string>((*chunk.get_column(ColumnID{1}))[chunk_offset]), std::to_string(chunk_offset));
+  }
+  EXPECT_EQ(output->column_name(ColumnID{1}), "b");
+}
+
+TEST_F(OperatorsLimitTest, LimitLargerThanInput) {
+  EXPECT_TABLE_EQ(limit(_table_wrapper, 10), _table);
+  EXPECT_EQ(limit(_table_wrapper, 0)->row_count(), 0u);
+}
+
+TEST_F(OperatorsLimitTest, ReferencedInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->append({2, "2"});
+  expected->append({3, "3"});
+  EXPECT_TABLE_EQ(limit(scan, 2), expected);
+}
+
+}  // namespace opossum
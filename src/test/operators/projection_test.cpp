@@ -0,0 +1,190 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3000);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "double");
+    _table->add_column("d", "string");
+    for (auto row = 0; row < 10000; ++row) {
+      _table->append({row % 100 - 50, int64_t{row} * 1'000'000, row * 0.5, std::to_string(row)});
+    }
+    _table->compress_chunk(ChunkID{0});
+    _table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const Table> project(const std::shared_ptr<const AbstractOperator>& in,
+                                       const std::vector<ProjectionColumnDefinition>& columns) {
+    auto projection = std::make_shared<Projection>(in, columns);
+    projection->execute();
+    return projection->get_output();
+  }
+
+  static std::shared_ptr<const ProjectionExpression> column(const uint16_t column_id) {
+    return ProjectionExpression::column(ColumnID{column_id});
+  }
+
+  static std::shared_ptr<const ProjectionExpression> literal(const AllTypeVariant& value) {
+    return ProjectionExpression::literal(value);
+  }
+
+  static std::shared_ptr<const ProjectionExpression> arithmetic(
+      const ArithmeticOperator arithmetic_operator, const std::shared_ptr<const ProjectionExpression>& left,
+      const std::shared_ptr<const ProjectionExpression>& right) {
+    return ProjectionExpression::arithmetic(arithmetic_operator, left, right);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsProjectionTest, PassThroughColumns) {
+  const auto output = project(_table_wrapper, {{column(3)}, {column(0), "x"}});
+  ASSERT_EQ(output->chunk_count(), _table->chunk_count());
+  EXPECT_EQ(output->column_name(ColumnID{0}), "d");
+  EXPECT_EQ(output->column_name(ColumnID{1}), "x");
+  EXPECT_EQ(output->column_type(ColumnID{1}), "int");
+
+  // the columns and their zone maps are shared, not copied
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    const auto& input_chunk = _table->get_chunk(chunk_id);
+    EXPECT_EQ(chunk.get_column(ColumnID{0}), input_chunk.get_column(ColumnID{3}));
+    EXPECT_EQ(chunk.get_column(ColumnID{1}), input_chunk.get_column(ColumnID{0}));
+    EXPECT_EQ(chunk.zone_map(ColumnID{1}), input_chunk.zone_map(ColumnID{0}));
+  }
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 7);
+  scan->execute();
+  const auto referenced_output = project(scan, {{column(1)}});
+  const auto& scan_output = *scan->get_output();
+  for (ChunkID chunk_id{0}; chunk_id < scan_output.chunk_count(); ++chunk_id) {
+    EXPECT_EQ(referenced_output->get_chunk(chunk_id).get_column(ColumnID{0}),
+              scan_output.get_chunk(chunk_id).get_column(ColumnID{1}));
+  }
+}
+
+TEST_F(OperatorsProjectionTest, Arithmetic) {
+  // a * 2 + b is a long, (a / 3) is an integer division within a double expression
+  const auto output =
+      project(_table_wrapper, {{arithmetic(ArithmeticOperator::Addition,
+                                           arithmetic(ArithmeticOperator::Multiplication, column(0), literal(2)),
+                                           column(1))},
+                               {arithmetic(ArithmeticOperator::Subtraction,
+                                           arithmetic(ArithmeticOperator::Division, column(0), literal(3)), column(2)),
+                                "e"},
+                               {arithmetic(ArithmeticOperator::Division, column(2), literal(2.0f))},
+                               {literal("constant")}});
+
+  EXPECT_EQ(output->column_name(ColumnID{0}), "((a * 2) + b)");
+  EXPECT_EQ(output->column_type(ColumnID{0}), "long");
+  EXPECT_EQ(output->column_name(ColumnID{1}), "e");
+  EXPECT_EQ(output->column_type(ColumnID{1}), "double");
+  EXPECT_EQ(output->column_name(ColumnID{2}), "(c / 2)");
+  EXPECT_EQ(output->column_type(ColumnID{3}), "string");
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("((a * 2) + b)", "long");
+  expected->add_column("e", "double");
+  expected->add_column("(c / 2)", "double");
+  expected->add_column("constant", "string");
+  for (auto row = 0; row < 10000; ++row) {
+    const auto a = row % 100 - 50;
+    expected->append({int64_t{a} * 2 + int64_t{row} * 1'000'000, a / 3 - row * 0.5, row * 0.25, "constant"});
+  }
+  EXPECT_TABLE_EQ(output, expected);
+}
+
+TEST_F(OperatorsProjectionTest, NullRows) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("e", "int");
+  right_table->add_column("f", "float");
+  right_table->append({1, 0.5f});
+  right_table->append({2, 1.5f});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 3);
+  scan->execute();
+  auto join = std::make_shared<JoinHash>(scan, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  // f is NULL for rows that do not have a = 1 or a = 2, so is f + a, while a + a is never NULL
+  const auto output = project(join, {{column(0)},
+                                     {arithmetic(ArithmeticOperator::Addition, column(5), column(0))},
+                                     {arithmetic(ArithmeticOperator::Addition, column(0), column(0))},
+                                     {arithmetic(ArithmeticOperator::Division, literal(10), column(4))}});
+  ASSERT_EQ(output->row_count(), join->get_output()->row_count());
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+      const auto a = type_cast<int>((*chunk.get_column(ColumnID{0}))[chunk_offset]);
+      const auto& sum = dynamic_cast<const ReferenceColumn&>(*chunk.get_column(ColumnID{1}));
+      const auto& doubled = dynamic_cast<const ReferenceColumn&>(*chunk.get_column(ColumnID{2}));
+      const auto& quotient = dynamic_cast<const ReferenceColumn&>(*chunk.get_column(ColumnID{3}));
+      EXPECT_EQ(doubled.pos_list()->at(chunk_offset) == NULL_ROW_ID, false);
+      EXPECT_EQ(type_cast<int>(doubled[chunk_offset]), 2 * a);
+      if (a == 1 || a == 2) {
+        EXPECT_FLOAT_EQ(type_cast<float>(sum[chunk_offset]), a - 0.5f + a);
+        EXPECT_EQ(type_cast<int>(quotient[chunk_offset]), 10 / a);
+      } else {
+        // e is NULL as well, so the division by its unspecified value does not fail
+        EXPECT_EQ(sum.pos_list()->at(chunk_offset), NULL_ROW_ID);
+        EXPECT_EQ(quotient.pos_list()->at(chunk_offset), NULL_ROW_ID);
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsProjectionTest, TableWithoutColumns) {
+  // a table with only column definitions holds a single chunk without columns
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("a", "int");
+  table->add_column_definition("b", "double");
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto output =
+      project(table_wrapper, {{column(1)}, {arithmetic(ArithmeticOperator::Multiplication, column(0), literal(2))}});
+  ASSERT_EQ(output->chunk_count(), 1u);
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).col_count(), 2u);
+  EXPECT_EQ(output->column_type(ColumnID{1}), "int");
+
+  // the output can be used by further operators
+  auto output_wrapper = std::make_shared<TableWrapper>(output);
+  output_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(output_wrapper, ColumnID{1}, ScanType::OpEquals, 2);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsProjectionTest, InvalidExpressions) {
+  EXPECT_THROW(project(_table_wrapper, {{column(4)}}), std::exception);
+  EXPECT_THROW(project(_table_wrapper, {{arithmetic(ArithmeticOperator::Addition, column(0), column(3))}}),
+               std::exception);
+  EXPECT_THROW(project(_table_wrapper, {{arithmetic(ArithmeticOperator::Division, column(1), literal(0))}}),
+               std::exception);
+  EXPECT_THROW(project(_table_wrapper, {{nullptr}}), std::exception);
+}
+
+}  // namespace opossum
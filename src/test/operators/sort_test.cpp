@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "double");
+    table->append({2, "b", 1.5});
+    table->append({1, "c", -2.0});
+    table->append({2, "a", 0.0});
+    table->append({-3, "b", -0.5});
+    table->append({1, "a", 3.0});
+    table->append({2, "b", -1.0});
+    table->append({1, "c", 2.5});
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const Table> sort(const std::shared_ptr<const AbstractOperator>& in,
+                                    const std::vector<SortColumnDefinition>& sort_definitions) {
+    auto sort = std::make_shared<Sort>(in, sort_definitions);
+    sort->execute();
+    return sort->get_output();
+  }
+
+  // the values of a column of the sort output, in their order
+  template <typename T>
+  std::vector<T> values(const Table& table, const ColumnID column_id) {
+    EXPECT_EQ(table.chunk_count(), 1u);
+    const auto& column = *table.get_chunk(ChunkID{0}).get_column(column_id);
+    std::vector<T> values;
+    for (ChunkOffset chunk_offset = 0; chunk_offset < column.size(); ++chunk_offset) {
+      values.push_back(type_cast<T>(column[chunk_offset]));
+    }
+    return values;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsSortTest, SingleColumn) {
+  const auto output = sort(_table_wrapper, {{ColumnID{2}}});
+  EXPECT_EQ(values<double>(*output, ColumnID{2}), (std::vector<double>{-2.0, -1.0, -0.5, 0.0, 1.5, 2.5, 3.0}));
+  EXPECT_EQ(values<int>(*output, ColumnID{0}), (std::vector<int>{1, 2, -3, 2, 2, 1, 1}));
+
+  const auto descending = sort(_table_wrapper, {{ColumnID{0}, OrderByMode::Descending}});
+  EXPECT_EQ(values<int>(*descending, ColumnID{0}), (std::vector<int>{2, 2, 2, 1, 1, 1, -3}));
+  EXPECT_EQ(output->column_name(ColumnID{1}), "b");
+  EXPECT_EQ(output->column_type(ColumnID{2}), "double");
+}
+
+TEST_F(OperatorsSortTest, MultipleColumns) {
+  const auto output = sort(_table_wrapper, {{ColumnID{0}, OrderByMode::Ascending},
+                                            {ColumnID{1}, OrderByMode::Descending},
+                                            {ColumnID{2}, OrderByMode::Ascending}});
+  EXPECT_EQ(values<int>(*output, ColumnID{0}), (std::vector<int>{-3, 1, 1, 1, 2, 2, 2}));
+  EXPECT_EQ(values<std::string>(*output, ColumnID{1}), (std::vector<std::string>{"b", "c", "c", "a", "b", "b", "a"}));
+  EXPECT_EQ(values<double>(*output, ColumnID{2}), (std::vector<double>{-0.5, -2.0, 2.5, 3.0, -1.0, 1.5, 0.0}));
+}
+
+TEST_F(OperatorsSortTest, StringsWithCommonPrefixes) {
+  // the strings only differ after the prefix that is part of the keys, some only in their length
+  const auto strings = std::vector<std::string>{"prefix_of_all_b", "prefix_of_all", "prefix_of_all_a",
+                                                "short",           "prefix_of",     "prefix_of_all_",
+                                                "",                "prefix_of_all_ab"};
+  for (const auto encode : {false, true}) {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "string");
+    for (const auto& string : strings) table->append({string});
+    if (encode) table->compress_chunk(ChunkID{1});
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    auto expected = strings;
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(values<std::string>(*sort(table_wrapper, {{ColumnID{0}}}), ColumnID{0}), expected);
+
+    std::reverse(expected.begin(), expected.end());
+    EXPECT_EQ(values<std::string>(*sort(table_wrapper, {{ColumnID{0}, OrderByMode::Descending}}), ColumnID{0}),
+              expected);
+  }
+}
+
+TEST_F(OperatorsSortTest, NullRowsComeLast) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("d", "int");
+  right_table->append({1});
+  right_table->append({-3});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  const auto expect_null_positions = [](const Table& table, const std::vector<size_t>& expected_null_positions) {
+    const auto& column = dynamic_cast<const ReferenceColumn&>(*table.get_chunk(ChunkID{0}).get_column(ColumnID{3}));
+    const auto& pos_list = *column.pos_list();
+    for (size_t position = 0; position < pos_list.size(); ++position) {
+      const auto is_expected_null = std::find(expected_null_positions.cbegin(), expected_null_positions.cend(),
+                                              position) != expected_null_positions.cend();
+      EXPECT_EQ(pos_list[position] == NULL_ROW_ID, is_expected_null);
+    }
+  };
+
+  // the three rows with a = 2 have no match
+  const auto ascending = sort(join, {{ColumnID{3}}, {ColumnID{2}}});
+  expect_null_positions(*ascending, {4, 5, 6});
+  EXPECT_EQ(values<double>(*ascending, ColumnID{2}), (std::vector<double>{-0.5, -2.0, 2.5, 3.0, -1.0, 0.0, 1.5}));
+
+  const auto descending = sort(join, {{ColumnID{3}, OrderByMode::Descending}, {ColumnID{2}}});
+  expect_null_positions(*descending, {0, 1, 2});
+  EXPECT_EQ(values<double>(*descending, ColumnID{2}), (std::vector<double>{-1.0, 0.0, 1.5, -2.0, 2.5, 3.0, -0.5}));
+}
+
+TEST_F(OperatorsSortTest, LargeInput) {
+  // enough rows for several threads and runs, with dictionary-encoded and unencoded chunks
+  std::mt19937 generator{7};
+  std::uniform_int_distribution<int64_t> long_distribution{-1'000'000'000'000, 1'000'000'000'000};
+  std::uniform_int_distribution<int> int_distribution{-20, 20};
+
+  auto table = std::make_shared<Table>(15000);
+  table->add_column("a", "int");
+  table->add_column("b", "long");
+  table->add_column("c", "string");
+  std::vector<std::tuple<int, int64_t, std::string>> rows;
+  for (auto row = 0; row < 100000; ++row) {
+    const auto a = int_distribution(generator);
+    const auto b = long_distribution(generator) / (row % 2 ? 1 : 1'000'000);
+    const auto c = "value_" + std::to_string(int_distribution(generator) + 100);
+    table->append({a, b, c});
+    rows.emplace_back(a, b, c);
+  }
+  table->compress_chunk(ChunkID{1});
+  table->compress_chunk(ChunkID{4});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // a radix sort of int keys
+  auto output = sort(table_wrapper, {{ColumnID{0}, OrderByMode::Descending}});
+  auto expected_a = std::vector<int>{};
+  for (const auto& row : rows) expected_a.push_back(std::get<0>(row));
+  std::sort(expected_a.begin(), expected_a.end(), std::greater<int>{});
+  EXPECT_EQ(values<int>(*output, ColumnID{0}), expected_a);
+
+  // string prefixes and ValueIDs in dictionary chunks
+  output = sort(table_wrapper, {{ColumnID{2}}, {ColumnID{1}, OrderByMode::Descending}});
+  std::sort(rows.begin(), rows.end(), [](const auto& left, const auto& right) {
+    return std::get<2>(left) != std::get<2>(right) ? std::get<2>(left) < std::get<2>(right)
+                                                   : std::get<1>(left) > std::get<1>(right);
+  });
+  auto expected_b = std::vector<int64_t>{};
+  auto expected_c = std::vector<std::string>{};
+  for (const auto& row : rows) {
+    expected_b.push_back(std::get<1>(row));
+    expected_c.push_back(std::get<2>(row));
+  }
+  EXPECT_EQ(values<int64_t>(*output, ColumnID{1}), expected_b);
+  EXPECT_EQ(values<std::string>(*output, ColumnID{2}), expected_c);
+}
+
+TEST_F(OperatorsSortTest, EmptyInput) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  EXPECT_EQ(sort(table_wrapper, {{ColumnID{0}}})->row_count(), 0u);
+}
+
+TEST_F(OperatorsSortTest, InvalidColumns) {
+  EXPECT_THROW(sort(_table_wrapper, {}), std::exception);
+  EXPECT_THROW(sort(_table_wrapper, {{ColumnID{3}}}), std::exception);
+}
+
+}  // namespace opossum
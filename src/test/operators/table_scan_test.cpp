@@ -13,258 +13,610 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/adaptive_radix_tree_index.hpp"
+#include "storage/frame_of_reference_column.hpp"
+#include "storage/group_key_index.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/table.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
 
-// class OperatorsTableScanTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
-//     _table_wrapper->execute();
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
 
-//     std::shared_ptr<Table> test_even_dict = std::make_shared<Table>(5);
-//     test_even_dict->add_column("a", "int");
-//     test_even_dict->add_column("b", "int");
-//     for (int i = 0; i <= 24; i += 2) test_even_dict->append({i, 100 + i});
+    std::shared_ptr<Table> test_even_dict = std::make_shared<Table>(5);
+    test_even_dict->add_column("a", "int");
+    test_even_dict->add_column("b", "int");
+    for (int i = 0; i <= 24; i += 2) test_even_dict->append({i, 100 + i});
 
-//     test_even_dict->compress_chunk(ChunkID(0));
-//     test_even_dict->compress_chunk(ChunkID(1));
+    test_even_dict->compress_chunk(ChunkID(0));
+    test_even_dict->compress_chunk(ChunkID(1));
 
-//     _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(test_even_dict));
-//     _table_wrapper_even_dict->execute();
-//   }
+    _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(test_even_dict));
+    _table_wrapper_even_dict->execute();
+  }
 
-//   std::shared_ptr<TableWrapper> get_table_op_part_dict() {
-//     auto table = std::make_shared<Table>(5);
-//     table->add_column("a", "int");
-//     table->add_column("b", "float");
+  std::shared_ptr<TableWrapper> get_table_op_part_dict() {
+    auto table = std::make_shared<Table>(5);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
 
-//     for (int i = 1; i < 20; ++i) {
-//       table->append({i, 100.1 + i});
-//     }
+    for (int i = 1; i < 20; ++i) {
+      table->append({i, 100.1 + i});
+    }
 
-//     table->compress_chunk(ChunkID(0));
-//     table->compress_chunk(ChunkID(1));
+    table->compress_chunk(ChunkID(0));
+    table->compress_chunk(ChunkID(1));
 
-//     auto table_wrapper = std::make_shared<TableWrapper>(table);
-//     table_wrapper->execute();
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
 
-//     return table_wrapper;
-//   }
+    return table_wrapper;
+  }
 
-//   std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int num_entries) {
-//     // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
-//     auto table = std::make_shared<opossum::Table>(0);
-//     table->add_column("a", "int");
-//     table->add_column("b", "float");
+  std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int num_entries) {
+    // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
+    auto table = std::make_shared<opossum::Table>(num_entries + 1);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
 
-//     for (int i = 0; i <= num_entries; i++) {
-//       table->append({i, 100.0f + i});
-//     }
+    for (int i = 0; i <= num_entries; i++) {
+      table->append({i, 100.0f + i});
+    }
 
-//     table->compress_chunk(ChunkID(0));
-
-//     auto table_wrapper = std::make_shared<opossum::TableWrapper>(std::move(table));
-//     table_wrapper->execute();
-//     return table_wrapper;
-//   }
+    table->compress_chunk(ChunkID(0));
+
+    auto table_wrapper = std::make_shared<opossum::TableWrapper>(std::move(table));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
 
-//   void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
-//                         std::vector<AllTypeVariant> expected) {
-//     for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
-//       const auto& chunk = table->get_chunk(chunk_id);
+  void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
+                        std::vector<AllTypeVariant> expected) {
+    for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
 
-//       for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk.size(); ++chunk_offset) {
-//         const auto& column = *chunk.get_column(column_id);
+      for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk.size(); ++chunk_offset) {
+        const auto& column = *chunk.get_column(column_id);
 
-//         const auto found_value = column[chunk_offset];
-//         const auto comparator = [found_value](const AllTypeVariant expected_value) {
-//           // returns equivalency, not equality to simulate std::multiset.
-//           // multiset cannot be used because it triggers a compiler / lib bug when built in CI
-//           return !(found_value < expected_value) && !(expected_value < found_value);
-//         };
-
-//         auto search = std::find_if(expected.begin(), expected.end(), comparator);
-
-//         ASSERT_TRUE(search != expected.end());
-//         expected.erase(search);
-//       }
-//     }
-
-//     ASSERT_EQ(expected.size(), 0u);
-//   }
-
-//   std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
-// };
-
-// TEST_F(OperatorsTableScanTest, DoubleScan) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
-
-//   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
-//   scan_1->execute();
-
-//   auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
-//   scan_2->execute();
-
-//   EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, EmptyResultScan) {
-//   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
-//   scan_1->execute();
-
-//   for (auto i = ChunkID{0}; i < scan_1->get_output()->chunk_count(); i++)
-//     EXPECT_EQ(scan_1->get_output()->get_chunk(i).col_count(), 2u);
-// }
-
-// TEST_F(OperatorsTableScanTest, SingleScanReturnsCorrectRowCount) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
-
-//   auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
-//   scan->execute();
-
-//   EXPECT_TABLE_EQ(scan->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumn) {
-//   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {104};
-//   tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpLessThan] = {100, 102};
-//   tests[ScanType::OpLessThanEquals] = {100, 102, 104};
-//   tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 4);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
-//   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {104};
-//   tests[ScanType::OpNotEquals] = {100, 102, 106};
-//   tests[ScanType::OpLessThan] = {100, 102};
-//   tests[ScanType::OpLessThanEquals] = {100, 102, 104};
-//   tests[ScanType::OpGreaterThan] = {106};
-//   tests[ScanType::OpGreaterThanEquals] = {104, 106};
-//   for (const auto& test : tests) {
-//     auto scan1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{1}, ScanType::OpLessThan, 108);
-//     scan1->execute();
-
-//     auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{0}, test.first, 4);
-//     scan2->execute();
-
-//     ASSERT_COLUMN_EQ(scan2->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
-
-//   auto table_wrapper = get_table_op_part_dict();
-//   auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
-//   scan_1->execute();
-
-//   EXPECT_TABLE_EQ(scan_1->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueGreaterThanMaxDictionaryValue) {
-//   const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   const auto no_rows = std::vector<AllTypeVariant>{};
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = no_rows;
-//   tests[ScanType::OpNotEquals] = all_rows;
-//   tests[ScanType::OpLessThan] = all_rows;
-//   tests[ScanType::OpLessThanEquals] = all_rows;
-//   tests[ScanType::OpGreaterThan] = no_rows;
-//   tests[ScanType::OpGreaterThanEquals] = no_rows;
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 30);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueLessThanMinDictionaryValue) {
-//   const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   const auto no_rows = std::vector<AllTypeVariant>{};
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = no_rows;
-//   tests[ScanType::OpNotEquals] = all_rows;
-//   tests[ScanType::OpLessThan] = no_rows;
-//   tests[ScanType::OpLessThanEquals] = no_rows;
-//   tests[ScanType::OpGreaterThan] = all_rows;
-//   tests[ScanType::OpGreaterThanEquals] = all_rows;
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0} /* "a" */, test.first, -10);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
-//   // scanning for a value that is around the dictionary's bounds
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {100};
-//   tests[ScanType::OpLessThan] = {};
-//   tests[ScanType::OpLessThanEquals] = {100};
-//   tests[ScanType::OpGreaterThan] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpGreaterThanEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpNotEquals] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 0);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
-//   auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
-//   scan_1->execute();
-//   EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(0));
-
-//   // scan_1 produced an empty result
-//   auto scan_2 = std::make_shared<opossum::TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 456.7);
-//   scan_2->execute();
-
-//   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(0));
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnWideDictionaryColumn) {
-//   // 2**8 + 1 values require a data type of 16bit.
-//   const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
-//   auto scan_1 = std::make_shared<opossum::TableScan>(table_wrapper_dict_16, ColumnID{0}, ScanType::OpGreaterThan, 200);
-//   scan_1->execute();
-
-//   EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(57));
-
-//   // 2**16 + 1 values require a data type of 32bit.
-//   const auto table_wrapper_dict_32 = get_table_op_with_n_dict_entries((1 << 16) + 1);
-//   auto scan_2 =
-//       std::make_shared<opossum::TableScan>(table_wrapper_dict_32, ColumnID{0}, ScanType::OpGreaterThan, 65500);
-//   scan_2->execute();
-
-//   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
-// }
+        const auto found_value = column[chunk_offset];
+        const auto comparator = [found_value](const AllTypeVariant expected_value) {
+          // returns equivalency, not equality to simulate std::multiset.
+          // multiset cannot be used because it triggers a compiler / lib bug when built in CI
+          return !(found_value < expected_value) && !(expected_value < found_value);
+        };
+
+        auto search = std::find_if(expected.begin(), expected.end(), comparator);
+
+        ASSERT_TRUE(search != expected.end());
+        expected.erase(search);
+      }
+    }
+
+    ASSERT_EQ(expected.size(), 0u);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
+};
+
+TEST_F(OperatorsTableScanTest, DoubleScan) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
+
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan_1->execute();
+
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
+  scan_2->execute();
+
+  EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, EmptyResultScan) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
+  scan_1->execute();
+
+  for (auto i = ChunkID{0}; i < scan_1->get_output()->chunk_count(); i++)
+    EXPECT_EQ(scan_1->get_output()->get_chunk(i).col_count(), 2u);
+}
+
+TEST_F(OperatorsTableScanTest, SingleScanReturnsCorrectRowCount) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan->execute();
+
+  EXPECT_TABLE_EQ(scan->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumn) {
+  // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 4);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
+  // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106};
+  for (const auto& test : tests) {
+    auto scan1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{1}, ScanType::OpLessThan, 108);
+    scan1->execute();
+
+    auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{0}, test.first, 4);
+    scan2->execute();
+
+    ASSERT_COLUMN_EQ(scan2->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
+
+  auto table_wrapper = get_table_op_part_dict();
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+  scan_1->execute();
+
+  EXPECT_TABLE_EQ(scan_1->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueGreaterThanMaxDictionaryValue) {
+  const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  const auto no_rows = std::vector<AllTypeVariant>{};
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = no_rows;
+  tests[ScanType::OpNotEquals] = all_rows;
+  tests[ScanType::OpLessThan] = all_rows;
+  tests[ScanType::OpLessThanEquals] = all_rows;
+  tests[ScanType::OpGreaterThan] = no_rows;
+  tests[ScanType::OpGreaterThanEquals] = no_rows;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 30);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueLessThanMinDictionaryValue) {
+  const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  const auto no_rows = std::vector<AllTypeVariant>{};
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = no_rows;
+  tests[ScanType::OpNotEquals] = all_rows;
+  tests[ScanType::OpLessThan] = no_rows;
+  tests[ScanType::OpLessThanEquals] = no_rows;
+  tests[ScanType::OpGreaterThan] = all_rows;
+  tests[ScanType::OpGreaterThanEquals] = all_rows;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0} /* "a" */, test.first, -10);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
+  // scanning for a value that is around the dictionary's bounds
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {100};
+  tests[ScanType::OpLessThan] = {};
+  tests[ScanType::OpLessThanEquals] = {100};
+  tests[ScanType::OpGreaterThan] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpNotEquals] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 0);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
+  auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
+  scan_1->execute();
+  EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(0));
+
+  // scan_1 produced an empty result
+  auto scan_2 = std::make_shared<opossum::TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 456.7);
+  scan_2->execute();
+
+  EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(0));
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnRunLengthColumn) {
+  auto table = std::make_shared<Table>(8);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (auto i = 0; i < 16; ++i) table->append({i / 3, i});
+  table->compress_chunk(ChunkID{0}, EncodingType::RunLength);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {6, 7, 8};
+  tests[ScanType::OpNotEquals] = {0, 1, 2, 3, 4, 5, 9, 10, 11, 12, 13, 14, 15};
+  tests[ScanType::OpLessThan] = {0, 1, 2, 3, 4, 5};
+  tests[ScanType::OpLessThanEquals] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+  tests[ScanType::OpGreaterThan] = {9, 10, 11, 12, 13, 14, 15};
+  tests[ScanType::OpGreaterThanEquals] = {6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 2);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+
+    // the same predicate on a reference to the run-length encoded column
+    auto scan_all = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpNotEquals, 4);
+    scan_all->execute();
+    auto scan_referenced = std::make_shared<TableScan>(scan_all, ColumnID{0}, test.first, 2);
+    scan_referenced->execute();
+
+    auto expected = test.second;
+    expected.erase(std::remove(expected.begin(), expected.end(), AllTypeVariant{4}), expected.end());
+    ASSERT_COLUMN_EQ(scan_referenced->get_output(), ColumnID{1}, expected);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnFrameOfReferenceColumn) {
+  // two full blocks with different frames and one partial block
+  const auto chunk_size = 2 * FrameOfReferenceColumn<int>::BLOCK_SIZE + 100;
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (auto i = 0; i < static_cast<int>(chunk_size); ++i) {
+    const auto block = i / static_cast<int>(FrameOfReferenceColumn<int>::BLOCK_SIZE);
+    table->append({block == 1 ? 1000 + i % 50 : i % 1200, i});
+  }
+  table->compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan_all = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpNotEquals, 4);
+  scan_all->execute();
+
+  // ASSERT_COLUMN_EQ is quadratic, which is too slow for chunks of this size
+  const auto matching_rows = [](const std::shared_ptr<const Table>& output) {
+    std::vector<int> rows;
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto& column = *output->get_chunk(chunk_id).get_column(ColumnID{1});
+      for (ChunkOffset chunk_offset = 0; chunk_offset < column.size(); ++chunk_offset) {
+        rows.push_back(type_cast<int>(column[chunk_offset]));
+      }
+    }
+    return rows;
+  };
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    for (const auto search_value : {-5, 0, 17, 1000, 1025, 1049, 1100, 5000}) {
+      std::vector<int> expected;
+      std::vector<int> expected_referenced;
+      for (auto i = 0; i < static_cast<int>(chunk_size); ++i) {
+        const auto block = i / static_cast<int>(FrameOfReferenceColumn<int>::BLOCK_SIZE);
+        const auto value = block == 1 ? 1000 + i % 50 : i % 1200;
+        const auto matches = std::map<ScanType, bool>{{ScanType::OpEquals, value == search_value},
+                                                      {ScanType::OpNotEquals, value != search_value},
+                                                      {ScanType::OpLessThan, value < search_value},
+                                                      {ScanType::OpLessThanEquals, value <= search_value},
+                                                      {ScanType::OpGreaterThan, value > search_value},
+                                                      {ScanType::OpGreaterThanEquals, value >= search_value}};
+        if (!matches.at(scan_type)) continue;
+        expected.emplace_back(i);
+        if (i != 4) expected_referenced.emplace_back(i);
+      }
+
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+      scan->execute();
+      EXPECT_EQ(matching_rows(scan->get_output()), expected);
+
+      auto scan_referenced = std::make_shared<TableScan>(scan_all, ColumnID{0}, scan_type, search_value);
+      scan_referenced->execute();
+      EXPECT_EQ(matching_rows(scan_referenced->get_output()), expected_referenced);
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnStringColumns) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "string");
+  table->append({"Alpha"});
+  table->append({"Gamma"});
+  table->append({"Beta"});
+  table->append({"Delta"});
+  table->compress_chunk(ChunkID{0});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, "Beta");
+  scan_1->execute();
+  ASSERT_COLUMN_EQ(scan_1->get_output(), ColumnID{0}, {"Gamma", "Beta", "Delta"});
+
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpNotEquals, "Delta");
+  scan_2->execute();
+  ASSERT_COLUMN_EQ(scan_2->get_output(), ColumnID{0}, {"Gamma", "Beta"});
+}
+
+TEST_F(OperatorsTableScanTest, OutputReferencesOriginalTable) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan_1->execute();
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 120);
+  scan_2->execute();
+
+  const auto& chunk = scan_2->get_output()->get_chunk(ChunkID{0});
+  const auto column_a = std::dynamic_pointer_cast<ReferenceColumn>(chunk.get_column(ColumnID{0}));
+  const auto column_b = std::dynamic_pointer_cast<ReferenceColumn>(chunk.get_column(ColumnID{1}));
+  ASSERT_NE(column_a, nullptr);
+  ASSERT_NE(column_b, nullptr);
+  EXPECT_EQ(column_a->referenced_table(), _table_wrapper_even_dict->get_output());
+  EXPECT_EQ(column_a->pos_list(), column_b->pos_list());
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnWideDictionaryColumn) {
+  // 2**8 + 1 values require a data type of 16bit.
+  const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
+  auto scan_1 = std::make_shared<opossum::TableScan>(table_wrapper_dict_16, ColumnID{0}, ScanType::OpGreaterThan, 200);
+  scan_1->execute();
+
+  EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(57));
+
+  // 2**16 + 1 values require a data type of 32bit.
+  const auto table_wrapper_dict_32 = get_table_op_with_n_dict_entries((1 << 16) + 1);
+  auto scan_2 =
+      std::make_shared<opossum::TableScan>(table_wrapper_dict_32, ColumnID{0}, ScanType::OpGreaterThan, 65500);
+  scan_2->execute();
+
+  EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
+}
+
+TEST_F(OperatorsTableScanTest, PruneChunksWithZoneMaps) {
+  // a time-ordered table: every chunk covers a distinct range of timestamps
+  auto table = std::make_shared<Table>(10);
+  table->add_column("timestamp", "int");
+  table->add_column("value", "string");
+  for (auto i = 0; i < 100; ++i) table->append({1000 + i, "v" + std::to_string(i % 7)});
+  for (ChunkID chunk_id{0}; chunk_id < 5; ++chunk_id) table->compress_chunk(chunk_id);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan_range = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1085);
+  scan_range->execute();
+  EXPECT_EQ(scan_range->pruned_chunk_count(), 8u);
+  ASSERT_COLUMN_EQ(scan_range->get_output(), ColumnID{0},
+                   {1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099});
+
+  auto scan_equals = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 1042);
+  scan_equals->execute();
+  EXPECT_EQ(scan_equals->pruned_chunk_count(), 9u);
+  ASSERT_COLUMN_EQ(scan_equals->get_output(), ColumnID{0}, {1042});
+
+  auto scan_none = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 1000);
+  scan_none->execute();
+  EXPECT_EQ(scan_none->pruned_chunk_count(), 10u);
+  EXPECT_EQ(scan_none->get_output()->row_count(), 0u);
+  EXPECT_EQ(scan_none->get_output()->col_count(), 2u);
+
+  // the values of the string column are spread over all chunks
+  auto scan_string = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpEquals, "v3");
+  scan_string->execute();
+  EXPECT_EQ(scan_string->pruned_chunk_count(), 0u);
+  EXPECT_EQ(scan_string->get_output()->row_count(), 14u);
+
+  // ReferenceColumns skip the positions that point into pruned chunks of the referenced table
+  auto scan_referenced = std::make_shared<TableScan>(scan_string, ColumnID{0}, ScanType::OpLessThanEquals, 1010);
+  scan_referenced->execute();
+  ASSERT_COLUMN_EQ(scan_referenced->get_output(), ColumnID{0}, {1003, 1010});
+}
+
+TEST_F(OperatorsTableScanTest, PruneChunksWithBloomFilters) {
+  // the keys of each chunk cover the full key range, so only the Bloom filters can tell the chunks apart
+  auto table = std::make_shared<Table>(100);
+  table->add_column("key", "int");
+  table->add_column("name", "string");
+  table->enable_bloom_filter(ColumnID{0}, 0.001);
+  table->enable_bloom_filter(ColumnID{1}, 0.001);
+  for (auto i = 0; i < 1000; ++i) {
+    const auto key = (i % 100) * 10 + i / 100;
+    table->append({key, "name " + std::to_string(key)});
+  }
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan_key = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 427);
+  scan_key->execute();
+  EXPECT_EQ(scan_key->pruned_chunk_count(), 0u);
+  EXPECT_GE(scan_key->bloom_filter_pruned_chunk_count(), 8u);
+  ASSERT_COLUMN_EQ(scan_key->get_output(), ColumnID{1}, {"name 427"});
+
+  auto scan_name = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpEquals, "name 538");
+  scan_name->execute();
+  EXPECT_EQ(scan_name->pruned_chunk_count(), 0u);
+  EXPECT_GE(scan_name->bloom_filter_pruned_chunk_count(), 8u);
+  ASSERT_COLUMN_EQ(scan_name->get_output(), ColumnID{0}, {538});
+
+  // Bloom filters cannot answer other predicates
+  auto scan_range = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  scan_range->execute();
+  EXPECT_EQ(scan_range->bloom_filter_pruned_chunk_count(), 0u);
+  EXPECT_EQ(scan_range->get_output()->row_count(), 5u);
+
+  auto scan_referenced = std::make_shared<TableScan>(scan_range, ColumnID{1}, ScanType::OpEquals, "name 3");
+  scan_referenced->execute();
+  ASSERT_COLUMN_EQ(scan_referenced->get_output(), ColumnID{0}, {3});
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithGroupKeyIndex) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto i = 0; i < 300; ++i) table->append({i % 50, "value " + std::to_string(i)});
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1});
+  table->get_chunk(ChunkID{0}).create_index<GroupKeyIndex>({ColumnID{0}});
+  table->get_chunk(ChunkID{1}).create_index<GroupKeyIndex>({ColumnID{0}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // the third chunk has no index and is scanned as usual
+  auto scan_equals = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 17);
+  scan_equals->execute();
+  EXPECT_EQ(scan_equals->index_scanned_chunk_count(), 2u);
+  ASSERT_COLUMN_EQ(scan_equals->get_output(), ColumnID{1},
+                   {"value 17", "value 67", "value 117", "value 167", "value 217", "value 267"});
+
+  // the output keeps the order of the rows
+  const auto& pos_list = *std::dynamic_pointer_cast<const ReferenceColumn>(
+                              scan_equals->get_output()->get_chunk(ChunkID{0}).get_column(ColumnID{0}))
+                              ->pos_list();
+  EXPECT_EQ(pos_list, (PosList{RowID{ChunkID{0}, 17}, RowID{ChunkID{0}, 67}}));
+
+  auto scan_less = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 2);
+  scan_less->execute();
+  EXPECT_EQ(scan_less->index_scanned_chunk_count(), 2u);
+  EXPECT_EQ(scan_less->get_output()->row_count(), 12u);
+
+  // predicates that match many rows are not answered by the index
+  auto scan_greater = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  scan_greater->execute();
+  EXPECT_EQ(scan_greater->index_scanned_chunk_count(), 0u);
+  EXPECT_EQ(scan_greater->get_output()->row_count(), 288u);
+
+  auto scan_not_equals = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 2);
+  scan_not_equals->execute();
+  EXPECT_EQ(scan_not_equals->index_scanned_chunk_count(), 0u);
+  EXPECT_EQ(scan_not_equals->get_output()->row_count(), 294u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithAdaptiveRadixTreeIndex) {
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  table->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+  for (auto i = 0; i < 2500; ++i) table->append({i, "v" + std::to_string(i % 10)});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // the index of the last chunk covers all rows appended so far
+  auto scan_equals = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 2042);
+  scan_equals->execute();
+  EXPECT_EQ(scan_equals->index_scanned_chunk_count(), 1u);
+  ASSERT_COLUMN_EQ(scan_equals->get_output(), ColumnID{1}, {"v2"});
+
+  // the index keeps working once a chunk is compressed
+  table->compress_chunk(ChunkID{0});
+  auto scan_less = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 3);
+  scan_less->execute();
+  EXPECT_EQ(scan_less->index_scanned_chunk_count(), 1u);
+  ASSERT_COLUMN_EQ(scan_less->get_output(), ColumnID{0}, {0, 1, 2});
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithMultiplePredicates) {
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", "int");
+  table->add_column("b", "long");
+  table->add_column("c", "string");
+  table->add_column("d", "float");
+  for (auto i = 0; i < 6000; ++i) {
+    table->append({i % 97, int64_t{i / 7}, "x" + std::to_string(i % 5), static_cast<float>(i % 13)});
+  }
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+  table->compress_chunk(ChunkID{4});
+  table->get_chunk(ChunkID{4}).create_index<GroupKeyIndex>({ColumnID{1}});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto predicates = std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThanEquals, 10},
+                                                     {ColumnID{2}, ScanType::OpNotEquals, "x3"},
+                                                     {ColumnID{1}, ScanType::OpLessThan, int64_t{600}},
+                                                     {ColumnID{3}, ScanType::OpLessThanEquals, 9.0f}};
+
+  // the same rows as a chain of scans, on the table and on a reference table
+  const auto chain_scans = [&](std::shared_ptr<const AbstractOperator> input) {
+    for (const auto& predicate : predicates) {
+      auto scan = std::make_shared<TableScan>(input, predicate.column_id, predicate.scan_type, predicate.search_value);
+      scan->execute();
+      input = scan;
+    }
+    return input->get_output();
+  };
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, predicates);
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), chain_scans(table_wrapper));
+  EXPECT_EQ(scan->column_id(), ColumnID{0});
+  EXPECT_EQ(scan->predicates().size(), 4u);
+
+  // all chunks after the fourth one are pruned by the predicate on b
+  EXPECT_EQ(scan->pruned_chunk_count(), 1u);
+
+  auto first_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{3}, ScanType::OpGreaterThan, 2.0f);
+  first_scan->execute();
+  auto referenced_scan = std::make_shared<TableScan>(first_scan, predicates);
+  referenced_scan->execute();
+  EXPECT_TABLE_EQ(referenced_scan->get_output(), chain_scans(first_scan));
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithMultiplePredicatesReordersThem) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (auto i = 0; i < 1000; ++i) table->append({i, i % 50});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // the first predicate matches all rows, the last one matches the fewest
+  auto scan = std::make_shared<TableScan>(
+      table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThanEquals, 0},
+                                                {ColumnID{1}, ScanType::OpLessThan, 25},
+                                                {ColumnID{1}, ScanType::OpEquals, 7}});
+  scan->execute();
+  EXPECT_EQ(scan->predicate_order(), (std::vector<size_t>{2, 1, 0}));
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, std::vector<AllTypeVariant>(20, 7));
+
+  EXPECT_THROW(std::make_shared<TableScan>(table_wrapper, std::vector<ScanPredicate>{}), std::exception);
+  auto invalid_scan = std::make_shared<TableScan>(
+      table_wrapper,
+      std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpEquals, 0}, {ColumnID{2}, ScanType::OpEquals, 0}});
+  EXPECT_THROW(invalid_scan->execute(), std::exception);
+}
 
 }  // namespace opossum
@@ -0,0 +1,140 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // the chunks have overlapping ranges of a, so that some can be skipped by their zone maps and others not
+    std::mt19937 generator{11};
+    auto table = std::make_shared<Table>(5000);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "float");
+    for (auto row = 0; row < 60000; ++row) {
+      const auto a = std::uniform_int_distribution<int>{0, 2000}(generator) + (row / 5000) * 300;
+      const auto b = "b" + std::to_string(std::uniform_int_distribution<int>{0, 30}(generator));
+      table->append({a, b, static_cast<float>(row % 7)});
+    }
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id += 3) table->compress_chunk(chunk_id);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const Table> top_k(const std::shared_ptr<const AbstractOperator>& in,
+                                     const std::vector<SortColumnDefinition>& sort_definitions, const size_t k) {
+    auto top_k = std::make_shared<TopK>(in, sort_definitions, k);
+    top_k->execute();
+    return top_k->get_output();
+  }
+
+  // TopK must return exactly the rows of a Sort followed by a Limit, in the same order
+  void expect_same_as_sort(const std::shared_ptr<const AbstractOperator>& in,
+                           const std::vector<SortColumnDefinition>& sort_definitions, const size_t k) {
+    auto sort = std::make_shared<Sort>(in, sort_definitions);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, k);
+    limit->execute();
+
+    const auto expected = limit->get_output();
+    const auto actual = top_k(in, sort_definitions, k);
+    ASSERT_EQ(actual->row_count(), expected->row_count());
+    for (ColumnID column_id{0}; column_id < actual->col_count(); ++column_id) {
+      const auto& actual_column = *actual->get_chunk(ChunkID{0}).get_column(column_id);
+      const auto& expected_column = *expected->get_chunk(ChunkID{0}).get_column(column_id);
+      for (ChunkOffset chunk_offset = 0; chunk_offset < actual_column.size(); ++chunk_offset) {
+        EXPECT_EQ(actual_column[chunk_offset], expected_column[chunk_offset]);
+      }
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, SingleColumn) {
+  const auto output = top_k(_table_wrapper, {{ColumnID{0}, OrderByMode::Descending}}, 5);
+  ASSERT_EQ(output->row_count(), 5u);
+  const auto& column = *output->get_chunk(ChunkID{0}).get_column(ColumnID{0});
+  for (ChunkOffset chunk_offset = 1; chunk_offset < 5; ++chunk_offset) {
+    EXPECT_GE(type_cast<int>(column[chunk_offset - 1]), type_cast<int>(column[chunk_offset]));
+  }
+
+  for (const auto mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    for (const auto k : {1, 100, 3000}) {
+      expect_same_as_sort(_table_wrapper, {{ColumnID{0}, mode}}, k);
+      expect_same_as_sort(_table_wrapper, {{ColumnID{1}, mode}}, k);
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, MultipleColumns) {
+  // many rows share the first value, so the other columns decide
+  expect_same_as_sort(_table_wrapper, {{ColumnID{1}}, {ColumnID{2}, OrderByMode::Descending}}, 500);
+  expect_same_as_sort(_table_wrapper, {{ColumnID{2}, OrderByMode::Descending}, {ColumnID{0}}, {ColumnID{1}}}, 100);
+}
+
+TEST_F(OperatorsTopKTest, NullRows) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("d", "int");
+  right_table->add_column("e", "float");
+  for (auto value = 0; value < 3000; value += 2) right_table->append({value, static_cast<float>(value % 5)});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  for (const auto mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    expect_same_as_sort(join, {{ColumnID{3}, mode}, {ColumnID{0}}}, 50);
+    expect_same_as_sort(join, {{ColumnID{0}, mode}, {ColumnID{4}, mode}}, 50);
+  }
+}
+
+TEST_F(OperatorsTopKTest, KLargerThanInput) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "long");
+  for (const auto value : {3, 1, 2}) table->append({int64_t{value}});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  EXPECT_EQ(top_k(table_wrapper, {{ColumnID{0}}}, 0)->row_count(), 0u);
+  EXPECT_TABLE_EQ(top_k(table_wrapper, {{ColumnID{0}}}, 10), table);
+  expect_same_as_sort(table_wrapper, {{ColumnID{0}, OrderByMode::Descending}}, 10);
+}
+
+TEST_F(OperatorsTopKTest, TableWithoutColumns) {
+  // a table with only column definitions holds a single chunk without columns
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("a", "int");
+  table->add_column_definition("b", "string");
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto output = top_k(table_wrapper, {{ColumnID{1}, OrderByMode::Descending}, {ColumnID{0}}}, 5);
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->col_count(), 2u);
+  EXPECT_EQ(output->column_name(ColumnID{1}), "b");
+}
+
+TEST_F(OperatorsTopKTest, InvalidColumns) {
+  EXPECT_THROW(top_k(_table_wrapper, {}, 1), std::exception);
+  EXPECT_THROW(top_k(_table_wrapper, {{ColumnID{3}}}, 1), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsUnionPositionsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto value = 0; value < 10; ++value) _table->append({value, std::to_string(value % 3)});
+    _table->compress_chunk(ChunkID{1});
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const AbstractOperator> scan(const std::shared_ptr<const AbstractOperator>& in,
+                                               const ColumnID column_id, const ScanType scan_type,
+                                               const AllTypeVariant& value) {
+    auto scan = std::make_shared<TableScan>(in, column_id, scan_type, value);
+    scan->execute();
+    return scan;
+  }
+
+  std::shared_ptr<const Table> union_positions(const std::shared_ptr<const AbstractOperator>& left,
+                                               const std::shared_ptr<const AbstractOperator>& right) {
+    auto union_positions = std::make_shared<UnionPositions>(left, right);
+    union_positions->execute();
+    return union_positions->get_output();
+  }
+
+  std::shared_ptr<Table> expected_table(const std::vector<int>& values) {
+    auto table = std::make_shared<Table>();
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (const auto value : values) table->append({value, std::to_string(value % 3)});
+    return table;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsUnionPositionsTest, DisjunctionOfScans) {
+  const auto output = union_positions(scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 2),
+                                      scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 6));
+  EXPECT_TABLE_EQ(output, expected_table({0, 1, 7, 8, 9}));
+
+  // one chunk per referenced chunk, with sorted positions that are shared by all columns
+  ASSERT_EQ(output->chunk_count(), 3u);
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    const auto& column = dynamic_cast<const ReferenceColumn&>(*chunk.get_column(ColumnID{0}));
+    EXPECT_EQ(column.referenced_table(), _table);
+    EXPECT_EQ(column.pos_list(), dynamic_cast<const ReferenceColumn&>(*chunk.get_column(ColumnID{1})).pos_list());
+    EXPECT_TRUE(std::is_sorted(column.pos_list()->cbegin(), column.pos_list()->cend()));
+  }
+}
+
+TEST_F(OperatorsUnionPositionsTest, OverlappingInputs) {
+  // rows in both inputs are output once
+  const auto output = union_positions(scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 6),
+                                      scan(_table_wrapper, ColumnID{1}, ScanType::OpEquals, "0"));
+  EXPECT_TABLE_EQ(output, expected_table({0, 1, 2, 3, 4, 5, 6, 9}));
+
+  const auto same_input = scan(_table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 4);
+  EXPECT_TABLE_EQ(union_positions(same_input, same_input), expected_table({0, 1, 2, 3, 5, 6, 7, 8, 9}));
+}
+
+TEST_F(OperatorsUnionPositionsTest, UnsortedAndEmptyInputs) {
+  // the positions of a Sort are not sorted, so the chunks are combined as bitmaps
+  auto sort = std::make_shared<Sort>(scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 5),
+                                     std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Descending}});
+  sort->execute();
+  const auto empty = scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  EXPECT_TABLE_EQ(union_positions(sort, scan(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 1)),
+                  expected_table({1, 6, 7, 8, 9}));
+  EXPECT_TABLE_EQ(union_positions(empty, sort), expected_table({6, 7, 8, 9}));
+
+  const auto output = union_positions(empty, empty);
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->col_count(), 2u);
+}
+
+TEST_F(OperatorsUnionPositionsTest, InputsWithoutColumns) {
+  // a table with only column definitions holds a single chunk without columns and references nothing
+  auto definitions = std::make_shared<Table>();
+  definitions->add_column_definition("a", "int");
+  definitions->add_column_definition("b", "string");
+  auto definitions_wrapper = std::make_shared<TableWrapper>(definitions);
+  definitions_wrapper->execute();
+
+  const auto output = union_positions(definitions_wrapper, definitions_wrapper);
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->col_count(), 2u);
+  EXPECT_EQ(output->column_name(ColumnID{1}), "b");
+
+  const auto left = scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 2);
+  EXPECT_TABLE_EQ(union_positions(definitions_wrapper, left), expected_table({0, 1}));
+  EXPECT_TABLE_EQ(union_positions(left, definitions_wrapper), expected_table({0, 1}));
+}
+
+TEST_F(OperatorsUnionPositionsTest, InvalidInputs) {
+  auto other_table = std::make_shared<Table>();
+  other_table->add_column("a", "int");
+  other_table->add_column("b", "string");
+  other_table->append({1, "1"});
+  auto other_wrapper = std::make_shared<TableWrapper>(other_table);
+  other_wrapper->execute();
+
+  const auto left = scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 2);
+  EXPECT_THROW(union_positions(left, _table_wrapper), std::exception);
+  EXPECT_THROW(union_positions(left, scan(other_wrapper, ColumnID{0}, ScanType::OpLessThan, 2)), std::exception);
+}
+
+}  // namespace opossum
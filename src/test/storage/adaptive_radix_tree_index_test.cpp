@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/adaptive_radix_tree_index.hpp"
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/frame_of_reference_column.hpp"
+#include "../lib/storage/run_length_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  template <typename T>
+  std::shared_ptr<ValueColumn<T>> make_column(const std::vector<T>& values) {
+    auto column = std::make_shared<ValueColumn<T>>();
+    for (const auto& value : values) column->append(value);
+    return column;
+  }
+
+  std::vector<ChunkOffset> positions(const std::pair<BaseIndex::Iterator, BaseIndex::Iterator>& range) {
+    return {range.first, range.second};
+  }
+
+  std::vector<ChunkOffset> positions(const BaseIndex& index, const AllTypeVariant& begin, const AllTypeVariant& end) {
+    return {index.lower_bound({begin}), index.upper_bound({end})};
+  }
+};
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, IntKeys) {
+  const auto column = make_column<int>({5, -3, 1000000, 5, 0, -1000000, 7});
+  const auto index = AdaptiveRadixTreeIndex{{column}};
+
+  // -1000000, -3, 0, 5, 5, 7, 1000000
+  EXPECT_EQ((std::vector<ChunkOffset>{index.cbegin(), index.cend()}), (std::vector<ChunkOffset>{5, 1, 4, 0, 3, 6, 2}));
+  EXPECT_EQ(positions(index.equal_range({5})), (std::vector<ChunkOffset>{0, 3}));
+  EXPECT_TRUE(positions(index.equal_range({6})).empty());
+  EXPECT_EQ(positions(index, -3, 5), (std::vector<ChunkOffset>{1, 4, 0, 3}));
+  EXPECT_EQ(positions(index, -2, 6), (std::vector<ChunkOffset>{4, 0, 3}));
+  EXPECT_EQ(index.lower_bound({2000000}), index.cend());
+  EXPECT_TRUE(index.is_index_for({column}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, FloatingPointKeys) {
+  const auto float_column = make_column<float>({1.5f, -2.25f, 0.0f, -0.0f, -100.0f, 3.0f});
+  const auto float_index = AdaptiveRadixTreeIndex{{float_column}};
+  EXPECT_EQ((std::vector<ChunkOffset>{float_index.cbegin(), float_index.cend()}),
+            (std::vector<ChunkOffset>{4, 1, 2, 3, 0, 5}));
+  EXPECT_EQ(positions(float_index.equal_range({0.0f})), (std::vector<ChunkOffset>{2, 3}));
+  EXPECT_EQ(positions(float_index, -3.0f, 1.5f), (std::vector<ChunkOffset>{1, 2, 3, 0}));
+
+  const auto double_column = make_column<double>({-1e100, 2.5, -0.5, 1e-100});
+  const auto double_index = AdaptiveRadixTreeIndex{{double_column}};
+  EXPECT_EQ((std::vector<ChunkOffset>{double_index.cbegin(), double_index.cend()}),
+            (std::vector<ChunkOffset>{0, 2, 3, 1}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, StringKeys) {
+  const auto column = make_column<std::string>({"abc", "ab", "", "abcd", "b", std::string{"ab\0c", 4}, "ab"});
+  const auto index = AdaptiveRadixTreeIndex{{column}};
+
+  // "", "ab", "ab\0c", "abc", "abcd", "b"
+  EXPECT_EQ((std::vector<ChunkOffset>{index.cbegin(), index.cend()}), (std::vector<ChunkOffset>{2, 1, 6, 5, 0, 3, 4}));
+  EXPECT_EQ(positions(index.equal_range({"ab"})), (std::vector<ChunkOffset>{1, 6}));
+  EXPECT_EQ(positions(index.equal_range({""})), (std::vector<ChunkOffset>{2}));
+  EXPECT_TRUE(positions(index.equal_range({"a"})).empty());
+  EXPECT_EQ(positions(index, "ab", "abc"), (std::vector<ChunkOffset>{1, 6, 5, 0}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, ManyKeys) {
+  // enough distinct keys for nodes of all sizes
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<int> distribution{-5000, 5000};
+  std::vector<int> values(10000);
+  for (auto& value : values) value = distribution(generator);
+
+  const auto column = make_column<int>(values);
+  const auto index = AdaptiveRadixTreeIndex{{column}};
+
+  std::multimap<int, ChunkOffset> reference;
+  for (ChunkOffset chunk_offset = 0; chunk_offset < values.size(); ++chunk_offset) {
+    reference.emplace(values[chunk_offset], chunk_offset);
+  }
+
+  std::vector<ChunkOffset> expected;
+  for (const auto& entry : reference) expected.push_back(entry.second);
+  EXPECT_EQ((std::vector<ChunkOffset>{index.cbegin(), index.cend()}), expected);
+
+  for (const auto search_value : {-5001, -5000, -17, 0, 1, 4999, 5000}) {
+    const auto [begin, end] = reference.equal_range(search_value);
+    std::vector<ChunkOffset> expected_matches;
+    for (auto it = begin; it != end; ++it) expected_matches.push_back(it->second);
+    EXPECT_EQ(positions(index.equal_range({search_value})), expected_matches);
+
+    EXPECT_EQ(index.lower_bound({search_value}) - index.cbegin(), std::distance(reference.begin(), begin));
+    EXPECT_EQ(index.upper_bound({search_value}) - index.cbegin(), std::distance(reference.begin(), end));
+  }
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, CompositeKeys) {
+  const auto int_column = make_column<int>({2, 1, 2, 1, 2});
+  const auto string_column = make_column<std::string>({"b", "z", "a", "z", "b"});
+  const auto dictionary_column = std::make_shared<DictionaryColumn<std::string>>(string_column);
+  const auto index = AdaptiveRadixTreeIndex{{int_column, dictionary_column}};
+
+  // (1, "z"), (1, "z"), (2, "a"), (2, "b"), (2, "b")
+  EXPECT_EQ((std::vector<ChunkOffset>{index.cbegin(), index.cend()}), (std::vector<ChunkOffset>{1, 3, 2, 0, 4}));
+  EXPECT_EQ(positions(index.equal_range({2, "b"})), (std::vector<ChunkOffset>{0, 4}));
+  EXPECT_TRUE(positions(index.equal_range({1, "a"})).empty());
+
+  // searching for a prefix of the columns
+  EXPECT_EQ(positions(index.equal_range({2})), (std::vector<ChunkOffset>{2, 0, 4}));
+  EXPECT_EQ(index.upper_bound({1}) - index.cbegin(), 2);
+  EXPECT_EQ((std::vector<ChunkOffset>{index.lower_bound({2, "aa"}), index.cend()}), (std::vector<ChunkOffset>{0, 4}));
+
+  EXPECT_TRUE(index.is_index_for({int_column, dictionary_column}));
+  EXPECT_FALSE(index.is_index_for({dictionary_column, int_column}));
+  EXPECT_THROW(index.lower_bound({2, "b", 3}), std::exception);
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, EncodedColumns) {
+  const auto run_length_column =
+      std::make_shared<RunLengthColumn<std::string>>(make_column<std::string>({"b", "b", "a", "a", "c"}));
+  const auto frame_of_reference_column =
+      std::make_shared<FrameOfReferenceColumn<int64_t>>(make_column<int64_t>({7, -3, 7, 100, -3}));
+  const auto index = AdaptiveRadixTreeIndex{{run_length_column, frame_of_reference_column}};
+
+  // ("a", 7), ("a", 100), ("b", -3), ("b", 7), ("c", -3)
+  EXPECT_EQ((std::vector<ChunkOffset>{index.cbegin(), index.cend()}), (std::vector<ChunkOffset>{2, 3, 1, 0, 4}));
+  EXPECT_EQ(positions(index.equal_range({"b", int64_t{7}})), (std::vector<ChunkOffset>{0}));
+
+  EXPECT_THROW((AdaptiveRadixTreeIndex{{run_length_column, make_column<int>({1, 2})}}), std::exception);
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, InsertOnAppend) {
+  Chunk chunk;
+  chunk.add_column(std::make_shared<ValueColumn<int>>());
+  chunk.add_column(std::make_shared<ValueColumn<std::string>>());
+  const auto index = chunk.create_index<AdaptiveRadixTreeIndex>({ColumnID{1}, ColumnID{0}});
+  EXPECT_EQ(index->cbegin(), index->cend());
+
+  chunk.append({3, "x"});
+  chunk.append({1, "y"});
+  EXPECT_EQ(positions(index->equal_range({"y", 1})), (std::vector<ChunkOffset>{1}));
+  EXPECT_EQ((std::vector<ChunkOffset>{index->cbegin(), index->cend()}), (std::vector<ChunkOffset>{0, 1}));
+
+  chunk.append({2, "x"});
+  chunk.append({3, "x"});
+  EXPECT_EQ(positions(index->equal_range({"x", 3})), (std::vector<ChunkOffset>{0, 3}));
+  EXPECT_EQ((std::vector<ChunkOffset>{index->cbegin(), index->cend()}), (std::vector<ChunkOffset>{2, 0, 3, 1}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, TableIndex) {
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto i = 0; i < 1500; ++i) table->append({i, "v" + std::to_string(i % 10)});
+  table->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+
+  // new chunks get the index as well
+  for (auto i = 1500; i < 2500; ++i) table->append({i, "v" + std::to_string(i % 10)});
+  ASSERT_EQ(table->chunk_count(), 3u);
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table->get_chunk(chunk_id).get_indices({ColumnID{0}}).size(), 1u);
+  }
+
+  EXPECT_THROW(table->create_index<AdaptiveRadixTreeIndex>({ColumnID{2}}), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,130 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/attribute_vector_scan.hpp"
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/fitted_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageAttributeVectorScanTest : public BaseTest {
+ protected:
+  template <typename T>
+  std::shared_ptr<FittedAttributeVector<T>> create_attribute_vector(const size_t size, const uint32_t max_value_id) {
+    auto attribute_vector = std::make_shared<FittedAttributeVector<T>>(size);
+    for (size_t i = 0; i < size; ++i) {
+      attribute_vector->set(i, ValueID{static_cast<uint32_t>((i * 7919) % (max_value_id + 1))});
+    }
+    return attribute_vector;
+  }
+
+  std::vector<ChunkOffset> expected_offsets(const BaseAttributeVector& attribute_vector, const ValueID begin,
+                                            const ValueID end, const bool negated) {
+    std::vector<ChunkOffset> offsets;
+    for (ChunkOffset offset = 0; offset < attribute_vector.size(); ++offset) {
+      const auto value_id = attribute_vector.get(offset);
+      if ((value_id >= begin && value_id < end) != negated) offsets.push_back(offset);
+    }
+    return offsets;
+  }
+
+  // compares the results of all instruction sets supported by this CPU with a straightforward scan
+  void check_all_simd_levels(const BaseAttributeVector& attribute_vector, const ValueID begin, const ValueID end) {
+    for (const auto negated : {false, true}) {
+      const auto expected = expected_offsets(attribute_vector, begin, end, negated);
+
+      for (const auto simd_level : {SimdLevel::Scalar, SimdLevel::SSE42, SimdLevel::AVX2}) {
+        if (simd_level > supported_simd_level()) continue;
+
+        std::vector<ChunkOffset> offsets;
+        scan_value_id_range_to_offsets(attribute_vector, begin, end, negated, offsets, simd_level);
+        EXPECT_EQ(offsets, expected);
+
+        std::vector<uint64_t> bitmask;
+        scan_value_id_range_to_bitmask(attribute_vector, begin, end, negated, bitmask, simd_level);
+        ASSERT_EQ(bitmask.size(), (attribute_vector.size() + 63) / 64);
+        std::vector<ChunkOffset> bitmask_offsets;
+        for (ChunkOffset offset = 0; offset < bitmask.size() * 64; ++offset) {
+          if (bitmask[offset / 64] & (uint64_t{1} << (offset % 64))) bitmask_offsets.push_back(offset);
+        }
+        EXPECT_EQ(bitmask_offsets, expected);
+      }
+    }
+  }
+};
+
+TEST_F(StorageAttributeVectorScanTest, ScanWidth8) {
+  const auto attribute_vector = create_attribute_vector<uint8_t>(250, 200);
+  check_all_simd_levels(*attribute_vector, ValueID{10}, ValueID{100});
+  check_all_simd_levels(*attribute_vector, ValueID{0}, ValueID{1});
+  check_all_simd_levels(*attribute_vector, ValueID{150}, ValueID{1000});
+}
+
+TEST_F(StorageAttributeVectorScanTest, ScanWidth16) {
+  const auto attribute_vector = create_attribute_vector<uint16_t>(5000, 4000);
+  check_all_simd_levels(*attribute_vector, ValueID{1000}, ValueID{1001});
+  check_all_simd_levels(*attribute_vector, ValueID{0}, ValueID{2500});
+  check_all_simd_levels(*attribute_vector, ValueID{3999}, ValueID{70000});
+}
+
+TEST_F(StorageAttributeVectorScanTest, ScanWidth32) {
+  const auto attribute_vector = create_attribute_vector<uint32_t>(10007, 9000);
+  check_all_simd_levels(*attribute_vector, ValueID{17}, ValueID{8500});
+  check_all_simd_levels(*attribute_vector, ValueID{0}, ValueID{9001});
+}
+
+TEST_F(StorageAttributeVectorScanTest, ScanBitPacked) {
+  for (uint8_t bit_width = 1; bit_width <= 32; ++bit_width) {
+    const auto max_value_id = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+    BitPackedAttributeVector attribute_vector(1000, bit_width);
+    for (size_t i = 0; i < attribute_vector.size(); ++i) {
+      attribute_vector.set(i, ValueID{static_cast<uint32_t>((i * 7919) & max_value_id)});
+    }
+
+    check_all_simd_levels(attribute_vector, ValueID{0}, ValueID{max_value_id / 2 + 1});
+    check_all_simd_levels(attribute_vector, ValueID{max_value_id / 3}, ValueID{max_value_id});
+    check_all_simd_levels(attribute_vector, ValueID{max_value_id}, INVALID_VALUE_ID);
+  }
+}
+
+TEST_F(StorageAttributeVectorScanTest, EmptyRange) {
+  const auto attribute_vector = create_attribute_vector<uint8_t>(130, 100);
+  check_all_simd_levels(*attribute_vector, ValueID{50}, ValueID{50});
+  check_all_simd_levels(*attribute_vector, ValueID{300}, ValueID{400});
+}
+
+TEST_F(StorageAttributeVectorScanTest, EmptyAttributeVector) {
+  const auto attribute_vector = std::make_shared<FittedAttributeVector<uint16_t>>(0);
+  check_all_simd_levels(*attribute_vector, ValueID{0}, ValueID{10});
+}
+
+TEST_F(StorageAttributeVectorScanTest, ScanValueIDSet) {
+  BitPackedAttributeVector bit_packed(3000, 11);
+  for (size_t i = 0; i < bit_packed.size(); ++i) {
+    bit_packed.set(i, ValueID{static_cast<uint32_t>((i * 7919) % 2000)});
+  }
+  const auto fitted_8 = create_attribute_vector<uint8_t>(300, 200);
+  const auto fitted_16 = create_attribute_vector<uint16_t>(3000, 2000);
+  const auto fitted_32 = create_attribute_vector<uint32_t>(3000, 2000);
+
+  std::vector<uint8_t> value_id_matches(2001);
+  for (size_t value_id = 0; value_id < value_id_matches.size(); value_id += 3) value_id_matches[value_id] = 1;
+
+  for (const BaseAttributeVector* attribute_vector :
+       std::vector<const BaseAttributeVector*>{&bit_packed, &*fitted_8, &*fitted_16, &*fitted_32}) {
+    std::vector<ChunkOffset> expected;
+    for (ChunkOffset offset = 0; offset < attribute_vector->size(); ++offset) {
+      if (attribute_vector->get(offset) % 3 == 0) expected.push_back(offset);
+    }
+
+    std::vector<ChunkOffset> offsets;
+    scan_value_id_set_to_offsets(*attribute_vector, value_id_matches, offsets);
+    EXPECT_EQ(offsets, expected);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,92 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageBitPackedAttributeVectorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    bpav = std::make_shared<BitPackedAttributeVector>(3, 2);
+    bpav->set(0, ValueID{0});
+    bpav->set(1, ValueID{3});
+    bpav->set(2, ValueID{1});
+  }
+
+  std::shared_ptr<BitPackedAttributeVector> bpav;
+};
+
+TEST_F(StorageBitPackedAttributeVectorTest, SetAndGet) {
+  EXPECT_EQ(bpav->get(0), ValueID{0});
+  EXPECT_EQ(bpav->get(1), ValueID{3});
+  EXPECT_EQ(bpav->get(2), ValueID{1});
+
+  bpav->set(1, ValueID{2});
+  EXPECT_EQ(bpav->get(0), ValueID{0});
+  EXPECT_EQ(bpav->get(1), ValueID{2});
+  EXPECT_EQ(bpav->get(2), ValueID{1});
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, SetOutOfBounds) {
+  EXPECT_THROW(bpav->set(3, ValueID{1}), std::exception);
+  EXPECT_THROW(bpav->set(0, ValueID{4}), std::exception);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, SizeAndWidth) {
+  EXPECT_EQ(bpav->size(), 3u);
+  EXPECT_EQ(bpav->bit_width(), 2u);
+  EXPECT_EQ(bpav->width(), 1u);
+  EXPECT_EQ(std::make_shared<BitPackedAttributeVector>(1, 9)->width(), 2u);
+  EXPECT_THROW(std::make_shared<BitPackedAttributeVector>(1, 0), std::exception);
+  EXPECT_THROW(std::make_shared<BitPackedAttributeVector>(1, 33), std::exception);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, RequiredBitWidth) {
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(1), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(2), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(3), 2u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(256), 8u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(257), 9u);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, ValuesSpanningWords) {
+  // with odd bit widths, values regularly cross 64 bit word boundaries
+  for (uint8_t bit_width = 1; bit_width <= 32; ++bit_width) {
+    const auto max_value_id = (uint64_t{1} << bit_width) - 1;
+    BitPackedAttributeVector attribute_vector(200, bit_width);
+    for (size_t i = 0; i < 200; ++i) {
+      attribute_vector.set(i, ValueID{static_cast<uint32_t>((i * 2654435761u) & max_value_id)});
+    }
+
+    std::vector<ValueID::base_type> unpacked(190);
+    attribute_vector.unpack(10, 190, unpacked.data());
+
+    for (size_t i = 0; i < 200; ++i) {
+      const auto expected = ValueID{static_cast<uint32_t>((i * 2654435761u) & max_value_id)};
+      ASSERT_EQ(attribute_vector.get(i), expected);
+      if (i >= 10) {
+        ASSERT_EQ(ValueID{unpacked[i - 10]}, expected);
+      }
+    }
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, PackInBulk) {
+  for (uint8_t bit_width = 1; bit_width <= 32; bit_width += 7) {
+    const auto mask = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+    std::vector<ValueID::base_type> value_ids(200);
+    for (size_t i = 0; i < value_ids.size(); ++i) value_ids[i] = static_cast<uint32_t>(i * 2654435761u) & mask;
+
+    BitPackedAttributeVector packed(value_ids, bit_width);
+    ASSERT_EQ(packed.size(), value_ids.size());
+    for (size_t i = 0; i < value_ids.size(); ++i) {
+      ASSERT_EQ(packed.get(i), ValueID{value_ids[i]});
+    }
+  }
+}
+
+}  // namespace opossum
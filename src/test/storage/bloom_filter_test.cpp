@@ -0,0 +1,71 @@
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bloom_filter.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/run_length_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  BloomFilter bloom_filter(1000);
+  for (auto value = 0; value < 1000; ++value) bloom_filter.insert(bloom_filter_hash(value * 3));
+  for (auto value = 0; value < 1000; ++value) EXPECT_TRUE(bloom_filter.may_contain(bloom_filter_hash(value * 3)));
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  for (const auto false_positive_rate : {0.1, 0.01, 0.001}) {
+    BloomFilter bloom_filter(10000, false_positive_rate);
+    for (auto value = 0; value < 10000; ++value) bloom_filter.insert(bloom_filter_hash(value));
+
+    auto false_positives = 0;
+    for (auto value = 10000; value < 110000; ++value) {
+      if (bloom_filter.may_contain(bloom_filter_hash(value))) ++false_positives;
+    }
+    EXPECT_LT(false_positives / 100000.0, 1.5 * false_positive_rate);
+  }
+
+  // lower false positive rates need more bits
+  EXPECT_LT(BloomFilter(1000, 0.1).bit_count(), BloomFilter(1000, 0.01).bit_count());
+  EXPECT_EQ(BloomFilter(1000, 0.01).hash_count(), 7u);
+
+  EXPECT_THROW(BloomFilter(1000, 0.0), std::exception);
+  EXPECT_THROW(BloomFilter(1000, 1.0), std::exception);
+}
+
+TEST_F(StorageBloomFilterTest, HashStringsAndStringViews) {
+  const auto string = std::string{"a string longer than the inline length"};
+  EXPECT_EQ(bloom_filter_hash(string), bloom_filter_hash(std::string_view{string}));
+}
+
+TEST_F(StorageBloomFilterTest, CreateFromColumns) {
+  auto vc_str = std::make_shared<ValueColumn<std::string>>();
+  for (auto i = 0; i < 100; ++i) vc_str->append("value " + std::to_string(i % 20));
+
+  const auto columns = {std::shared_ptr<BaseColumn>{vc_str},
+                        std::shared_ptr<BaseColumn>{std::make_shared<DictionaryColumn<std::string>>(vc_str)},
+                        std::shared_ptr<BaseColumn>{std::make_shared<RunLengthColumn<std::string>>(vc_str)}};
+  for (const auto& column : columns) {
+    const auto bloom_filter = create_bloom_filter(*column, 0.001);
+    ASSERT_NE(bloom_filter, nullptr);
+    for (auto i = 0; i < 20; ++i) {
+      EXPECT_TRUE(bloom_filter->may_contain(bloom_filter_hash("value " + std::to_string(i))));
+    }
+    EXPECT_FALSE(bloom_filter->may_contain(bloom_filter_hash(std::string{"value 20"})));
+  }
+
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  EXPECT_EQ(create_bloom_filter(ReferenceColumn{table, ColumnID{0}, std::make_shared<PosList>()}), nullptr);
+}
+
+}  // namespace opossum
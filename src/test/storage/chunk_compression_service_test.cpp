@@ -0,0 +1,161 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk_compression_service.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageChunkCompressionServiceTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    StorageManager::get().add_table("table", table);
+  }
+
+  bool is_value_chunk(const ChunkID chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    return std::dynamic_pointer_cast<ValueColumn<int>>(chunk.get_column(ColumnID{0})) != nullptr &&
+           std::dynamic_pointer_cast<ValueColumn<std::string>>(chunk.get_column(ColumnID{1})) != nullptr;
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(StorageChunkCompressionServiceTest, CompressFullChunks) {
+  ChunkCompressionService service;
+  for (auto i = 0; i < 25; ++i) table->append({i, "value " + std::to_string(i % 3)});
+  service.flush();
+
+  EXPECT_EQ(service.compressed_chunk_count(), 2u);
+  EXPECT_FALSE(is_value_chunk(ChunkID{0}));
+  EXPECT_FALSE(is_value_chunk(ChunkID{1}));
+  EXPECT_TRUE(is_value_chunk(ChunkID{2}));
+
+  // the last chunk is picked up as soon as it is full
+  for (auto i = 25; i < 30; ++i) table->append({i, "value " + std::to_string(i % 3)});
+  service.flush();
+  EXPECT_EQ(service.compressed_chunk_count(), 3u);
+  EXPECT_FALSE(is_value_chunk(ChunkID{2}));
+
+  for (auto i = 0; i < 30; ++i) {
+    const auto& chunk = table->get_chunk(ChunkID{static_cast<uint32_t>(i / 10)});
+    EXPECT_EQ((*chunk.get_column(ColumnID{0}))[i % 10], AllTypeVariant{i});
+    EXPECT_EQ((*chunk.get_column(ColumnID{1}))[i % 10], AllTypeVariant{"value " + std::to_string(i % 3)});
+  }
+}
+
+TEST_F(StorageChunkCompressionServiceTest, ReadersKeepOldColumns) {
+  for (auto i = 0; i < 10; ++i) table->append({i, "value"});
+  const auto old_column =
+      std::dynamic_pointer_cast<ValueColumn<int>>(table->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  ASSERT_NE(old_column, nullptr);
+
+  ChunkCompressionService service;
+  service.flush();
+
+  EXPECT_FALSE(is_value_chunk(ChunkID{0}));
+  EXPECT_EQ(old_column->values().size(), 10u);
+  EXPECT_EQ(old_column->values()[7], 7);
+}
+
+TEST_F(StorageChunkCompressionServiceTest, ConcurrentIngest) {
+  ChunkCompressionService service(2, std::chrono::milliseconds{1});
+
+  auto writer = std::thread([&] {
+    for (auto i = 0; i < 2000; ++i) table->append({i % 2, std::to_string(i % 17)});
+  });
+
+  // read the full chunks while they are being compressed, the last one is still being filled
+  auto reader = std::thread([&] {
+    for (auto round = 0; round < 50; ++round) {
+      const auto chunk_count = table->chunk_count();
+      for (ChunkID chunk_id{0}; chunk_id + 1 < chunk_count; ++chunk_id) {
+        const auto column = table->get_chunk(chunk_id).get_column(ColumnID{0});
+        ASSERT_EQ((*column)[3], AllTypeVariant{1});
+      }
+    }
+  });
+
+  writer.join();
+  reader.join();
+  service.flush();
+
+  EXPECT_EQ(table->row_count(), 2000u);
+  EXPECT_EQ(service.compressed_chunk_count(), 200u);
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(is_value_chunk(chunk_id));
+  }
+}
+
+TEST_F(StorageChunkCompressionServiceTest, EnableBloomFilterDuringCompression) {
+  ChunkCompressionService service(2, std::chrono::milliseconds{1});
+
+  auto writer = std::thread([&] {
+    for (auto i = 0; i < 1000; ++i) table->append({i, std::to_string(i)});
+  });
+
+  // the settings are changed while the worker builds the Bloom filters of compressed chunks
+  auto configurator = std::thread([&] {
+    for (auto round = 0u; round < 200u; ++round) {
+      table->enable_bloom_filter(ColumnID{static_cast<uint16_t>(round % 2)}, 0.01);
+    }
+  });
+
+  writer.join();
+  configurator.join();
+  service.flush();
+
+  EXPECT_EQ(service.compressed_chunk_count(), 100u);
+
+  // chunks compressed after both filters were enabled have both of them
+  for (auto i = 1000; i < 1010; ++i) table->append({i, std::to_string(i)});
+  service.flush();
+  const auto& chunk = table->get_chunk(ChunkID{100});
+  ASSERT_NE(chunk.bloom_filter(ColumnID{0}), nullptr);
+  ASSERT_NE(chunk.bloom_filter(ColumnID{1}), nullptr);
+}
+
+TEST_F(StorageChunkCompressionServiceTest, SkipEncodedAndUnlimitedChunks) {
+  for (auto i = 0; i < 10; ++i) table->append({i, "value"});
+  table->compress_chunk(ChunkID{0});
+
+  auto unlimited_table = std::make_shared<Table>();
+  unlimited_table->add_column("a", "int");
+  unlimited_table->append({1});
+  StorageManager::get().add_table("unlimited_table", unlimited_table);
+
+  ChunkCompressionService service;
+  service.flush();
+
+  EXPECT_EQ(service.compressed_chunk_count(), 0u);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int>>(table->get_chunk(ChunkID{0}).get_column(ColumnID{0})),
+            nullptr);
+}
+
+TEST_F(StorageChunkCompressionServiceTest, ReplacedTable) {
+  ChunkCompressionService service;
+  for (auto i = 0; i < 10; ++i) table->append({i, "value"});
+  service.flush();
+  EXPECT_EQ(service.compressed_chunk_count(), 1u);
+
+  StorageManager::get().drop_table("table");
+  SetUp();
+  for (auto i = 0; i < 10; ++i) table->append({i, "value"});
+  service.flush();
+
+  EXPECT_EQ(service.compressed_chunk_count(), 2u);
+  EXPECT_FALSE(is_value_chunk(ChunkID{0}));
+}
+
+}  // namespace opossum
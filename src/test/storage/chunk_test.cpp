@@ -7,6 +7,9 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/base_column.hpp"
 #include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/group_key_index.hpp"
+#include "../lib/storage/zone_map.hpp"
 #include "../lib/types.hpp"
 
 namespace opossum {
@@ -37,6 +40,21 @@ TEST_F(StorageChunkTest, AddColumnToChunk) {
   EXPECT_EQ(c.size(), 3u);
 }
 
+TEST_F(StorageChunkTest, AddColumnOfOtherChunk) {
+  c.add_column(vc_int);
+  c.add_column(vc_str);
+
+  Chunk other;
+  other.add_column_of(c, ColumnID{1});
+  EXPECT_EQ(other.get_column(ColumnID{0}), vc_str);
+  EXPECT_EQ(other.zone_map(ColumnID{0}), c.zone_map(ColumnID{1}));
+  EXPECT_EQ(other.size(), 3u);
+
+  Chunk empty;
+  empty.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>("int"));
+  EXPECT_THROW(empty.add_column_of(c, ColumnID{0}), std::exception);
+}
+
 TEST_F(StorageChunkTest, AddColumnOfWrongSize) {
   c.add_column(vc_int);
   auto vc_too_large = make_shared_by_column_type<BaseColumn, ValueColumn>("int");
@@ -76,4 +94,64 @@ TEST_F(StorageChunkTest, UnknownColumnType) {
   }
 }
 
+TEST_F(StorageChunkTest, ReplaceColumns) {
+  c.add_column(vc_int);
+  c.add_column(vc_str);
+  const auto old_column = c.get_column(ColumnID{0});
+
+  auto dc_int = make_shared_by_column_type<BaseColumn, DictionaryColumn>("int", vc_int);
+  auto dc_str = make_shared_by_column_type<BaseColumn, DictionaryColumn>("string", vc_str);
+  c.replace_columns({dc_int, dc_str});
+
+  EXPECT_EQ(c.get_column(ColumnID{0}), dc_int);
+  EXPECT_EQ(c.get_column(ColumnID{1}), dc_str);
+  EXPECT_EQ(c.size(), 3u);
+
+  // the old column is still usable by whoever holds it
+  EXPECT_EQ((*old_column)[2], AllTypeVariant{3});
+
+  EXPECT_THROW(c.replace_columns({dc_int}), std::exception);
+  auto vc_short = make_shared_by_column_type<BaseColumn, ValueColumn>("int");
+  vc_short->append(1);
+  EXPECT_THROW(c.replace_columns({dc_int, vc_short}), std::exception);
+}
+
+TEST_F(StorageChunkTest, MaintainZoneMaps) {
+  c.add_column(vc_int);
+  c.add_column(vc_str);
+
+  const auto zone_map_int = c.zone_map(ColumnID{0});
+  ASSERT_NE(zone_map_int, nullptr);
+  EXPECT_EQ(zone_map_int->min(), AllTypeVariant{3});
+  EXPECT_EQ(zone_map_int->max(), AllTypeVariant{6});
+
+  c.append({-4, "zeta"});
+  EXPECT_EQ(zone_map_int->min(), AllTypeVariant{-4});
+  EXPECT_EQ(zone_map_int->max(), AllTypeVariant{6});
+  EXPECT_EQ(c.zone_map(ColumnID{1})->min(), AllTypeVariant{"!"});
+  EXPECT_EQ(c.zone_map(ColumnID{1})->max(), AllTypeVariant{"zeta"});
+
+  // encoding the columns does not change their values
+  c.replace_columns({make_shared_by_column_type<BaseColumn, DictionaryColumn>("int", vc_int),
+                     make_shared_by_column_type<BaseColumn, DictionaryColumn>("string", vc_str)});
+  EXPECT_EQ(c.zone_map(ColumnID{0}), zone_map_int);
+  EXPECT_THROW(c.zone_map(ColumnID{2}), std::exception);
+}
+
+TEST_F(StorageChunkTest, CreateIndex) {
+  c.add_column(std::make_shared<DictionaryColumn<int>>(vc_int));
+  c.add_column(vc_str);
+  EXPECT_TRUE(c.get_indices({ColumnID{0}}).empty());
+
+  const auto index = c.create_index<GroupKeyIndex>({ColumnID{0}});
+  ASSERT_EQ(c.get_indices({ColumnID{0}}).size(), 1u);
+  EXPECT_EQ(c.get_indices({ColumnID{0}}).front(), index);
+  EXPECT_TRUE(index->is_index_for({c.get_column(ColumnID{0})}));
+  EXPECT_TRUE(c.get_indices({ColumnID{1}}).empty());
+  EXPECT_TRUE(c.get_indices({ColumnID{0}, ColumnID{1}}).empty());
+
+  // GroupKeyIndex only supports dictionary columns
+  EXPECT_THROW(c.create_index<GroupKeyIndex>({ColumnID{1}}), std::exception);
+}
+
 }  // namespace opossum
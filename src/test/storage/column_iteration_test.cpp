@@ -0,0 +1,97 @@
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/column_iteration.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/frame_of_reference_column.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/run_length_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageColumnIterationTest : public BaseTest {
+ protected:
+  template <typename T>
+  std::vector<std::pair<ChunkOffset, T>> collect(const BaseColumn& column) {
+    std::vector<std::pair<ChunkOffset, T>> values;
+    for_each_value<T>(column, [&](const ChunkOffset chunk_offset, const ValueView<T>& value) {
+      values.emplace_back(chunk_offset, T{value});
+    });
+    return values;
+  }
+};
+
+TEST_F(StorageColumnIterationTest, AllColumnTypes) {
+  auto vc_int = std::make_shared<ValueColumn<int>>();
+  for (const auto value : {4, 4, 7, 1}) vc_int->append(value);
+  const auto expected = std::vector<std::pair<ChunkOffset, int>>{{0, 4}, {1, 4}, {2, 7}, {3, 1}};
+
+  EXPECT_EQ(collect<int>(*vc_int), expected);
+  EXPECT_EQ(collect<int>(DictionaryColumn<int>{vc_int}), expected);
+  EXPECT_EQ(collect<int>(RunLengthColumn<int>{vc_int}), expected);
+  EXPECT_EQ(collect<int>(FrameOfReferenceColumn<int>{vc_int}), expected);
+
+  auto vc_str = std::make_shared<ValueColumn<std::string>>();
+  for (const auto& value : {"b", "a long string that is not inlined"}) vc_str->append(value);
+  const auto expected_str =
+      std::vector<std::pair<ChunkOffset, std::string>>{{0, "b"}, {1, "a long string that is not inlined"}};
+  EXPECT_EQ(collect<std::string>(*vc_str), expected_str);
+  EXPECT_EQ(collect<std::string>(DictionaryColumn<std::string>{vc_str}), expected_str);
+}
+
+TEST_F(StorageColumnIterationTest, ReferenceColumn) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  for (const auto value : {10, 11, 12, 13, 14}) table->append({value});
+  table->compress_chunk(ChunkID{1});
+
+  const auto pos_list = std::make_shared<PosList>(
+      PosList{{ChunkID{2}, 0}, {ChunkID{1}, 1}, {ChunkID{1}, 0}, NULL_ROW_ID, {ChunkID{0}, 1}});
+  const auto reference_column = ReferenceColumn{table, ColumnID{0}, pos_list};
+
+  // NULL rows are skipped
+  EXPECT_EQ(collect<int>(reference_column),
+            (std::vector<std::pair<ChunkOffset, int>>{{0, 14}, {1, 13}, {2, 12}, {4, 11}}));
+}
+
+TEST_F(StorageColumnIterationTest, ReferenceRuns) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  for (const auto value : {10, 11, 12, 13, 14}) table->append({value});
+
+  const auto pos_list = std::make_shared<PosList>(PosList{
+      {ChunkID{1}, 1}, {ChunkID{1}, 0}, NULL_ROW_ID, NULL_ROW_ID, {ChunkID{0}, 1}, {ChunkID{1}, 1}, {ChunkID{2}, 0}});
+  const auto reference_column = ReferenceColumn{table, ColumnID{0}, pos_list};
+
+  using Run = std::tuple<size_t, ChunkID, std::vector<ChunkOffset>>;
+  const auto collect_runs = [&](const std::vector<ChunkOffset>* selection) {
+    std::vector<Run> runs;
+    for_each_reference_run(reference_column, selection, [&](const size_t run_begin, const ChunkID chunk_id,
+                                                            const std::vector<ChunkOffset>& referenced_offsets) {
+      runs.emplace_back(run_begin, chunk_id, referenced_offsets);
+    });
+    return runs;
+  };
+
+  // runs of NULL rows are skipped
+  EXPECT_EQ(collect_runs(nullptr), (std::vector<Run>{{0, ChunkID{1}, {1, 0}},
+                                                     {4, ChunkID{0}, {1}},
+                                                     {5, ChunkID{1}, {1}},
+                                                     {6, ChunkID{2}, {0}}}));
+
+  // with a selection, the runs begin at indices into the selection
+  const auto selection = std::vector<ChunkOffset>{1, 2, 5, 6};
+  EXPECT_EQ(collect_runs(&selection),
+            (std::vector<Run>{{0, ChunkID{1}, {0}}, {2, ChunkID{1}, {1}}, {3, ChunkID{2}, {0}}}));
+}
+
+}  // namespace opossum
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -6,6 +7,7 @@
 #include "../../lib/all_type_variant.hpp"
 #include "../../lib/resolve_type.hpp"
 #include "../../lib/storage/base_column.hpp"
+#include "../../lib/storage/bit_packed_attribute_vector.hpp"
 #include "../../lib/storage/dictionary_column.hpp"
 #include "../../lib/storage/fitted_attribute_vector.hpp"
 #include "../../lib/storage/value_column.hpp"
@@ -80,6 +82,32 @@ TEST_F(StorageDictionaryColumnTest, FittedAttributeVectorSize) {
   EXPECT_NE(attr_32, nullptr);
 }
 
+TEST_F(StorageDictionaryColumnTest, AttributeVectorWidthDependsOnDictionarySize) {
+  // many rows, but few distinct values
+  auto vc = std::make_shared<ValueColumn<int>>();
+  for (int i = 0; i < 100000; ++i) vc->append(i % 10);
+
+  auto col = make_shared_by_column_type<BaseColumn, DictionaryColumn>("int", vc);
+  auto dc = std::dynamic_pointer_cast<DictionaryColumn<int>>(col);
+  auto attr_8 = std::dynamic_pointer_cast<const FittedAttributeVector<uint8_t>>(dc->attribute_vector());
+  ASSERT_NE(attr_8, nullptr);
+  EXPECT_EQ(attr_8->size(), 100000u);
+  EXPECT_EQ(dc->get(99999), 9);
+}
+
+TEST_F(StorageDictionaryColumnTest, CompressColumnBitPacked) {
+  auto dc = std::make_shared<DictionaryColumn<std::string>>(vc_str, AttributeVectorType::BitPacked);
+  auto attr = std::dynamic_pointer_cast<const BitPackedAttributeVector>(dc->attribute_vector());
+  ASSERT_NE(attr, nullptr);
+
+  // four distinct values require two bits
+  EXPECT_EQ(attr->bit_width(), 2u);
+  EXPECT_EQ(dc->get(0), "Bill");
+  EXPECT_EQ(dc->get(1), "Steve");
+  EXPECT_EQ(dc->get(2), "Alexander");
+  EXPECT_EQ(dc->get(4), "Hasso");
+}
+
 TEST_F(StorageDictionaryColumnTest, CompressColumnString) {
   auto dict = dc_str->dictionary();
   auto base_attr = dc_str->attribute_vector();
@@ -135,4 +163,26 @@ TEST_F(StorageDictionaryColumnTest, ValueByValueId) {
   EXPECT_EQ(dc_str->value_by_value_id(ValueID{3}), "Steve");
 }
 
+TEST_F(StorageDictionaryColumnTest, CompressLargeColumns) {
+  // Few distinct values are encoded with a hash table, many with a sort. Both must result in the same column layout.
+  for (const auto distinct_values : {7, 100000}) {
+    auto vc_large = std::make_shared<ValueColumn<std::string>>();
+    for (auto i = 0; i < 200000; ++i) vc_large->append(std::to_string((i * 7919) % distinct_values));
+
+    for (const auto attribute_vector_type : {AttributeVectorType::Fitted, AttributeVectorType::BitPacked}) {
+      DictionaryColumn<std::string> dc_large(vc_large, attribute_vector_type);
+
+      const auto& dictionary = *dc_large.dictionary();
+      EXPECT_EQ(dictionary.size(), static_cast<size_t>(distinct_values));
+      EXPECT_TRUE(std::is_sorted(dictionary.cbegin(), dictionary.cend()));
+      EXPECT_TRUE(std::adjacent_find(dictionary.cbegin(), dictionary.cend()) == dictionary.cend());
+
+      const auto& values = vc_large->values();
+      for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(dc_large.get(i), values[i]);
+      }
+    }
+  }
+}
+
 }  // namespace opossum
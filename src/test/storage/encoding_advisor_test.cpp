@@ -0,0 +1,95 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/encoding_advisor.hpp"
+#include "../../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageEncodingAdvisorTest : public BaseTest {
+ protected:
+  template <typename T, typename Generator>
+  std::shared_ptr<ValueColumn<T>> create_value_column(const size_t size, const Generator& generator) {
+    auto value_column = std::make_shared<ValueColumn<T>>();
+    for (size_t i = 0; i < size; ++i) value_column->append(generator(i));
+    return value_column;
+  }
+
+  EncodingAdvisor advisor;
+};
+
+TEST_F(StorageEncodingAdvisorTest, SampleSmallColumn) {
+  // columns that fit into the sample are measured exactly
+  const auto column = create_value_column<int32_t>(100, [](size_t i) { return static_cast<int32_t>(i / 10); });
+  const auto statistics = advisor.sample(column, "int");
+
+  EXPECT_EQ(statistics.row_count, 100u);
+  EXPECT_EQ(statistics.distinct_count, 10u);
+  EXPECT_EQ(statistics.run_count, 10u);
+  EXPECT_TRUE(statistics.is_sorted);
+  EXPECT_EQ(statistics.value_bytes, sizeof(int32_t));
+  ASSERT_TRUE(statistics.frame_of_reference_bit_width);
+  EXPECT_EQ(*statistics.frame_of_reference_bit_width, 4u);
+}
+
+TEST_F(StorageEncodingAdvisorTest, SampleLargeColumn) {
+  const auto unique = create_value_column<int64_t>(100000, [](size_t i) { return static_cast<int64_t>(i); });
+  const auto unique_statistics = advisor.sample(unique, "long");
+  EXPECT_EQ(unique_statistics.row_count, 100000u);
+  EXPECT_EQ(unique_statistics.distinct_count, 100000u);
+  EXPECT_EQ(unique_statistics.run_count, 100000u);
+  EXPECT_TRUE(unique_statistics.is_sorted);
+
+  const auto unsorted = create_value_column<float>(100000, [](size_t i) { return static_cast<float>(i % 7); });
+  const auto unsorted_statistics = advisor.sample(unsorted, "float");
+  EXPECT_EQ(unsorted_statistics.distinct_count, 7u);
+  EXPECT_FALSE(unsorted_statistics.is_sorted);
+  EXPECT_FALSE(unsorted_statistics.frame_of_reference_bit_width);
+}
+
+TEST_F(StorageEncodingAdvisorTest, SampleRequiresValueColumn) {
+  const auto column = create_value_column<int32_t>(10, [](size_t i) { return static_cast<int32_t>(i); });
+  EXPECT_THROW(advisor.sample(column, "string"), std::exception);
+}
+
+TEST_F(StorageEncodingAdvisorTest, ChooseEncoding) {
+  const auto surrogate_keys =
+      create_value_column<int32_t>(10000, [](size_t i) { return static_cast<int32_t>(1000000 + i); });
+  EXPECT_EQ(advisor.choose_encoding(surrogate_keys, "int"), EncodingType::FrameOfReference);
+
+  const auto categories = create_value_column<std::string>(10000, [](size_t i) { return std::to_string(i % 3); });
+  EXPECT_EQ(advisor.choose_encoding(categories, "string"), EncodingType::BitPackedDictionary);
+
+  const auto clustered = create_value_column<double>(10000, [](size_t i) { return static_cast<double>(i / 1000); });
+  EXPECT_EQ(advisor.choose_encoding(clustered, "double"), EncodingType::RunLength);
+
+  // with 200 distinct values, bit-packing would not save anything over 8 bit ValueIDs
+  const auto prices = create_value_column<double>(10000, [](size_t i) { return 0.5 * static_cast<double>(i % 200); });
+  EXPECT_EQ(advisor.choose_encoding(prices, "double"), EncodingType::Dictionary);
+
+  // a dictionary would only add the ValueIDs to values that are unique anyway
+  const auto names = create_value_column<std::string>(
+      10000, [](size_t i) { return "a name that is too long for short string optimization " + std::to_string(i); });
+  EXPECT_EQ(advisor.choose_encoding(names, "string"), EncodingType::Unencoded);
+}
+
+TEST_F(StorageEncodingAdvisorTest, EstimateMemoryUsage) {
+  ColumnSampleStatistics statistics;
+  statistics.row_count = 1000;
+  statistics.distinct_count = 10;
+  statistics.run_count = 100;
+  statistics.value_bytes = 8;
+
+  EXPECT_EQ(EncodingAdvisor::estimate_memory_usage(statistics, EncodingType::Unencoded), 8000u);
+  EXPECT_EQ(EncodingAdvisor::estimate_memory_usage(statistics, EncodingType::Dictionary), 80u + 1000u);
+  EXPECT_EQ(EncodingAdvisor::estimate_memory_usage(statistics, EncodingType::BitPackedDictionary),
+            80u + (63u + 4u) * 8u);
+  EXPECT_EQ(EncodingAdvisor::estimate_memory_usage(statistics, EncodingType::RunLength), 100u * 12u);
+  EXPECT_FALSE(EncodingAdvisor::estimate_memory_usage(statistics, EncodingType::FrameOfReference));
+}
+
+}  // namespace opossum
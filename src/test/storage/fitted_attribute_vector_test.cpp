@@ -28,8 +28,12 @@ TEST_F(StorageFittedAttributeVectorTest, SetAndGet) {
 
 TEST_F(StorageFittedAttributeVectorTest, SetOutOfBounds) { EXPECT_THROW(fav->set(4, ValueID{4}), std::exception); }
 
-TEST_F(StorageFittedAttributeVectorTest, SizeTooLargeForWidth) {
-  EXPECT_THROW(std::make_shared<FittedAttributeVector<uint8_t>>(300), std::exception);
+TEST_F(StorageFittedAttributeVectorTest, ValueIDTooLargeForWidth) {
+  // the width only limits the ValueIDs, not the number of entries
+  auto large_fav = std::make_shared<FittedAttributeVector<uint8_t>>(300);
+  large_fav->set(299, ValueID{255});
+  EXPECT_EQ(large_fav->get(299), ValueID{255});
+  EXPECT_THROW(large_fav->set(0, ValueID{256}), std::exception);
 }
 
 TEST_F(StorageFittedAttributeVectorTest, Size) { EXPECT_EQ(fav->size(), 3u); }
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/base_column.hpp"
+#include "../../lib/storage/frame_of_reference_column.hpp"
+#include "../../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceColumnTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // three blocks: ascending timestamps, a narrow range of negative values, and a partial block
+    vc_long = std::make_shared<ValueColumn<int64_t>>();
+    for (int64_t i = 0; i < 2048; ++i) vc_long->append(int64_t{1500000000000} + i * 3);
+    for (int64_t i = 0; i < 2048; ++i) vc_long->append(-i % 7);
+    for (int64_t i = 0; i < 100; ++i) vc_long->append(i);
+
+    forc_long = std::make_shared<FrameOfReferenceColumn<int64_t>>(vc_long);
+  }
+
+  std::shared_ptr<ValueColumn<int64_t>> vc_long;
+  std::shared_ptr<FrameOfReferenceColumn<int64_t>> forc_long;
+};
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressColumn) {
+  EXPECT_EQ(forc_long->size(), 4196u);
+  EXPECT_EQ(*forc_long->block_minimums(), (std::vector<int64_t>{1500000000000, -6, 0}));
+  // the widest block spans 2047 * 3 = 6141 values
+  EXPECT_EQ(forc_long->offsets()->bit_width(), 13u);
+  EXPECT_EQ(forc_long->offsets()->get(2048 + 3), ValueID{3});
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, Get) {
+  const auto& values = vc_long->values();
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(forc_long->get(i), values[i]);
+  }
+  EXPECT_EQ((*forc_long)[2048 + 5], AllTypeVariant{int64_t{-5}});
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, Unpack) {
+  const auto& values = vc_long->values();
+
+  std::vector<int64_t> unpacked(values.size());
+  forc_long->unpack(0, values.size(), unpacked.data());
+  EXPECT_TRUE(std::equal(values.cbegin(), values.cend(), unpacked.cbegin()));
+
+  // across a block boundary
+  std::vector<int64_t> unpacked_range(20);
+  forc_long->unpack(2040, 20, unpacked_range.data());
+  EXPECT_TRUE(std::equal(values.cbegin() + 2040, values.cbegin() + 2060, unpacked_range.cbegin()));
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, ExtremeValues) {
+  auto vc_int = std::make_shared<ValueColumn<int32_t>>();
+  // the full range of int32_t minus one value, because the largest offset is reserved as INVALID_VALUE_ID
+  vc_int->append(std::numeric_limits<int32_t>::min() + 1);
+  vc_int->append(std::numeric_limits<int32_t>::max());
+  vc_int->append(0);
+
+  FrameOfReferenceColumn<int32_t> forc_int(vc_int);
+  EXPECT_EQ(forc_int.offsets()->bit_width(), 32u);
+  EXPECT_EQ(forc_int.get(0), std::numeric_limits<int32_t>::min() + 1);
+  EXPECT_EQ(forc_int.get(1), std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(forc_int.get(2), 0);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, RangeTooWide) {
+  auto vc = std::make_shared<ValueColumn<int64_t>>();
+  vc->append(int64_t{0});
+  vc->append(int64_t{1} << 40);
+  EXPECT_THROW(FrameOfReferenceColumn<int64_t>{vc}, std::exception);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, AppendToFrameOfReferenceColumn) {
+  EXPECT_THROW(forc_long->append(int64_t{1}), std::exception);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressEmptyColumn) {
+  auto vc_int = std::make_shared<ValueColumn<int32_t>>();
+  EXPECT_THROW(FrameOfReferenceColumn<int32_t>{vc_int}, std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/group_key_index.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageGroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto vc_str = std::make_shared<ValueColumn<std::string>>();
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"}) {
+      vc_str->append(value);
+    }
+    dict_col = std::make_shared<DictionaryColumn<std::string>>(vc_str);
+    index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const BaseColumn>>{dict_col});
+  }
+
+  std::vector<ChunkOffset> positions(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return {begin, end};
+  }
+
+  std::shared_ptr<DictionaryColumn<std::string>> dict_col;
+  std::shared_ptr<GroupKeyIndex> index;
+};
+
+TEST_F(StorageGroupKeyIndexTest, PositionsAreGroupedByValue) {
+  // apple, charlie, delta, frank, hotel, inbox
+  EXPECT_EQ(positions(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{4, 5, 6, 1, 3, 2, 0, 7}));
+  EXPECT_TRUE(index->is_index_for({dict_col}));
+  EXPECT_FALSE(index->is_index_for({dict_col, dict_col}));
+}
+
+TEST_F(StorageGroupKeyIndexTest, PointLookups) {
+  EXPECT_EQ(positions(index->lower_bound({"delta"}), index->upper_bound({"delta"})), (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(positions(index->lower_bound({"inbox"}), index->upper_bound({"inbox"})), (std::vector<ChunkOffset>{7}));
+
+  // values that are not in the dictionary
+  EXPECT_EQ(index->lower_bound({"echo"}), index->upper_bound({"echo"}));
+  EXPECT_EQ(index->lower_bound({"aaa"}), index->cbegin());
+  EXPECT_EQ(index->lower_bound({"zulu"}), index->cend());
+  EXPECT_EQ(index->upper_bound({"zulu"}), index->cend());
+}
+
+TEST_F(StorageGroupKeyIndexTest, RangeLookups) {
+  // all values within ["b", "frank"]
+  EXPECT_EQ(positions(index->lower_bound({"b"}), index->upper_bound({"frank"})),
+            (std::vector<ChunkOffset>{5, 6, 1, 3, 2}));
+  EXPECT_EQ(positions(index->upper_bound({"frank"}), index->cend()), (std::vector<ChunkOffset>{0, 7}));
+}
+
+TEST_F(StorageGroupKeyIndexTest, InvalidColumns) {
+  auto vc_int = std::make_shared<ValueColumn<int>>();
+  vc_int->append(1);
+  EXPECT_THROW(GroupKeyIndex(std::vector<std::shared_ptr<const BaseColumn>>{vc_int}), std::exception);
+  EXPECT_THROW(GroupKeyIndex(std::vector<std::shared_ptr<const BaseColumn>>{dict_col, dict_col}), std::exception);
+  EXPECT_THROW(index->lower_bound({}), std::exception);
+  EXPECT_THROW(index->lower_bound({"a", "b"}), std::exception);
+}
+
+}  // namespace opossum
@@ -6,12 +6,14 @@
 #include <utility>
 #include <vector>
 
+#include "../base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "operators/abstract_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -19,78 +21,132 @@
 
 namespace opossum {
 
-// class ReferenceColumnTest : public ::testing::Test {
-//   virtual void SetUp() {
-//     _test_table = std::make_shared<opossum::Table>(opossum::Table(3));
-//     _test_table->add_column("a", "int");
-//     _test_table->add_column("b", "float");
-//     _test_table->append({123, 456.7f});
-//     _test_table->append({1234, 457.7f});
-//     _test_table->append({12345, 458.7f});
-//     _test_table->append({54321, 458.7f});
-//     _test_table->append({12345, 458.7f});
-
-//     _test_table_dict = std::make_shared<opossum::Table>(5);
-//     _test_table_dict->add_column("a", "int");
-//     _test_table_dict->add_column("b", "int");
-//     for (int i = 0; i <= 24; i += 2) _test_table_dict->append({i, 100 + i});
-
-//     _test_table_dict->compress_chunk(ChunkID(0));
-//     _test_table_dict->compress_chunk(ChunkID(1));
-
-//     StorageManager::get().add_table("test_table_dict", _test_table_dict);
-//   }
-
-//  public:
-//   std::shared_ptr<opossum::Table> _test_table, _test_table_dict;
-//   std::shared_ptr<ReferenceColumn> _ref_column_1;
-// };
-
-// TEST_F(ReferenceColumnTest, IsImmutable) {
-//   auto pos_list =
-//       std::make_shared<PosList>(std::initializer_list<RowID>({{ChunkID{0}, 0}, {ChunkID{0}, 1}, {ChunkID{0}, 2}}));
-//   auto ref_column = ReferenceColumn(_test_table, ColumnID{0}, pos_list);
-
-//   EXPECT_THROW(ref_column.append(1), std::logic_error);
-// }
-
-// TEST_F(ReferenceColumnTest, RetrievesValues) {
-//   // PosList with (0, 0), (0, 1), (0, 2)
-//   auto pos_list = std::make_shared<PosList>(
-//       std::initializer_list<RowID>({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}}));
-//   auto ref_column = ReferenceColumn(_test_table, ColumnID{0}, pos_list);
-
-//   auto& column = *(_test_table->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
-
-//   EXPECT_EQ(ref_column[0], column[0]);
-//   EXPECT_EQ(ref_column[1], column[1]);
-//   EXPECT_EQ(ref_column[2], column[2]);
-// }
-
-// TEST_F(ReferenceColumnTest, RetrievesValuesOutOfOrder) {
-//   // PosList with (0, 1), (0, 2), (0, 0)
-//   auto pos_list = std::make_shared<PosList>(
-//       std::initializer_list<RowID>({RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{0}, 0}}));
-//   auto ref_column = ReferenceColumn(_test_table, ColumnID{0}, pos_list);
-
-//   auto& column = *(_test_table->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
-
-//   EXPECT_EQ(ref_column[0], column[1]);
-//   EXPECT_EQ(ref_column[1], column[2]);
-//   EXPECT_EQ(ref_column[2], column[0]);
-// }
-
-// TEST_F(ReferenceColumnTest, RetrievesValuesFromChunks) {
-//   // PosList with (0, 2), (1, 0), (1, 1)
-//   auto pos_list = std::make_shared<PosList>(
-//       std::initializer_list<RowID>({RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 1}}));
-//   auto ref_column = ReferenceColumn(_test_table, ColumnID{0}, pos_list);
-
-//   auto& column_1 = *(_test_table->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
-//   auto& column_2 = *(_test_table->get_chunk(ChunkID{1}).get_column(ColumnID{0}));
-
-//   EXPECT_EQ(ref_column[0], column_1[2]);
-//   EXPECT_EQ(ref_column[2], column_2[1]);
-// }
+class ReferenceColumnTest : public BaseTest {
+  virtual void SetUp() {
+    _test_table = std::make_shared<opossum::Table>(opossum::Table(3));
+    _test_table->add_column("a", "int");
+    _test_table->add_column("b", "float");
+    _test_table->append({123, 456.7f});
+    _test_table->append({1234, 457.7f});
+    _test_table->append({12345, 458.7f});
+    _test_table->append({54321, 458.7f});
+    _test_table->append({12345, 458.7f});
+
+    _test_table_dict = std::make_shared<opossum::Table>(5);
+    _test_table_dict->add_column("a", "int");
+    _test_table_dict->add_column("b", "int");
+    for (int i = 0; i <= 24; i += 2) _test_table_dict->append({i, 100 + i});
+
+    _test_table_dict->compress_chunk(ChunkID(0));
+    _test_table_dict->compress_chunk(ChunkID(1));
+
+    StorageManager::get().add_table("test_table_dict", _test_table_dict);
+  }
+
+ public:
+  std::shared_ptr<opossum::Table> _test_table, _test_table_dict;
+  std::shared_ptr<ReferenceColumn> _ref_column_1;
+};
+
+TEST_F(ReferenceColumnTest, IsImmutable) {
+  auto pos_list =
+      std::make_shared<PosList>(std::initializer_list<RowID>({{ChunkID{0}, 0}, {ChunkID{0}, 1}, {ChunkID{0}, 2}}));
+  auto ref_column = ReferenceColumn(_test_table, ColumnID{0}, pos_list);
+
+  EXPECT_THROW(ref_column.append(1), std::logic_error);
+}
+
+TEST_F(ReferenceColumnTest, RetrievesValues) {
+  // PosList with (0, 0), (0, 1), (0, 2)
+  auto pos_list = std::make_shared<PosList>(
+      std::initializer_list<RowID>({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}}));
+  auto ref_column = ReferenceColumn(_test_table, ColumnID{0}, pos_list);
+
+  auto& column = *(_test_table->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+
+  EXPECT_EQ(ref_column[0], column[0]);
+  EXPECT_EQ(ref_column[1], column[1]);
+  EXPECT_EQ(ref_column[2], column[2]);
+}
+
+TEST_F(ReferenceColumnTest, RetrievesValuesOutOfOrder) {
+  // PosList with (0, 1), (0, 2), (0, 0)
+  auto pos_list = std::make_shared<PosList>(
+      std::initializer_list<RowID>({RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{0}, 0}}));
+  auto ref_column = ReferenceColumn(_test_table, ColumnID{0}, pos_list);
+
+  auto& column = *(_test_table->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+
+  EXPECT_EQ(ref_column[0], column[1]);
+  EXPECT_EQ(ref_column[1], column[2]);
+  EXPECT_EQ(ref_column[2], column[0]);
+}
+
+TEST_F(ReferenceColumnTest, RetrievesValuesFromChunks) {
+  // PosList with (0, 2), (1, 0), (1, 1)
+  auto pos_list = std::make_shared<PosList>(
+      std::initializer_list<RowID>({RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 1}}));
+  auto ref_column = ReferenceColumn(_test_table, ColumnID{0}, pos_list);
+
+  auto& column_1 = *(_test_table->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  auto& column_2 = *(_test_table->get_chunk(ChunkID{1}).get_column(ColumnID{0}));
+
+  EXPECT_EQ(ref_column[0], column_1[2]);
+  EXPECT_EQ(ref_column[2], column_2[1]);
+}
+
+TEST_F(ReferenceColumnTest, NullRowID) {
+  auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>({{ChunkID{0}, 1}, NULL_ROW_ID}));
+  auto ref_column = ReferenceColumn(_test_table, ColumnID{1}, pos_list);
+
+  EXPECT_EQ(ref_column[0], AllTypeVariant{457.7f});
+  EXPECT_EQ(ref_column[1], AllTypeVariant{0.0f});
+}
+
+TEST_F(ReferenceColumnTest, AddReferenceColumns) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_test_table_dict);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 10);
+  scan->execute();
+
+  // the positions point into the scan output, whose chunks reference the chunks 1 and 2 of the original table
+  const auto positions = std::make_shared<PosList>(PosList{{ChunkID{1}, 2}, NULL_ROW_ID, {ChunkID{0}, 0}});
+  Chunk chunk;
+  add_reference_columns(chunk, scan->get_output(), positions);
+  ASSERT_EQ(chunk.col_count(), 2u);
+
+  const auto column_a = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{0}));
+  const auto column_b = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{1}));
+  EXPECT_EQ(column_a->referenced_table(), _test_table_dict);
+  EXPECT_EQ(column_a->pos_list(), column_b->pos_list());
+  EXPECT_EQ(*column_a->pos_list(), (PosList{{ChunkID{2}, 2}, NULL_ROW_ID, {ChunkID{1}, 0}}));
+  EXPECT_EQ((*column_b)[0], AllTypeVariant{124});
+}
+
+TEST_F(ReferenceColumnTest, AddReferenceColumnsForChunk) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_test_table_dict);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 10);
+  scan->execute();
+
+  // only the chunk 1 of the scan output is inspected, it references the chunk 2 of the original table
+  const auto positions = std::make_shared<PosList>(PosList{{ChunkID{1}, 2}, NULL_ROW_ID, {ChunkID{1}, 0}});
+  Chunk chunk;
+  add_reference_columns(chunk, scan->get_output(), ChunkID{1}, positions);
+  ASSERT_EQ(chunk.col_count(), 2u);
+
+  const auto column_a = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{0}));
+  const auto column_b = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{1}));
+  EXPECT_EQ(column_a->referenced_table(), _test_table_dict);
+  EXPECT_EQ(column_a->pos_list(), column_b->pos_list());
+  EXPECT_EQ(*column_a->pos_list(), (PosList{{ChunkID{2}, 2}, NULL_ROW_ID, {ChunkID{2}, 0}}));
+
+  // positions into a table that holds the data are taken as they are
+  Chunk direct_chunk;
+  add_reference_columns(direct_chunk, _test_table_dict, ChunkID{1}, positions);
+  EXPECT_EQ(std::dynamic_pointer_cast<const ReferenceColumn>(direct_chunk.get_column(ColumnID{1}))->pos_list(),
+            positions);
+  EXPECT_THROW(add_reference_columns(direct_chunk, _test_table_dict, ChunkID{3}, positions), std::exception);
+}
 
 }  // namespace opossum
@@ -0,0 +1,71 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../lib/resolve_type.hpp"
+#include "../../lib/storage/base_column.hpp"
+#include "../../lib/storage/run_length_column.hpp"
+#include "../../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageRunLengthColumnTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    vc_str = std::make_shared<ValueColumn<std::string>>();
+    vc_str->append("Bill");
+    vc_str->append("Bill");
+    vc_str->append("Steve");
+    vc_str->append("Alexander");
+    vc_str->append("Alexander");
+    vc_str->append("Alexander");
+    vc_str->append("Bill");
+
+    auto base_col = make_shared_by_column_type<BaseColumn, RunLengthColumn>("string", vc_str);
+    rlc_str = std::dynamic_pointer_cast<RunLengthColumn<std::string>>(base_col);
+  }
+
+  std::shared_ptr<ValueColumn<std::string>> vc_str;
+  std::shared_ptr<RunLengthColumn<std::string>> rlc_str;
+};
+
+TEST_F(StorageRunLengthColumnTest, CompressColumn) {
+  ASSERT_NE(rlc_str, nullptr);
+  EXPECT_EQ(rlc_str->size(), 7u);
+  EXPECT_EQ(rlc_str->run_count(), 4u);
+  EXPECT_EQ(*rlc_str->values(), (std::vector<std::string>{"Bill", "Steve", "Alexander", "Bill"}));
+  EXPECT_EQ(*rlc_str->end_positions(), (std::vector<ChunkOffset>{1, 2, 5, 6}));
+}
+
+TEST_F(StorageRunLengthColumnTest, Get) {
+  EXPECT_EQ(rlc_str->get(0), "Bill");
+  EXPECT_EQ(rlc_str->get(1), "Bill");
+  EXPECT_EQ(rlc_str->get(2), "Steve");
+  EXPECT_EQ(rlc_str->get(5), "Alexander");
+  EXPECT_EQ((*rlc_str)[3], AllTypeVariant{"Alexander"});
+  EXPECT_EQ((*rlc_str)[6], AllTypeVariant{"Bill"});
+}
+
+TEST_F(StorageRunLengthColumnTest, RunIndex) {
+  EXPECT_EQ(rlc_str->run_index(0), 0u);
+  EXPECT_EQ(rlc_str->run_index(1), 0u);
+  EXPECT_EQ(rlc_str->run_index(2), 1u);
+  EXPECT_EQ(rlc_str->run_index(3), 2u);
+  EXPECT_EQ(rlc_str->run_index(6), 3u);
+}
+
+TEST_F(StorageRunLengthColumnTest, AppendToRunLengthColumn) { EXPECT_THROW(rlc_str->append("Linus"), std::exception); }
+
+TEST_F(StorageRunLengthColumnTest, CompressAlreadyCompressedColumn) {
+  EXPECT_THROW((make_shared_by_column_type<BaseColumn, RunLengthColumn>("string", rlc_str)), std::exception);
+}
+
+TEST_F(StorageRunLengthColumnTest, CompressEmptyColumn) {
+  auto vc_int = std::make_shared<ValueColumn<int>>();
+  EXPECT_THROW((make_shared_by_column_type<BaseColumn, RunLengthColumn>("int", vc_int)), std::exception);
+}
+
+}  // namespace opossum
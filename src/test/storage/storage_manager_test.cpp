@@ -37,6 +37,14 @@ TEST_F(StorageStorageManagerTest, GetTable) {
   EXPECT_THROW(sm.get_table("third_table"), std::exception);
 }
 
+TEST_F(StorageStorageManagerTest, TryGetTable) {
+  auto& sm = StorageManager::get();
+  EXPECT_EQ(sm.try_get_table("first_table"), sm.get_table("first_table"));
+  EXPECT_EQ(sm.try_get_table("third_table"), nullptr);
+  sm.drop_table("first_table");
+  EXPECT_EQ(sm.try_get_table("first_table"), nullptr);
+}
+
 TEST_F(StorageStorageManagerTest, DropTable) {
   auto& sm = StorageManager::get();
   sm.drop_table("first_table");
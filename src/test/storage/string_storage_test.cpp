@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/string_storage.hpp"
+
+namespace opossum {
+
+class StorageStringStorageTest : public BaseTest {
+ protected:
+  // strings that are inlined, that are stored in the heap, and that share the prefix with other strings
+  const std::vector<std::string> strings{"", "a", "Bill", "Bill Gates", "Billy", "Hasso Plattner", "Hasso",
+                                         "Steve Jobs and Steve", std::string(3, '\0')};
+};
+
+TEST_F(StorageStringStorageTest, PushBackAndAccess) {
+  StringStorage storage;
+  EXPECT_TRUE(storage.empty());
+  for (const auto& string : strings) storage.push_back(string);
+
+  ASSERT_EQ(storage.size(), strings.size());
+  for (size_t index = 0; index < strings.size(); ++index) {
+    EXPECT_EQ(storage[index], strings[index]);
+    EXPECT_EQ(storage.at(index), strings[index]);
+  }
+  EXPECT_EQ(storage.back(), strings.back());
+  EXPECT_THROW(storage.at(strings.size()), std::exception);
+
+  EXPECT_EQ(std::vector<std::string>(storage.cbegin(), storage.cend()), strings);
+}
+
+TEST_F(StorageStringStorageTest, CreateFromStringViews) {
+  const auto storage = StringStorage{std::vector<std::string_view>(strings.cbegin(), strings.cend())};
+  EXPECT_EQ(std::vector<std::string>(storage.cbegin(), storage.cend()), strings);
+}
+
+TEST_F(StorageStringStorageTest, CompareAndEquals) {
+  const auto storage = StringStorage{std::vector<std::string_view>(strings.cbegin(), strings.cend())};
+  const auto sign = [](const int value) { return (value > 0) - (value < 0); };
+
+  for (size_t left = 0; left < strings.size(); ++left) {
+    for (size_t right = 0; right < strings.size(); ++right) {
+      const auto expected = sign(strings[left].compare(strings[right]));
+      EXPECT_EQ(sign(storage.compare(left, right)), expected) << strings[left] << " vs. " << strings[right];
+      EXPECT_EQ(sign(storage.compare(left, strings[right])), expected) << strings[left] << " vs. " << strings[right];
+      EXPECT_EQ(storage.equals(left, strings[right]), left == right) << strings[left] << " vs. " << strings[right];
+    }
+  }
+}
+
+TEST_F(StorageStringStorageTest, LowerAndUpperBound) {
+  auto sorted_strings = std::vector<std::string>{"Alexander", "Bill", "Bill", "Hasso Plattner", "Steve"};
+  const auto storage = StringStorage{std::vector<std::string_view>(sorted_strings.cbegin(), sorted_strings.cend())};
+  EXPECT_TRUE(std::is_sorted(storage.cbegin(), storage.cend()));
+
+  EXPECT_EQ(storage.lower_bound("Bill"), 1u);
+  EXPECT_EQ(storage.upper_bound("Bill"), 3u);
+  EXPECT_EQ(storage.lower_bound("Hasso"), 3u);
+  EXPECT_EQ(storage.upper_bound("Hasso Plattner"), 4u);
+  EXPECT_EQ(storage.lower_bound("A"), 0u);
+  EXPECT_EQ(storage.lower_bound("Z"), 5u);
+  EXPECT_EQ(storage.upper_bound("Steve"), 5u);
+}
+
+TEST_F(StorageStringStorageTest, MemoryUsage) {
+  StringStorage storage;
+  storage.push_back("short");
+  storage.push_back("a string longer than twelve characters");
+
+  // only the long string is stored in the heap
+  EXPECT_EQ(storage.estimate_memory_usage(), 2 * sizeof(StringStorage::Header) + 38);
+}
+
+}  // namespace opossum
@@ -9,6 +9,8 @@
 
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/frame_of_reference_column.hpp"
+#include "../lib/storage/run_length_column.hpp"
 #include "../lib/storage/table.hpp"
 
 namespace opossum {
@@ -60,6 +62,76 @@ TEST_F(StorageTableTest, CompressChunk) {
   EXPECT_NE(base_column2, nullptr);
 }
 
+TEST_F(StorageTableTest, CompressChunkRunLength) {
+  t.append({4, "Hello,"});
+  t.append({4, "world"});
+  t.compress_chunk(ChunkID{0}, EncodingType::RunLength);
+
+  const auto& chunk_after = t.get_chunk(ChunkID{0});
+  const auto column1 = std::dynamic_pointer_cast<RunLengthColumn<int>>(chunk_after.get_column(ColumnID{0}));
+  const auto column2 = std::dynamic_pointer_cast<RunLengthColumn<std::string>>(chunk_after.get_column(ColumnID{1}));
+  ASSERT_NE(column1, nullptr);
+  ASSERT_NE(column2, nullptr);
+  EXPECT_EQ(column1->run_count(), 1u);
+  EXPECT_EQ(column2->run_count(), 2u);
+}
+
+TEST_F(StorageTableTest, CompressChunkFrameOfReference) {
+  Table t_int{2};
+  t_int.add_column("col_1", "int");
+  t_int.add_column("col_2", "long");
+  t_int.append({4, int64_t{1000}});
+  t_int.append({6, int64_t{1003}});
+  t_int.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+
+  const auto& chunk_after = t_int.get_chunk(ChunkID{0});
+  const auto column1 = std::dynamic_pointer_cast<FrameOfReferenceColumn<int32_t>>(chunk_after.get_column(ColumnID{0}));
+  const auto column2 = std::dynamic_pointer_cast<FrameOfReferenceColumn<int64_t>>(chunk_after.get_column(ColumnID{1}));
+  ASSERT_NE(column1, nullptr);
+  ASSERT_NE(column2, nullptr);
+  EXPECT_EQ(column1->get(1), 6);
+  EXPECT_EQ(column2->get(1), 1003);
+
+  // frame-of-reference encoding is not defined for strings
+  t.append({4, "Hello,"});
+  t.append({4, "world"});
+  EXPECT_THROW(t.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference), std::exception);
+}
+
+TEST_F(StorageTableTest, CompressChunkAdaptively) {
+  Table t_large{1000};
+  t_large.add_column("col_1", "int");
+  t_large.add_column("col_2", "string");
+  t_large.add_column("col_3", "string");
+  for (auto i = 0; i < 1000; ++i) t_large.append({i, std::to_string(i % 3), "constant"});
+
+  const auto decisions = t_large.compress_chunk_adaptively(ChunkID{0}, {{ColumnID{2}, EncodingType::Dictionary}});
+  ASSERT_EQ(decisions.size(), 3u);
+
+  const auto& chunk_after = t_large.get_chunk(ChunkID{0});
+  EXPECT_EQ(decisions[0].encoding_type, EncodingType::FrameOfReference);
+  EXPECT_FALSE(decisions[0].is_override);
+  EXPECT_NE(std::dynamic_pointer_cast<FrameOfReferenceColumn<int>>(chunk_after.get_column(ColumnID{0})), nullptr);
+
+  EXPECT_EQ(decisions[1].encoding_type, EncodingType::BitPackedDictionary);
+  EXPECT_FALSE(decisions[1].is_override);
+
+  // without the override, the constant column would be run-length encoded
+  EXPECT_EQ(decisions[2].encoding_type, EncodingType::Dictionary);
+  EXPECT_TRUE(decisions[2].is_override);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<std::string>>(chunk_after.get_column(ColumnID{2})), nullptr);
+
+  for (ColumnID column_id{0}; column_id < 3; ++column_id) {
+    EXPECT_EQ(decisions[column_id].memory_usage, chunk_after.get_column(column_id)->estimate_memory_usage());
+  }
+}
+
+TEST_F(StorageTableTest, CompressChunkAdaptivelyUnknownColumn) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  EXPECT_THROW(t.compress_chunk_adaptively(ChunkID{0}, {{ColumnID{2}, EncodingType::Dictionary}}), std::exception);
+}
+
 TEST_F(StorageTableTest, CompressEmptyChunk) { EXPECT_THROW(t.compress_chunk(ChunkID{0}), std::exception); }
 
 TEST_F(StorageTableTest, CompressNonFullChunk) {
@@ -143,4 +215,48 @@ TEST_F(StorageTableTest, AddColumnTwice) {
   t.add_column("col_3", "int");
   EXPECT_THROW(t.add_column("col_3", "int"), std::exception);
 }
+
+TEST_F(StorageTableTest, EmplaceChunk) {
+  Table t_emplace;
+  t_emplace.add_column_definition("col_1", "int");
+
+  auto column = make_shared_by_column_type<BaseColumn, ValueColumn>("int");
+  column->append(4);
+  Chunk chunk;
+  chunk.add_column(column);
+
+  // the initial empty chunk is replaced
+  t_emplace.emplace_chunk(std::move(chunk));
+  EXPECT_EQ(t_emplace.chunk_count(), 1u);
+  EXPECT_EQ(t_emplace.row_count(), 1u);
+
+  Chunk second_chunk;
+  second_chunk.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>("int"));
+  t_emplace.emplace_chunk(std::move(second_chunk));
+  EXPECT_EQ(t_emplace.chunk_count(), 2u);
+
+  EXPECT_THROW(t_emplace.emplace_chunk(Chunk{}), std::exception);
+}
+TEST_F(StorageTableTest, BuildBloomFiltersOnCompression) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.append({5, "?"});
+
+  t.compress_chunk(ChunkID{0});
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).bloom_filter(ColumnID{0}), nullptr);
+
+  EXPECT_THROW(t.enable_bloom_filter(ColumnID{2}), std::exception);
+  EXPECT_THROW(t.enable_bloom_filter(ColumnID{1}, 1.5), std::exception);
+  t.enable_bloom_filter(ColumnID{1}, 0.001);
+  t.compress_chunk_adaptively(ChunkID{1});
+
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).bloom_filter(ColumnID{0}), nullptr);
+  const auto bloom_filter = t.get_chunk(ChunkID{1}).bloom_filter(ColumnID{1});
+  ASSERT_NE(bloom_filter, nullptr);
+  EXPECT_TRUE(bloom_filter->may_contain(bloom_filter_hash(std::string{"!"})));
+  EXPECT_TRUE(bloom_filter->may_contain(bloom_filter_hash(std::string{"?"})));
+  EXPECT_FALSE(bloom_filter->may_contain(bloom_filter_hash(std::string{"Hello,"})));
+}
+
 }  // namespace opossum
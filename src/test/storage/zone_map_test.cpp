@@ -0,0 +1,90 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/frame_of_reference_column.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/run_length_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/storage/zone_map.hpp"
+
+namespace opossum {
+
+class StorageZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto value : {17, 5, 12, 5, 30}) vc_int->append(value);
+    for (const auto& value : {"Steve", "Bill", "Hasso", "Alexander"}) vc_str->append(value);
+  }
+
+  std::shared_ptr<ValueColumn<int>> vc_int = std::make_shared<ValueColumn<int>>();
+  std::shared_ptr<ValueColumn<std::string>> vc_str = std::make_shared<ValueColumn<std::string>>();
+};
+
+TEST_F(StorageZoneMapTest, CreateFromColumns) {
+  const auto columns = {std::shared_ptr<BaseColumn>{vc_int}, std::shared_ptr<BaseColumn>{vc_str},
+                        std::shared_ptr<BaseColumn>{std::make_shared<DictionaryColumn<int>>(vc_int)},
+                        std::shared_ptr<BaseColumn>{std::make_shared<DictionaryColumn<std::string>>(vc_str)},
+                        std::shared_ptr<BaseColumn>{std::make_shared<RunLengthColumn<int>>(vc_int)},
+                        std::shared_ptr<BaseColumn>{std::make_shared<FrameOfReferenceColumn<int>>(vc_int)}};
+  for (const auto& column : columns) {
+    const auto zone_map = create_zone_map(*column);
+    ASSERT_NE(zone_map, nullptr);
+    EXPECT_FALSE(zone_map->is_empty());
+    if (zone_map->min().type() == typeid(int)) {
+      EXPECT_EQ(zone_map->min(), AllTypeVariant{5});
+      EXPECT_EQ(zone_map->max(), AllTypeVariant{30});
+    } else {
+      EXPECT_EQ(zone_map->min(), AllTypeVariant{"Alexander"});
+      EXPECT_EQ(zone_map->max(), AllTypeVariant{"Steve"});
+    }
+  }
+
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  EXPECT_EQ(create_zone_map(ReferenceColumn{table, ColumnID{0}, std::make_shared<PosList>()}), nullptr);
+}
+
+TEST_F(StorageZoneMapTest, Append) {
+  ZoneMap<int> zone_map;
+  EXPECT_TRUE(zone_map.is_empty());
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpNotEquals, 3));
+
+  zone_map.append(8);
+  zone_map.append(int64_t{3});
+  zone_map.append(5);
+  EXPECT_FALSE(zone_map.is_empty());
+  EXPECT_EQ(zone_map.typed_min(), 3);
+  EXPECT_EQ(zone_map.typed_max(), 8);
+}
+
+TEST_F(StorageZoneMapTest, CanPrune) {
+  const auto zone_map = ZoneMap<int>::create(*vc_int);
+  ASSERT_NE(zone_map, nullptr);
+
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpEquals, 4));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpEquals, 5));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpEquals, 20));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpEquals, 31));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpNotEquals, 5));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpLessThan, 5));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpLessThan, 6));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpLessThanEquals, 4));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpLessThanEquals, 5));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpGreaterThan, 30));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpGreaterThan, 29));
+  EXPECT_TRUE(zone_map->can_prune(ScanType::OpGreaterThanEquals, 31));
+  EXPECT_FALSE(zone_map->can_prune(ScanType::OpGreaterThanEquals, AllTypeVariant{30}));
+
+  // a column that contains a single distinct value cannot satisfy a != on it
+  ZoneMap<std::string> zone_map_str;
+  zone_map_str.append("Bill");
+  EXPECT_TRUE(zone_map_str.can_prune(ScanType::OpNotEquals, std::string{"Bill"}));
+  EXPECT_FALSE(zone_map_str.can_prune(ScanType::OpNotEquals, std::string{"Steve"}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/parallel.hpp"
+
+namespace opossum {
+
+class UtilsParallelTest : public BaseTest {};
+
+TEST_F(UtilsParallelTest, ThreadCount) {
+  EXPECT_EQ(parallel_thread_count(0, 100), 1u);
+  EXPECT_EQ(parallel_thread_count(150, 100), 1u);
+  EXPECT_LE(parallel_thread_count(1000000, 100), std::max(1u, std::thread::hardware_concurrency()));
+}
+
+TEST_F(UtilsParallelTest, ForEachRange) {
+  std::vector<size_t> visits(1000);
+  std::mutex mutex;
+  std::vector<size_t> range_indices;
+
+  parallel_for_each_range(visits.size(), 7, [&](const size_t range_index, const size_t begin, const size_t end) {
+    for (auto i = begin; i < end; ++i) ++visits[i];
+    std::lock_guard<std::mutex> lock(mutex);
+    range_indices.push_back(range_index);
+  });
+
+  EXPECT_TRUE(std::all_of(visits.cbegin(), visits.cend(), [](const size_t count) { return count == 1; }));
+  std::sort(range_indices.begin(), range_indices.end());
+  EXPECT_EQ(range_indices, (std::vector<size_t>{0, 1, 2, 3, 4, 5, 6}));
+}
+
+TEST_F(UtilsParallelTest, Sort) {
+  for (const auto thread_count : {1, 2, 3, 4, 8}) {
+    for (const auto size : {0, 5, 1000, 12345}) {
+      std::vector<int> values(size);
+      for (auto i = 0; i < size; ++i) values[i] = (i * 7919) % 1009;
+
+      auto expected = values;
+      std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+      parallel_sort(values.begin(), values.end(), std::greater<>{}, thread_count);
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+}  // namespace opossum